@@ -5,6 +5,7 @@ AC_DEFUN([CVC4_CHECK_FOR_CADICAL], [
 AC_MSG_CHECKING([whether user requested CaDiCaL support])
 
 have_libcadical=0
+have_cadical_propagator=0
 CADICAL_LIBS=
 CADICAL_LDFLAGS=
 
@@ -51,6 +52,14 @@ elif test -n "$with_cadical"; then
     have_libcadical=1
   fi
 
+  AC_MSG_CHECKING([whether CaDiCaL has the external propagator interface])
+  CVC4_TRY_CADICAL_PROPAGATOR
+  if test $have_cadical_propagator -eq 1; then
+    AC_MSG_RESULT([yes])
+  else
+    AC_MSG_RESULT([no, --sat-cadical disabled])
+  fi
+
   CADICAL_LDFLAGS="-L$CADICAL_HOME/build"
 
 else
@@ -88,3 +97,28 @@ if test -z "$CADICAL_LIBS"; then
 fi
 ])# CVC4_TRY_CADICAL
 
+
+# CVC4_TRY_CADICAL_PROPAGATOR
+# ------------------------------
+# Check that CaDiCaL has the external propagator interface (IPASIR-UP) of
+# version 1.9, which the DPLL(T) back end (--sat-cadical) is written for
+AC_DEFUN([CVC4_TRY_CADICAL_PROPAGATOR], [
+AC_LANG_PUSH([C++])
+
+cvc4_save_CPPFLAGS="$CPPFLAGS"
+CPPFLAGS="$CPPFLAGS -I$CADICAL_HOME/src"
+
+AC_COMPILE_IFELSE(
+  [AC_LANG_PROGRAM([[#include <cadical.hpp>]],
+    [[CaDiCaL::Solver s;
+      CaDiCaL::ExternalPropagator* p = 0;
+      s.connect_external_propagator(p);
+      s.add_observed_var(1);
+      p->notify_assignment(1, false);]])],
+  [have_cadical_propagator=1],
+  [have_cadical_propagator=0])
+
+CPPFLAGS="$cvc4_save_CPPFLAGS"
+
+AC_LANG_POP([C++])
+])# CVC4_TRY_CADICAL_PROPAGATOR
@@ -246,6 +246,11 @@ bool Configuration::isBuiltWithAbc() {
 
 bool Configuration::isBuiltWithCadical() { return IS_CADICAL_BUILD; }
 
+bool Configuration::isBuiltWithCadicalPropagator()
+{
+  return IS_CADICAL_PROPAGATOR_BUILD;
+}
+
 bool Configuration::isBuiltWithCryptominisat() {
   return IS_CRYPTOMINISAT_BUILD;
 }
@@ -97,6 +97,8 @@ public:
 
   static bool isBuiltWithCadical();
 
+  static bool isBuiltWithCadicalPropagator();
+
   static bool isBuiltWithCryptominisat();
 
   static bool isBuiltWithReadline();
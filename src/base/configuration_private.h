@@ -120,6 +120,12 @@ namespace CVC4 {
 #define IS_CADICAL_BUILD false
 #endif /* CVC4_USE_CADICAL */
 
+#if CVC4_USE_CADICAL_PROPAGATOR
+#define IS_CADICAL_PROPAGATOR_BUILD true
+#else /* CVC4_USE_CADICAL_PROPAGATOR */
+#define IS_CADICAL_PROPAGATOR_BUILD false
+#endif /* CVC4_USE_CADICAL_PROPAGATOR */
+
 #if CVC4_USE_CRYPTOMINISAT
 #  define IS_CRYPTOMINISAT_BUILD true
 #else /* CVC4_USE_CRYPTOMINISAT */
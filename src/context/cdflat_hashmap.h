@@ -0,0 +1,332 @@
+/*********************                                                        */
+/*! \file cdflat_hashmap.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Context-dependent open-addressing hashmap with an undo trail
+ **
+ ** Context-dependent hashmap that stores its elements inline in a flat
+ ** array and keeps undo information on a trail.  It provides the parts
+ ** of the CDHashMap interface that hot maps of the theory engine use,
+ ** without allocating an element (and a context object) per key.
+ **
+ ** See also:
+ **  CDInsertHashMap : An "insert-once" CD hash map.
+ **  CDTrailHashMap : A lightweight CD hash map with poor iteration
+ **    characteristics and some quirks in usage.
+ **  CDHashMap : A fully featured CD hash map. (The closest to <ext/hash_map>)
+ **
+ ** Notes:
+ ** - Elements are kept in insertion order in one array, which is also
+ **   the iteration order.  The hash table holds indices into it and is
+ **   probed linearly.
+ ** - operator[] is only supported as a const derefence (must succeed).
+ **   Use insert(k, d) to add or overwrite a mapping.
+ ** - Overwriting a key inserted at the current context level is done in
+ **   place; otherwise the old value is kept on the trail.
+ ** - Iterators are invalidated by insertions and by pops.
+ ** - There is no insertAtContextLevelZero() and no erase().
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <stdint.h>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "base/cvc4_assert.h"
+#include "base/output.h"
+#include "context/context.h"
+
+namespace CVC4 {
+namespace context {
+
+template <class Key, class Data, class HashFcn = std::hash<Key> >
+class FlatHashMap {
+ public:
+  /** A pair of Key and Data that mirrors hash_map::value_type. */
+  typedef std::pair<Key, Data> value_type;
+
+  /** An iterator over the elements, in insertion order. */
+  typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+ private:
+  /** Marks an unused slot of d_table. */
+  static const uint32_t EMPTY = uint32_t(-1);
+
+  /** The elements, in the order they were inserted. */
+  std::vector<value_type> d_elements;
+
+  /** The slot of d_table holding each element's index. */
+  std::vector<uint32_t> d_slots;
+
+  /**
+   * The open-addressing table: indices into d_elements, or EMPTY.  Its
+   * size is 2^d_log2Size, and it is at most half full.
+   */
+  std::vector<uint32_t> d_table;
+  unsigned d_log2Size;
+
+  /** A value overwritten by insert(), and which element it belonged to. */
+  struct Overwrite {
+    uint32_t d_element;
+    Data d_old;
+    Overwrite(uint32_t element, const Data& old)
+        : d_element(element), d_old(old) {}
+  };/* struct FlatHashMap<>::Overwrite */
+
+  /** The overwritten values, oldest first. */
+  std::vector<Overwrite> d_trail;
+
+  /** The first slot to probe for k. */
+  size_t home(const Key& k) const {
+    // Fibonacci hashing: spread the (often sequential) hash values
+    uint64_t h = uint64_t(HashFcn()(k)) * 0x9e3779b97f4a7c15ull;
+    return size_t(h >> (64 - d_log2Size));
+  }
+
+  /** The slot holding k, or the empty slot where k would go. */
+  size_t probe(const Key& k) const {
+    size_t mask = d_table.size() - 1;
+    size_t i = home(k);
+    while(d_table[i] != EMPTY && !(d_elements[d_table[i]].first == k)) {
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  /**
+   * Double the table.  Elements are reinserted in insertion order, so
+   * that popping the most recent element can still simply clear its
+   * slot.
+   */
+  void grow() {
+    ++d_log2Size;
+    d_table.assign(size_t(1) << d_log2Size, EMPTY);
+    for(size_t e = 0; e < d_elements.size(); ++e) {
+      size_t i = probe(d_elements[e].first);
+      d_table[i] = e;
+      d_slots[e] = i;
+    }
+  }
+
+ public:
+  FlatHashMap() : d_table(16, EMPTY), d_log2Size(4) {}
+
+  const_iterator begin() const { return d_elements.begin(); }
+  const_iterator end() const { return d_elements.end(); }
+
+  /**
+   * Returns an iterator to the Key k of the map.
+   * See hash_map::find()
+   */
+  const_iterator find(const Key& k) const {
+    uint32_t e = d_table[probe(k)];
+    return e == EMPTY ? end() : d_elements.begin() + e;
+  }
+
+  /** Returns true if the map is empty. */
+  bool empty() const { return d_elements.empty(); }
+  /** Returns the number of elements in the map. */
+  size_t size() const { return d_elements.size(); }
+  /** Returns the number of values kept on the trail. */
+  size_t trailSize() const { return d_trail.size(); }
+
+  /** Returns true if k is a mapped key. */
+  bool contains(const Key& k) const {
+    return d_table[probe(k)] != EMPTY;
+  }
+
+  /**
+   * Returns a reference the data mapped by k.
+   * This must succeed.
+   */
+  const Data& operator[](const Key& k) const {
+    uint32_t e = d_table[probe(k)];
+    Assert(e != EMPTY);
+    return d_elements[e].second;
+  }
+
+  /**
+   * Maps k to d.  If k was mapped by an element with index below
+   * keepFrom, its old value is pushed onto the trail.  Returns true
+   * if k was not mapped before.
+   */
+  bool insert(const Key& k, const Data& d, size_t keepFrom) {
+    size_t i = probe(k);
+    uint32_t e = d_table[i];
+    if(e != EMPTY) {
+      if(e < keepFrom) {
+        d_trail.push_back(Overwrite(e, d_elements[e].second));
+      }
+      d_elements[e].second = d;
+      return false;
+    }
+    AlwaysAssert(d_elements.size() < EMPTY, "FlatHashMap is full");
+    d_table[i] = d_elements.size();
+    d_slots.push_back(i);
+    d_elements.push_back(value_type(k, d));
+    if(2 * d_elements.size() > d_table.size()) {
+      grow();
+    }
+    return true;
+  }
+
+  /**
+   * Undo the overwrites beyond the first trailSize, then remove the
+   * elements beyond the first size, most recent first.
+   */
+  void pop_to(size_t size, size_t trailSize) {
+    while(d_trail.size() > trailSize) {
+      const Overwrite& o = d_trail.back();
+      d_elements[o.d_element].second = o.d_old;
+      d_trail.pop_back();
+    }
+    while(d_elements.size() > size) {
+      d_table[d_slots.back()] = EMPTY;
+      d_slots.pop_back();
+      d_elements.pop_back();
+    }
+  }
+};/* class FlatHashMap<> */
+
+template <class Key, class Data, class HashFcn>
+const uint32_t FlatHashMap<Key, Data, HashFcn>::EMPTY;
+
+template <class Key, class Data, class HashFcn = std::hash<Key> >
+class CDFlatHashMap : public ContextObj {
+ private:
+  typedef FlatHashMap<Key, Data, HashFcn> FHM;
+
+  /** The map that backs all of the data. */
+  FHM* d_flatMap;
+
+  /** The number of elements in the current context. */
+  size_t d_size;
+
+  /** The length of the trail in the current context. */
+  size_t d_trailSize;
+
+  /**
+   * The number of elements when this object was last saved, i.e. at
+   * the start of the current context level.  Elements from here on are
+   * removed by the next restore, so overwriting them needs no trail.
+   */
+  size_t d_levelStart;
+
+  /**
+   * Private copy constructor used only by save().  d_flatMap is not
+   * copied: only the base class information and the sizes are needed
+   * in restore.
+   */
+  CDFlatHashMap(const CDFlatHashMap& l) :
+    ContextObj(l),
+    d_flatMap(NULL),
+    d_size(l.d_size),
+    d_trailSize(l.d_trailSize),
+    d_levelStart(l.d_levelStart) {
+  }
+  CDFlatHashMap& operator=(const CDFlatHashMap&) CVC4_UNDEFINED;
+
+  /**
+   * Implementation of mandatory ContextObj method save: simply copies
+   * the current sizes to a copy using the copy constructor.  The saved
+   * information is allocated using the ContextMemoryManager.
+   */
+  ContextObj* save(ContextMemoryManager* pCMM) override
+  {
+    ContextObj* data = new(pCMM) CDFlatHashMap<Key, Data, HashFcn>(*this);
+    d_levelStart = d_size;
+    Debug("CDFlatHashMap") << "save " << this
+                           << " at level " << this->getContext()->getLevel()
+                           << " size at " << this->d_size
+                           << " data:" << data << std::endl;
+    return data;
+  }
+
+ protected:
+  /**
+   * Implementation of mandatory ContextObj method restore: undo the
+   * trail and drop the elements inserted since the save.
+   */
+  void restore(ContextObj* data) override
+  {
+    CDFlatHashMap<Key, Data, HashFcn>* saved =
+        static_cast<CDFlatHashMap<Key, Data, HashFcn>*>(data);
+    d_flatMap->pop_to(saved->d_size, saved->d_trailSize);
+    d_size = saved->d_size;
+    d_trailSize = saved->d_trailSize;
+    d_levelStart = saved->d_levelStart;
+    Assert(d_flatMap->size() == d_size);
+    Debug("CDFlatHashMap") << "restore " << this
+                           << " level " << this->getContext()->getLevel()
+                           << " size back to " << this->d_size << std::endl;
+  }
+
+ public:
+  /** Iterator for the CDFlatHashMap, in insertion order. */
+  typedef typename FHM::const_iterator const_iterator;
+  typedef const_iterator iterator;
+
+  /** Return value of operator* on a const_iterator (pair<Key,Data>).*/
+  typedef typename FHM::value_type value_type;
+
+  CDFlatHashMap(Context* context) :
+    ContextObj(context),
+    d_flatMap(new FHM()),
+    d_size(0),
+    d_trailSize(0),
+    d_levelStart(0) {
+  }
+
+  ~CDFlatHashMap() {
+    this->destroy();
+    delete d_flatMap;
+  }
+
+  /** Returns true if the map is empty in the current context. */
+  bool empty() const { return d_size == 0; }
+
+  /** Returns the size of the map in the current context. */
+  size_t size() const { return d_size; }
+
+  /** Returns true if k is a mapped key in the context. */
+  bool contains(const Key& k) const { return d_flatMap->contains(k); }
+
+  /** Returns 1 if k is a mapped key in the context, 0 otherwise. */
+  size_t count(const Key& k) const { return contains(k) ? 1 : 0; }
+
+  /**
+   * Maps k to d in the current context.  Returns true if k was not
+   * mapped before.
+   */
+  bool insert(const Key& k, const Data& d) {
+    makeCurrent();
+    bool inserted = d_flatMap->insert(k, d, d_levelStart);
+    d_size = d_flatMap->size();
+    d_trailSize = d_flatMap->trailSize();
+    return inserted;
+  }
+
+  /**
+   * Returns a reference the data mapped by k.
+   * k must be in the map in this context.
+   */
+  const Data& operator[](const Key& k) const { return (*d_flatMap)[k]; }
+
+  const_iterator find(const Key& k) const { return d_flatMap->find(k); }
+  const_iterator begin() const { return d_flatMap->begin(); }
+  const_iterator end() const { return d_flatMap->end(); }
+};/* class CDFlatHashMap<> */
+
+}/* CVC4::context namespace */
+}/* CVC4 namespace */
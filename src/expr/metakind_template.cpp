@@ -145,6 +145,19 @@ ${metakind_constDeleters}
 // re-enable the strict-aliasing warning
 # pragma GCC diagnostic warning "-Wstrict-aliasing"
 
+/**
+ * The size of the C++ type representing the constant in a NodeValue of
+ * the given CONSTANT-metakinded kind.  The NodeValue allocator needs
+ * this to find the size class of a constant that is being collected.
+ */
+size_t getNodeValueConstantSize(::CVC4::Kind k) {
+  switch(k) {
+${metakind_constSizes}
+  default:
+    Unhandled(k);
+  }
+}
+
 unsigned getLowerBoundForKind(::CVC4::Kind k) {
   static const unsigned lbs[] = {
     0, /* NULL_EXPR */
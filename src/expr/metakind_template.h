@@ -201,6 +201,7 @@ struct NodeValueConstPrinter {
  * kind of cleanup.
  */
 void deleteNodeValueConstant(::CVC4::expr::NodeValue* nv);
+size_t getNodeValueConstantSize(::CVC4::Kind k);
 
 unsigned getLowerBoundForKind(::CVC4::Kind k);
 unsigned getUpperBoundForKind(::CVC4::Kind k);
@@ -18,6 +18,7 @@
 #include "expr/node_manager.h"
 
 #include <algorithm>
+#include <chrono>
 #include <stack>
 #include <utility>
 
@@ -27,6 +28,7 @@
 #include "expr/node_manager_attributes.h"
 #include "expr/node_manager_listeners.h"
 #include "expr/type_checker.h"
+#include "options/expr_options.h"
 #include "options/options.h"
 #include "options/smt_options.h"
 #include "util/statistics_registry.h"
@@ -41,6 +43,15 @@ CVC4_THREAD_LOCAL NodeManager* NodeManager::s_current = NULL;
 
 namespace {
 
+/** Source of per-thread zombie list indices. */
+std::atomic<unsigned> s_zombieListCounter(0);
+
+/**
+ * The per-thread zombie list used by the current thread, or -1 if it
+ * hasn't been assigned yet.
+ */
+CVC4_THREAD_LOCAL int s_zombieListIndex = -1;
+
 /**
  * This class sets it reference argument to true and ensures that it gets set
  * to false on destruction. This can be used to make sure a flag gets toggled
@@ -96,10 +107,15 @@ NodeManager::NodeManager(ExprManager* exprManager) :
   d_resourceManager(new ResourceManager()),
   d_registrations(new ListenerRegistrationList()),
   next_id(0),
+  d_concurrentAccess(false),
   d_attrManager(new expr::attr::AttributeManager()),
   d_exprManager(exprManager),
   d_nodeUnderDeletion(NULL),
   d_inReclaimZombies(false),
+  d_statGcSteps("expr::NodeManager::gcSteps", 0),
+  d_statGcReclaimed("expr::NodeManager::gcReclaimed", 0),
+  d_statGcPauseTime("expr::NodeManager::gcPauseTime"),
+  d_statGcMaxPauseMicros("expr::NodeManager::gcMaxPauseMicros", 0),
   d_abstractValueCount(0),
   d_skolemCounter(0) {
   init();
@@ -112,10 +128,15 @@ NodeManager::NodeManager(ExprManager* exprManager,
   d_resourceManager(new ResourceManager()),
   d_registrations(new ListenerRegistrationList()),
   next_id(0),
+  d_concurrentAccess(false),
   d_attrManager(new expr::attr::AttributeManager()),
   d_exprManager(exprManager),
   d_nodeUnderDeletion(NULL),
   d_inReclaimZombies(false),
+  d_statGcSteps("expr::NodeManager::gcSteps", 0),
+  d_statGcReclaimed("expr::NodeManager::gcReclaimed", 0),
+  d_statGcPauseTime("expr::NodeManager::gcPauseTime"),
+  d_statGcMaxPauseMicros("expr::NodeManager::gcMaxPauseMicros", 0),
   d_abstractValueCount(0),
   d_skolemCounter(0)
 {
@@ -133,6 +154,12 @@ void NodeManager::init() {
       d_operators[i] = mkConst(Kind(k));
     }
   }
+  d_nodeValueAllocator.registerStatistics(d_statisticsRegistry);
+  d_statisticsRegistry->registerStat(&d_statGcSteps);
+  d_statisticsRegistry->registerStat(&d_statGcReclaimed);
+  d_statisticsRegistry->registerStat(&d_statGcPauseTime);
+  d_statisticsRegistry->registerStat(&d_statGcMaxPauseMicros);
+
   d_resourceManager->setHardLimit((*d_options)[options::hardLimit]);
   if((*d_options)[options::perCallResourceLimit] != 0) {
     d_resourceManager->setResourceLimit((*d_options)[options::perCallResourceLimit], false);
@@ -167,6 +194,8 @@ NodeManager::~NodeManager() {
 
   NodeManagerScope nms(this);
 
+  setConcurrentAccess(false);
+
   {
     ScopedBool dontGC(d_inReclaimZombies);
     // hopefully by this point all SmtEngines have been deleted
@@ -221,18 +250,21 @@ NodeManager::~NodeManager() {
 
   if(Debug.isOn("gc:leaks")) {
     Debug("gc:leaks") << "still in pool:" << endl;
-    for(NodeValuePool::const_iterator i = d_nodeValuePool.begin(),
-          iend = d_nodeValuePool.end();
-        i != iend;
-        ++i) {
-      Debug("gc:leaks") << "  " << *i
-                        << " id=" << (*i)->d_id
-                        << " rc=" << (*i)->d_rc
-                        << " " << **i << endl;
-    }
+    d_nodeValuePool.forEach([](NodeValue* nv) {
+      Debug("gc:leaks") << "  " << nv
+                        << " id=" << nv->d_id
+                        << " rc=" << nv->d_rc
+                        << " " << *nv << endl;
+    });
     Debug("gc:leaks") << ":end:" << endl;
   }
 
+  d_nodeValueAllocator.unregisterStatistics(d_statisticsRegistry);
+  d_statisticsRegistry->unregisterStat(&d_statGcSteps);
+  d_statisticsRegistry->unregisterStat(&d_statGcReclaimed);
+  d_statisticsRegistry->unregisterStat(&d_statGcPauseTime);
+  d_statisticsRegistry->unregisterStat(&d_statGcMaxPauseMicros);
+
   // defensive coding, in case destruction-order issues pop up (they often do)
   delete d_statisticsRegistry;
   d_statisticsRegistry = NULL;
@@ -257,11 +289,17 @@ const Datatype & NodeManager::getDatatypeForIndex( unsigned index ) const{
   return *d_ownedDatatypes[index];
 }
 
-void NodeManager::reclaimZombies() {
-  // FIXME multithreading
+void NodeManager::reclaimZombies(size_t budget) {
+  Assert(!d_concurrentAccess,
+         "zombies cannot be reclaimed in concurrent mode");
   Assert(!d_attrManager->inGarbageCollection());
 
-  Debug("gc") << "reclaiming " << d_zombies.size() << " zombie(s)!\n";
+  Debug("gc") << "reclaiming " << std::min(budget, d_zombies.size())
+              << " of " << d_zombies.size() << " zombie(s)!\n";
+
+  TimerStat::CodeTimer pauseTimer(d_statGcPauseTime);
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
 
   // during reclamation, reclaimZombies() is never supposed to be called
   Assert(! d_inReclaimZombies, "NodeManager::reclaimZombies() not re-entrant!");
@@ -282,14 +320,28 @@ void NodeManager::reclaimZombies() {
   // concurrently process d_zombies in the loop below, such addition
   // may be invisible to us (B is leaked) or even invalidate our
   // iterator, causing a crash.  So we need to copy the set away.
+  //
+  // If there are more zombies than the budget allows, we only take
+  // that many out of the set and leave the others for a later step.
 
   vector<NodeValue*> zombies;
-  zombies.reserve(d_zombies.size());
-  remove_copy_if(d_zombies.begin(),
-                 d_zombies.end(),
-                 back_inserter(zombies),
-                 NodeValueReferenceCountNonZero());
-  d_zombies.clear();
+  if(budget >= d_zombies.size()) {
+    zombies.reserve(d_zombies.size());
+    remove_copy_if(d_zombies.begin(),
+                   d_zombies.end(),
+                   back_inserter(zombies),
+                   NodeValueReferenceCountNonZero());
+    d_zombies.clear();
+  } else {
+    zombies.reserve(budget);
+    NodeValueIDSet::iterator i = d_zombies.begin();
+    for(size_t taken = 0; taken < budget; ++taken) {
+      if((*i)->d_rc == 0) {
+        zombies.push_back(*i);
+      }
+      i = d_zombies.erase(i);
+    }
+  }
 
 #ifdef _LIBCPP_VERSION
   NodeValue* last = NULL;
@@ -355,11 +407,22 @@ void NodeManager::reclaimZombies() {
         // type for a constant payload.)
         kind::metakind::deleteNodeValueConstant(nv);
       }
-      free(nv);
+      deallocateNodeValue(nv);
+      ++d_statGcReclaimed;
     }
   }
+
+  ++d_statGcSteps;
+  d_statGcMaxPauseMicros.maxAssign(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start).count());
 }/* NodeManager::reclaimZombies() */
 
+void NodeManager::reclaimZombiesStep() {
+  size_t budget = (*d_options)[options::gcStepBudget];
+  reclaimZombies(budget == 0 ? d_zombies.size() : budget);
+}
+
 std::vector<NodeValue*> NodeManager::TopologicalSort(
     const std::vector<NodeValue*>& roots) {
   std::vector<NodeValue*> order;
@@ -592,10 +655,80 @@ void NodeManager::reclaimZombiesUntil(uint32_t k){
   }
 }
 
+void NodeManager::reclaimZombiesIncrementally() {
+  if(safeToReclaimZombies() && !d_zombies.empty()) {
+    reclaimZombiesStep();
+  }
+}
+
 size_t NodeManager::poolSize() const{
   return d_nodeValuePool.size();
 }
 
+void NodeManager::deallocateNodeValue(expr::NodeValue* nv) {
+  size_t nslots = nv->d_nchildren;
+  if(nv->getMetaKind() == kind::metakind::CONSTANT) {
+    nslots = NodeValueAllocator::slotsForBytes(
+        kind::metakind::getNodeValueConstantSize(nv->getKind()));
+  }
+  d_nodeValueAllocator.deallocate(nv, nslots);
+}
+
+bool NodeManager::supportsConcurrentAccess() {
+  return NodeValue::hasAtomicRefCountLayout();
+}
+
+void NodeManager::setConcurrentAccess(bool concurrent) {
+  if(concurrent == d_concurrentAccess) {
+    return;
+  }
+  Assert(s_current == this,
+         "setConcurrentAccess() must be called from within a "
+         "NodeManagerScope for this NodeManager");
+  Debug("gc") << "NodeManager " << this << ": concurrent access "
+              << (concurrent ? "enabled" : "disabled") << std::endl;
+  if(concurrent) {
+    AlwaysAssert(supportsConcurrentAccess(),
+                 "NodeValue header layout does not support atomic "
+                 "reference counting on this platform");
+    d_nodeValuePool.setConcurrent(true);
+    d_nodeValueAllocator.setConcurrent(true);
+    d_concurrentAccess = true;
+    NodeValue::s_atomicRefCounts = true;
+    __atomic_add_fetch(&NodeValue::s_concurrentNodeManagers, 1,
+                       __ATOMIC_RELAXED);
+  } else {
+    __atomic_sub_fetch(&NodeValue::s_concurrentNodeManagers, 1,
+                       __ATOMIC_RELAXED);
+    NodeValue::s_atomicRefCounts = false;
+    d_concurrentAccess = false;
+    d_nodeValuePool.setConcurrent(false);
+    d_nodeValueAllocator.setConcurrent(false);
+    collectThreadZombies();
+    if(safeToReclaimZombies() && d_zombies.size() > 5000) {
+      reclaimZombiesStep();
+    }
+  }
+}
+
+void NodeManager::markForDeletionConcurrent(expr::NodeValue* nv) {
+  if(s_zombieListIndex < 0) {
+    s_zombieListIndex = s_zombieListCounter.fetch_add(1) % NUM_THREAD_ZOMBIE_LISTS;
+  }
+  ThreadZombieList& list = d_threadZombies[s_zombieListIndex];
+  std::lock_guard<std::mutex> lock(list.d_mutex);
+  list.d_zombies.push_back(nv);
+}
+
+void NodeManager::collectThreadZombies() {
+  Assert(!d_concurrentAccess);
+  for(unsigned i = 0; i < NUM_THREAD_ZOMBIE_LISTS; ++i) {
+    std::vector<NodeValue*>& zombies = d_threadZombies[i].d_zombies;
+    d_zombies.insert(zombies.begin(), zombies.end());
+    zombies.clear();
+  }
+}
+
 TypeNode NodeManager::mkSort(uint32_t flags) {
   NodeBuilder<1> nb(this, kind::SORT_TYPE);
   Node sortTag = NodeBuilder<0>(this, kind::SORT_TAG);
@@ -784,8 +917,8 @@ Node NodeManager::mkAbstractValue(const TypeNode& type) {
 }
 
 bool NodeManager::safeToReclaimZombies() const{
-  // FIXME multithreading
-  return !d_inReclaimZombies && !d_attrManager->inGarbageCollection();
+  return !d_concurrentAccess && !d_inReclaimZombies
+         && !d_attrManager->inGarbageCollection();
 }
 
 void NodeManager::deleteAttributes(const std::vector<const expr::attr::AttributeUniqueId*>& ids){
@@ -28,6 +28,8 @@
 #ifndef __CVC4__NODE_MANAGER_H
 #define __CVC4__NODE_MANAGER_H
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <unordered_set>
@@ -36,6 +38,8 @@
 #include "expr/kind.h"
 #include "expr/metakind.h"
 #include "expr/node_value.h"
+#include "expr/node_value_allocator.h"
+#include "expr/node_value_pool.h"
 #include "options/options.h"
 
 namespace CVC4 {
@@ -94,9 +98,7 @@ class NodeManager {
     bool operator()(expr::NodeValue* nv) { return nv->d_rc > 0; }
   };
 
-  typedef std::unordered_set<expr::NodeValue*,
-                             expr::NodeValuePoolHashFunction,
-                             expr::NodeValuePoolEq> NodeValuePool;
+  typedef expr::NodeValuePool NodeValuePool;
   typedef std::unordered_set<expr::NodeValue*,
                              expr::NodeValueIDHashFunction,
                              expr::NodeValueIDEquality> NodeValueIDSet;
@@ -116,7 +118,16 @@ class NodeManager {
 
   NodeValuePool d_nodeValuePool;
 
-  size_t next_id;
+  /** Storage for the NodeValues owned by this NodeManager. */
+  expr::NodeValueAllocator d_nodeValueAllocator;
+
+  std::atomic<size_t> next_id;
+
+  /**
+   * True iff several threads may be building nodes with this
+   * NodeManager at the same time.  See setConcurrentAccess().
+   */
+  bool d_concurrentAccess;
 
   expr::attr::AttributeManager* d_attrManager;
 
@@ -151,12 +162,50 @@ class NodeManager {
    */
   NodeValueIDSet d_zombies;
 
+  /** Number of per-thread zombie lists used in concurrent mode. */
+  static const unsigned NUM_THREAD_ZOMBIE_LISTS = 64;
+
+  /**
+   * A list of zombies collected by one thread while in concurrent
+   * mode.  Each thread picks its own list, so the mutex is normally
+   * uncontended.  A NodeValue may appear more than once if it is
+   * resurrected and zombified again; duplicates go away when the
+   * lists are folded into d_zombies.
+   */
+  struct ThreadZombieList {
+    std::mutex d_mutex;
+    std::vector<expr::NodeValue*> d_zombies;
+  };/* struct NodeManager::ThreadZombieList */
+
+  /**
+   * Zombies collected while in concurrent mode.  No zombie is reclaimed
+   * in concurrent mode, since another thread may resurrect it from the
+   * pool at any time; these are moved to d_zombies when concurrent mode
+   * is left.
+   */
+  ThreadZombieList d_threadZombies[NUM_THREAD_ZOMBIE_LISTS];
+
   /**
    * NodeValues with maxed out reference counts. These live as long as the
    * NodeManager. They have a custom deallocation procedure at the very end.
    */
   std::vector<expr::NodeValue*> d_maxedOut;
 
+  /** Guards d_maxedOut in concurrent mode. */
+  std::mutex d_maxedOutMutex;
+
+  /** Number of zombie collection steps (pauses). */
+  IntStat d_statGcSteps;
+
+  /** Number of NodeValues reclaimed. */
+  IntStat d_statGcReclaimed;
+
+  /** Total time spent reclaiming zombies. */
+  TimerStat d_statGcPauseTime;
+
+  /** Longest single zombie collection step, in microseconds. */
+  IntStat d_statGcMaxPauseMicros;
+
   /**
    * A set of operator singletons (w.r.t.  to this NodeManager
    * instance) for operators.  Conceptually, Nodes with kind, say,
@@ -240,12 +289,16 @@ class NodeManager {
   inline expr::NodeValue* poolLookup(expr::NodeValue* nv) const;
 
   /**
-   * Insert a NodeValue into the NodeManager's pool.
+   * Insert a NodeValue into the NodeManager's pool, and return the
+   * NodeValue now in the pool.
    *
    * It is an error to insert a NodeValue already in the pool.
-   * Enquire first with poolLookup().
+   * Enquire first with poolLookup().  In concurrent mode another
+   * thread may insert an equal NodeValue between the poolLookup() and
+   * the poolInsert(); in that case the pooled NodeValue is returned
+   * and the caller must discard nv.
    */
-  inline void poolInsert(expr::NodeValue* nv);
+  inline expr::NodeValue* poolInsert(expr::NodeValue* nv);
 
   /**
    * Remove a NodeValue from the NodeManager's pool.
@@ -262,10 +315,60 @@ class NodeManager {
     return d_nodeUnderDeletion == nv;
   }
 
+  /**
+   * Allocate uninitialized storage for a NodeValue with room for
+   * nslots children (or pointer-sized words of constant payload).
+   */
+  inline expr::NodeValue* allocateNodeValue(size_t nslots) {
+    return d_nodeValueAllocator.allocate(nslots);
+  }
+
+  /**
+   * Allocate uninitialized storage for a NodeValue holding a constant
+   * of type T.
+   */
+  template <class T>
+  inline expr::NodeValue* allocateConstNodeValue() {
+    return allocateNodeValue(
+        expr::NodeValueAllocator::slotsForBytes(sizeof(T)));
+  }
+
+  /**
+   * Release the storage of a fully-constructed NodeValue allocated by
+   * allocateNodeValue().  Destructors (of constant payloads, say) must
+   * have been run already.
+   */
+  void deallocateNodeValue(expr::NodeValue* nv);
+
+  /** Get a fresh NodeValue id. */
+  inline uint64_t nextId() {
+    if(__builtin_expect( d_concurrentAccess, false )) {
+      return next_id.fetch_add(1, std::memory_order_relaxed);
+    }
+    // avoid the locked instruction in the single-threaded case
+    size_t id = next_id.load(std::memory_order_relaxed);
+    next_id.store(id + 1, std::memory_order_relaxed);
+    return id;
+  }
+
+  /**
+   * Register a NodeValue as a zombie from a thread in concurrent mode.
+   */
+  void markForDeletionConcurrent(expr::NodeValue* nv);
+
+  /**
+   * Move the zombies collected in concurrent mode into d_zombies.
+   */
+  void collectThreadZombies();
+
   /**
    * Register a NodeValue as a zombie.
    */
   inline void markForDeletion(expr::NodeValue* nv) {
+    if(__builtin_expect( d_concurrentAccess, false )) {
+      markForDeletionConcurrent(nv);
+      return;
+    }
     Assert(nv->d_rc == 0);
 
     // if d_reclaiming is set, make sure we don't call
@@ -277,11 +380,11 @@ class NodeManager {
       Debug("gc") << (d_inReclaimZombies ? " [CURRENTLY-RECLAIMING]" : "")
                   << std::endl;
     }
-    d_zombies.insert(nv);  // FIXME multithreading
+    d_zombies.insert(nv);
 
     if(safeToReclaimZombies()) {
       if(d_zombies.size() > 5000) {
-        reclaimZombies();
+        reclaimZombiesStep();
       }
     }
   }
@@ -296,13 +399,31 @@ class NodeManager {
       Debug("gc") << "marking node value " << nv
                   << " [" << nv->d_id << "]: as maxed out" << std::endl;
     }
-    d_maxedOut.push_back(nv);
+    if(__builtin_expect( d_concurrentAccess, false )) {
+      std::lock_guard<std::mutex> lock(d_maxedOutMutex);
+      d_maxedOut.push_back(nv);
+    } else {
+      d_maxedOut.push_back(nv);
+    }
   }
 
   /**
-   * Reclaim all zombies.
+   * Reclaim all zombies.  Zombies created by the reclamation (children
+   * whose reference count drops to zero) are left for later.
    */
-  void reclaimZombies();
+  void reclaimZombies() { reclaimZombies(d_zombies.size()); }
+
+  /**
+   * Reclaim at most budget zombies.  As with reclaimZombies(), this
+   * may zombify children of the reclaimed NodeValues; they are only
+   * reclaimed by a later call.
+   */
+  void reclaimZombies(size_t budget);
+
+  /**
+   * Reclaim as many zombies as --gc-step-budget allows.
+   */
+  void reclaimZombiesStep();
 
   /**
    * It is safe to collect zombies.
@@ -941,9 +1062,44 @@ public:
   /** Reclaims all zombies (if possible).*/
   void reclaimAllZombies();
 
+  /**
+   * Do one bounded step of zombie collection (if possible), even if
+   * there are fewer zombies than would trigger one.  This is meant to
+   * be called at safe points such as SmtEngine command boundaries,
+   * so that garbage is reclaimed between commands, in small steps,
+   * rather than in long pauses in the middle of solving.
+   */
+  void reclaimZombiesIncrementally();
+
   /** Size of the node pool. */
   size_t poolSize() const;
 
+  /**
+   * Allow (or stop allowing) several threads to build nodes with this
+   * NodeManager at the same time.  While concurrent access is enabled,
+   * the node pool is sharded and locked, NodeValue ids and reference
+   * counts are maintained atomically, and zombies are queued on
+   * per-thread lists instead of being reclaimed.  Disabling concurrent
+   * access folds those lists back and reclaims zombies as usual.
+   *
+   * This must be called from within a NodeManagerScope for this
+   * NodeManager, while no other thread is using it.  Each worker
+   * thread needs its own NodeManagerScope, entered after concurrent
+   * access is enabled: the scope is where a thread picks up the mode.
+   * Only node construction is made thread-safe: attributes (including
+   * cached types), skolem and abstract-value counters and listeners
+   * remain single-threaded, so workers must not call getType() or
+   * mkSkolem() concurrently; early type checking is skipped in
+   * concurrent mode for that reason.
+   */
+  void setConcurrentAccess(bool concurrent);
+
+  /** Whether concurrent access is currently enabled. */
+  bool hasConcurrentAccess() const { return d_concurrentAccess; }
+
+  /** Whether concurrent access can be enabled on this platform. */
+  static bool supportsConcurrentAccess();
+
   /** Deletes a list of attributes from the NM's AttributeManager.*/
   void deleteAttributes(const std::vector< const expr::attr::AttributeUniqueId* >& ids);
 
@@ -992,6 +1148,7 @@ public:
     // Expr is destructed, there's no active node manager.
     //Assert(nm != NULL);
     NodeManager::s_current = nm;
+    expr::NodeValue::s_atomicRefCounts = nm != NULL && nm->d_concurrentAccess;
     //Options::s_current = nm ? nm->d_options : NULL;
     Debug("current") << "node manager scope: "
                      << NodeManager::s_current << "\n";
@@ -999,6 +1156,8 @@ public:
 
   ~NodeManagerScope() {
     NodeManager::s_current = d_oldNodeManager;
+    expr::NodeValue::s_atomicRefCounts =
+        d_oldNodeManager != NULL && d_oldNodeManager->d_concurrentAccess;
     //Options::s_current = d_oldNodeManager ? d_oldNodeManager->d_options : NULL;
     Debug("current") << "node manager scope: "
                      << "returning to " << NodeManager::s_current << "\n";
@@ -1156,25 +1315,20 @@ inline TypeNode NodeManager::mkTesterType(TypeNode domain) {
 }
 
 inline expr::NodeValue* NodeManager::poolLookup(expr::NodeValue* nv) const {
-  NodeValuePool::const_iterator find = d_nodeValuePool.find(nv);
-  if(find == d_nodeValuePool.end()) {
-    return NULL;
-  } else {
-    return *find;
-  }
+  return d_nodeValuePool.lookup(nv);
 }
 
-inline void NodeManager::poolInsert(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) == d_nodeValuePool.end(),
+inline expr::NodeValue* NodeManager::poolInsert(expr::NodeValue* nv) {
+  Assert(d_concurrentAccess || !d_nodeValuePool.contains(nv),
          "NodeValue already in the pool!");
-  d_nodeValuePool.insert(nv);// FIXME multithreading
+  return d_nodeValuePool.insert(nv);
 }
 
 inline void NodeManager::poolRemove(expr::NodeValue* nv) {
-  Assert(d_nodeValuePool.find(nv) != d_nodeValuePool.end(),
+  Assert(d_nodeValuePool.contains(nv),
          "NodeValue is not in the pool!");
 
-  d_nodeValuePool.erase(nv);// FIXME multithreading
+  d_nodeValuePool.erase(nv);
 }
 
 inline Expr NodeManager::toExpr(TNode n) {
@@ -1520,21 +1674,23 @@ NodeClass NodeManager::mkConstInternal(const T& val) {
     return NodeClass(nv);
   }
 
-  nv = (expr::NodeValue*)
-    std::malloc(sizeof(expr::NodeValue) + sizeof(T));
-  if(nv == NULL) {
-    throw std::bad_alloc();
-  }
+  nv = allocateConstNodeValue<T>();
 
   nv->d_nchildren = 0;
   nv->d_kind = kind::metakind::ConstantMap<T>::kind;
-  nv->d_id = next_id++;// FIXME multithreading
+  nv->d_id = nextId();
   nv->d_rc = 0;
 
   //OwningTheory::mkConst(val);
   new (&nv->d_children) T(val);
 
-  poolInsert(nv);
+  expr::NodeValue* poolNv = poolInsert(nv);
+  if(poolNv != nv) {
+    // another thread got there first
+    kind::metakind::deleteNodeValueConstant(nv);
+    deallocateNodeValue(nv);
+    return NodeClass(poolNv);
+  }
   if(Debug.isOn("gc")) {
     Debug("gc") << "creating node value " << nv
                 << " [" << nv->d_id << "]: ";
@@ -34,6 +34,88 @@ using namespace std;
 namespace CVC4 {
 namespace expr {
 
+#if defined(__GNUC__) && !defined(SWIG)
+__thread bool NodeValue::s_atomicRefCounts = false;
+#else /* __GNUC__ && !SWIG */
+CVC4_THREAD_LOCAL bool NodeValue::s_atomicRefCounts = false;
+#endif /* __GNUC__ && !SWIG */
+
+unsigned NodeValue::s_concurrentNodeManagers = 0;
+
+namespace {
+
+/** The reference count is stored right above the id in the header. */
+const unsigned RC_SHIFT = __CVC4__EXPR__NODE_VALUE__NBITS__ID;
+const uint64_t RC_ONE = uint64_t(1) << RC_SHIFT;
+
+static_assert(__CVC4__EXPR__NODE_VALUE__NBITS__ID +
+                  __CVC4__EXPR__NODE_VALUE__NBITS__REFCOUNT <= 64,
+              "id and reference count must share the first header word");
+
+/**
+ * The header word holding the reference count.  Apart from the
+ * reference count, this word only holds the id, which never changes
+ * once the NodeValue is visible to other threads.
+ */
+inline uint64_t* refCountWord(NodeValue* nv) {
+  return reinterpret_cast<uint64_t*>(nv);
+}
+
+}/* CVC4::expr::<anonymous> namespace */
+
+bool NodeValue::hasAtomicRefCountLayout() {
+  NodeValue probe;
+  *refCountWord(&probe) = 0;
+  probe.d_rc = 1;
+  return *refCountWord(&probe) == RC_ONE;
+}
+
+void NodeValue::incAtomic() {
+  Assert(!isBeingDeleted(),
+         "NodeValue is currently being deleted "
+         "and increment is being called on it. Don't Do That!");
+  uint64_t* word = refCountWord(this);
+  uint64_t old = __atomic_load_n(word, __ATOMIC_RELAXED);
+  uint64_t rc;
+  do {
+    rc = (old >> RC_SHIFT) & MAX_RC;
+    if (rc == MAX_RC) {
+      // sticky
+      return;
+    }
+  } while (!__atomic_compare_exchange_n(word, &old, old + RC_ONE, true,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+  if (__builtin_expect((rc + 1 == MAX_RC), false)) {
+    Assert(NodeManager::currentNM() != NULL,
+           "No current NodeManager on incrementing of NodeValue: "
+           "maybe a public CVC4 interface function is missing a "
+           "NodeManagerScope ?");
+    NodeManager::currentNM()->markRefCountMaxedOut(this);
+  }
+}
+
+void NodeValue::decAtomic() {
+  uint64_t* word = refCountWord(this);
+  uint64_t old = __atomic_load_n(word, __ATOMIC_RELAXED);
+  uint64_t rc;
+  do {
+    rc = (old >> RC_SHIFT) & MAX_RC;
+    if (rc == MAX_RC) {
+      // sticky
+      return;
+    }
+    Assert(rc > 0, "reference count underflow");
+  } while (!__atomic_compare_exchange_n(word, &old, old - RC_ONE, true,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+  if (__builtin_expect((rc == 1), false)) {
+    Assert(NodeManager::currentNM() != NULL,
+           "No current NodeManager on destruction of NodeValue: "
+           "maybe a public CVC4 interface function is missing a "
+           "NodeManagerScope ?");
+    NodeManager::currentNM()->markForDeletion(this);
+  }
+}
+
 string NodeValue::toString() const {
   stringstream ss;
 
@@ -31,6 +31,7 @@
 #include <iterator>
 #include <string>
 
+#include "base/tls.h"
 #include "expr/kind.h"
 #include "options/language.h"
 
@@ -40,6 +41,7 @@ template <bool ref_count> class NodeTemplate;
 class TypeNode;
 template <unsigned N> class NodeBuilder;
 class NodeManager;
+class NodeManagerScope;
 
 namespace expr {
   class NodeValue;
@@ -106,6 +108,7 @@ class NodeValue {
   friend class ::CVC4::TypeNode;
   template <unsigned nchild_thresh> friend class ::CVC4::NodeBuilder;
   friend class ::CVC4::NodeManager;
+  friend class ::CVC4::NodeManagerScope;
 
   template <Kind k, bool pool>
   friend struct ::CVC4::kind::metakind::NodeValueConstCompare;
@@ -118,6 +121,52 @@ class NodeValue {
   void inc();
   void dec();
 
+  /**
+   * Atomic versions of inc() and dec(), used while the current
+   * NodeManager is in concurrent mode (see
+   * NodeManager::setConcurrentAccess()).
+   */
+  void incAtomic();
+  void decAtomic();
+
+  /**
+   * Whether the current thread's NodeManager is in concurrent mode, in
+   * which case reference counts are maintained with atomic operations.
+   * This caches NodeManager::hasConcurrentAccess(); it is only updated
+   * when a NodeManagerScope is entered or left and when the current
+   * NodeManager changes mode, so inc() and dec() never look at shared
+   * state.  Where supported, it is a __thread variable, which needs no
+   * C++ thread_local wrapper call on access.  It keeps the default TLS
+   * model, so that libcvc4 can still be loaded with dlopen() (e.g. by
+   * the language bindings).
+   */
+#if defined(__GNUC__) && !defined(SWIG)
+  static __thread bool s_atomicRefCounts;
+#else /* __GNUC__ && !SWIG */
+  static CVC4_THREAD_LOCAL bool s_atomicRefCounts;
+#endif /* __GNUC__ && !SWIG */
+
+  /**
+   * The number of NodeManagers in concurrent mode.  With the default TLS
+   * model, reading s_atomicRefCounts from libcvc4 is a call to
+   * __tls_get_addr(), so inc() and dec() only read it while this is
+   * nonzero.  Updated by NodeManager::setConcurrentAccess().
+   */
+  static unsigned s_concurrentNodeManagers;
+
+  /** Whether inc() and dec() have to use incAtomic() and decAtomic(). */
+  static inline bool useAtomicRefCounts() {
+    unsigned concurrent =
+        __atomic_load_n(&s_concurrentNodeManagers, __ATOMIC_RELAXED);
+    return __builtin_expect(concurrent != 0, false) && s_atomicRefCounts;
+  }
+
+  /**
+   * Check that the reference count occupies the bits of the first
+   * header word that incAtomic() and decAtomic() assume it does.
+   */
+  static bool hasAtomicRefCountLayout();
+
   // Returns true if the reference count is maximized.
   inline bool HasMaximizedReferenceCount() { return d_rc == MAX_RC; }
 
@@ -418,7 +467,10 @@ inline void NodeValue::inc() {
   Assert(!isBeingDeleted(),
          "NodeValue is currently being deleted "
          "and increment is being called on it. Don't Do That!");
-  // FIXME multithreading
+  if (useAtomicRefCounts()) {
+    incAtomic();
+    return;
+  }
   if (__builtin_expect((d_rc < MAX_RC - 1), true)) {
     ++d_rc;
   } else if (__builtin_expect((d_rc == MAX_RC - 1), false)) {
@@ -432,7 +484,10 @@ inline void NodeValue::inc() {
 }
 
 inline void NodeValue::dec() {
-  // FIXME multithreading
+  if (useAtomicRefCounts()) {
+    decAtomic();
+    return;
+  }
   if(__builtin_expect( ( d_rc < MAX_RC ), true )) {
     --d_rc;
     if(__builtin_expect( ( d_rc == 0 ), false )) {
@@ -0,0 +1,155 @@
+/*********************                                                        */
+/*! \file node_value_allocator.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Slab allocator for NodeValues
+ **
+ ** Slab allocator for NodeValues.
+ **/
+
+#include "expr/node_value_allocator.h"
+
+#include <algorithm>
+
+#include "base/cvc4_assert.h"
+#include "base/output.h"
+
+namespace CVC4 {
+namespace expr {
+
+NodeValueAllocator::NodeValueAllocator()
+    : d_largeNodeValues(0),
+      d_concurrent(false),
+      d_statSlabs("expr::NodeValueAllocator::slabs", 0),
+      d_statOccupancy("expr::NodeValueAllocator::slabOccupancy", *this),
+      d_statLargeNodeValues("expr::NodeValueAllocator::largeNodeValues",
+                            d_largeNodeValues) {
+}
+
+NodeValueAllocator::~NodeValueAllocator() {
+  int64_t live = 0;
+  for (size_t nslots = 0; nslots <= MAX_SLAB_SLOTS; ++nslots) {
+    live += d_classes[nslots].d_live;
+  }
+  if (live == 0) {
+    for (const Slab& slab : d_slabs) {
+      std::free(slab.first);
+    }
+    d_slabs.clear();
+    return;
+  }
+
+  // Count the free cells of each slab, from the free lists and the
+  // untouched ends of the current slabs, and release only the slabs
+  // whose cells are all free.
+  std::sort(d_slabs.begin(), d_slabs.end());
+  std::vector<size_t> free(d_slabs.size(), 0);
+  for (size_t nslots = 0; nslots <= MAX_SLAB_SLOTS; ++nslots) {
+    const SizeClass& sc = d_classes[nslots];
+    for (FreeCell* cell = sc.d_free; cell != NULL; cell = cell->d_next) {
+      ++free[slabOf(reinterpret_cast<char*>(cell))];
+    }
+    if (sc.d_bump != sc.d_bumpEnd) {
+      free[slabOf(sc.d_bump)] += (sc.d_bumpEnd - sc.d_bump) / cellSize(nslots);
+    }
+  }
+  size_t kept = 0;
+  for (size_t i = 0; i < d_slabs.size(); ++i) {
+    if (free[i] == SLAB_SIZE / cellSize(d_slabs[i].second)) {
+      std::free(d_slabs[i].first);
+    } else {
+      ++kept;
+    }
+  }
+  Debug("gc:leaks") << "NodeValueAllocator: " << live
+                    << " NodeValues outlive their NodeManager, keeping "
+                    << kept << " of " << d_slabs.size() << " slabs" << std::endl;
+  d_slabs.clear();
+}
+
+size_t NodeValueAllocator::slabOf(char* p) const {
+  std::vector<Slab>::const_iterator i = std::upper_bound(
+      d_slabs.begin(), d_slabs.end(), Slab(p, MAX_SLAB_SLOTS + 1));
+  Assert(i != d_slabs.begin());
+  --i;
+  Assert(p >= i->first && p < i->first + SLAB_SIZE);
+  return i - d_slabs.begin();
+}
+
+void NodeValueAllocator::registerStatistics(StatisticsRegistry* registry) {
+  registry->registerStat(&d_statSlabs);
+  registry->registerStat(&d_statOccupancy);
+  registry->registerStat(&d_statLargeNodeValues);
+}
+
+void NodeValueAllocator::unregisterStatistics(StatisticsRegistry* registry) {
+  registry->unregisterStat(&d_statSlabs);
+  registry->unregisterStat(&d_statOccupancy);
+  registry->unregisterStat(&d_statLargeNodeValues);
+}
+
+NodeValueAllocator::FreeCell* NodeValueAllocator::refill(size_t nslots) {
+  Assert(isSlabAllocated(nslots));
+  char* slab = static_cast<char*>(std::malloc(SLAB_SIZE));
+  if (slab == NULL) {
+    throw std::bad_alloc();
+  }
+  {
+    std::unique_lock<std::mutex> lock(d_mutex, std::defer_lock);
+    if (d_concurrent) {
+      lock.lock();
+    }
+    d_slabs.push_back(Slab(slab, nslots));
+    ++d_statSlabs;
+  }
+
+  // whatever doesn't fill a whole cell at the end of the slab is wasted
+  size_t size = cellSize(nslots);
+  SizeClass& sc = d_classes[nslots];
+  sc.d_bump = slab + size;
+  sc.d_bumpEnd = slab + (SLAB_SIZE / size) * size;
+  return reinterpret_cast<FreeCell*>(slab);
+}
+
+NodeValue* NodeValueAllocator::allocateLarge(size_t nslots) {
+  void* p = std::malloc(cellSize(nslots));
+  if (p == NULL) {
+    throw std::bad_alloc();
+  }
+  std::unique_lock<std::mutex> lock(d_mutex, std::defer_lock);
+  if (d_concurrent) {
+    lock.lock();
+  }
+  ++d_largeNodeValues;
+  return static_cast<NodeValue*>(p);
+}
+
+void NodeValueAllocator::deallocateLarge(NodeValue* nv) {
+  std::free(nv);
+  std::unique_lock<std::mutex> lock(d_mutex, std::defer_lock);
+  if (d_concurrent) {
+    lock.lock();
+  }
+  --d_largeNodeValues;
+}
+
+double NodeValueAllocator::occupancy() const {
+  if (d_slabs.empty()) {
+    return 0;
+  }
+  int64_t inUse = 0;
+  for (size_t nslots = 0; nslots <= MAX_SLAB_SLOTS; ++nslots) {
+    inUse += d_classes[nslots].d_live * cellSize(nslots);
+  }
+  return double(inUse) / (double(d_slabs.size()) * SLAB_SIZE);
+}
+
+}/* CVC4::expr namespace */
+}/* CVC4 namespace */
@@ -0,0 +1,242 @@
+/*********************                                                        */
+/*! \file node_value_allocator.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Slab allocator for NodeValues
+ **
+ ** Slab allocator for NodeValues.  NodeValues are variable-length
+ ** objects: a fixed header followed by a number of pointer-sized slots
+ ** holding the children (or the payload of a constant).  Small
+ ** NodeValues are carved out of large slabs, with one free list per
+ ** slot count, so that building and collecting millions of nodes
+ ** doesn't go through malloc() for each of them.  Larger NodeValues
+ ** are malloc()ed as before.  The slabs are released when the
+ ** allocator (i.e., its NodeManager) is destroyed, except for those
+ ** still holding NodeValues that outlive it.
+ **/
+
+#include "cvc4_private.h"
+
+// circular dependency
+#include "expr/node_value.h"
+
+#ifndef __CVC4__EXPR__NODE_VALUE_ALLOCATOR_H
+#define __CVC4__EXPR__NODE_VALUE_ALLOCATOR_H
+
+#include <stdint.h>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace expr {
+
+class NodeValueAllocator {
+ public:
+  /**
+   * NodeValues with at most this many slots after the header are
+   * allocated from slabs; larger ones are malloc()ed.
+   */
+  static const size_t MAX_SLAB_SLOTS = 16;
+
+  /** Size in bytes of one slab. */
+  static const size_t SLAB_SIZE = 64 * 1024;
+
+  NodeValueAllocator();
+
+  /**
+   * Release the slabs.  A slab that still holds a live NodeValue, i.e.
+   * one referenced by a Node that outlives the NodeManager, is not
+   * released, just as such a NodeValue was leaked when it was
+   * malloc()ed on its own.
+   */
+  ~NodeValueAllocator();
+
+  /** The number of slots needed for a payload of the given size. */
+  static size_t slotsForBytes(size_t bytes) {
+    return (bytes + sizeof(NodeValue*) - 1) / sizeof(NodeValue*);
+  }
+
+  /** Whether a NodeValue with nslots slots is allocated from a slab. */
+  static bool isSlabAllocated(size_t nslots) {
+    return nslots <= MAX_SLAB_SLOTS;
+  }
+
+  /**
+   * Allocate uninitialized storage for a NodeValue with nslots slots.
+   *
+   * @throws bad_alloc if the storage cannot be allocated
+   */
+  NodeValue* allocate(size_t nslots) {
+    if (__builtin_expect(!isSlabAllocated(nslots), false)) {
+      return allocateLarge(nslots);
+    }
+    SizeClass& sc = d_classes[nslots];
+    ClassLock lock(sc, d_concurrent);
+    FreeCell* cell = sc.d_free;
+    if (__builtin_expect(cell != NULL, true)) {
+      sc.d_free = cell->d_next;
+    } else if (__builtin_expect(sc.d_bump != sc.d_bumpEnd, true)) {
+      cell = reinterpret_cast<FreeCell*>(sc.d_bump);
+      sc.d_bump += cellSize(nslots);
+    } else {
+      cell = refill(nslots);
+    }
+    ++sc.d_live;
+    return reinterpret_cast<NodeValue*>(cell);
+  }
+
+  /**
+   * Return the storage of a NodeValue with nslots slots to the
+   * allocator.  The NodeValue must have been obtained from allocate()
+   * with the same slot count (or, for large NodeValues, from
+   * malloc()).
+   */
+  void deallocate(NodeValue* nv, size_t nslots) {
+    if (__builtin_expect(!isSlabAllocated(nslots), false)) {
+      deallocateLarge(nv);
+      return;
+    }
+    SizeClass& sc = d_classes[nslots];
+    ClassLock lock(sc, d_concurrent);
+    FreeCell* cell = reinterpret_cast<FreeCell*>(nv);
+    cell->d_next = sc.d_free;
+    sc.d_free = cell;
+    --sc.d_live;
+  }
+
+  /**
+   * Switch between single-threaded and concurrent mode.  In concurrent
+   * mode each size class is locked on access.  This must not be called
+   * while other threads are using the allocator.
+   */
+  void setConcurrent(bool concurrent) { d_concurrent = concurrent; }
+
+  /** Register the occupancy statistics with the given registry. */
+  void registerStatistics(StatisticsRegistry* registry);
+
+  /** Unregister the occupancy statistics from the given registry. */
+  void unregisterStatistics(StatisticsRegistry* registry);
+
+ private:
+  /** A free cell, linked into the free list of its size class. */
+  struct FreeCell {
+    FreeCell* d_next;
+  };/* struct NodeValueAllocator::FreeCell */
+
+  /** The state of one size class. */
+  struct SizeClass {
+    /** Cells that were deallocated and can be reused. */
+    FreeCell* d_free;
+    /** The untouched part of the current slab of this size class. */
+    char* d_bump;
+    char* d_bumpEnd;
+    /** Number of cells of this size class currently handed out. */
+    int64_t d_live;
+    /** Guards this size class in concurrent mode. */
+    std::mutex d_mutex;
+
+    SizeClass() : d_free(NULL), d_bump(NULL), d_bumpEnd(NULL), d_live(0) {}
+  };/* struct NodeValueAllocator::SizeClass */
+
+  /** Locks a size class, but only in concurrent mode. */
+  class ClassLock {
+    std::mutex* d_mutex;
+   public:
+    ClassLock(SizeClass& sc, bool concurrent)
+        : d_mutex(concurrent ? &sc.d_mutex : NULL) {
+      if (d_mutex != NULL) {
+        d_mutex->lock();
+      }
+    }
+    ~ClassLock() {
+      if (d_mutex != NULL) {
+        d_mutex->unlock();
+      }
+    }
+  };/* class NodeValueAllocator::ClassLock */
+
+  static size_t cellSize(size_t nslots) {
+    return sizeof(NodeValue) + nslots * sizeof(NodeValue*);
+  }
+
+  /**
+   * Start a new slab for the given size class and return its first
+   * cell.  The caller holds the size class lock (if any).
+   */
+  FreeCell* refill(size_t nslots);
+
+  /**
+   * The index in d_slabs of the slab containing p.  d_slabs must be
+   * sorted.
+   */
+  size_t slabOf(char* p) const;
+
+  /** Allocate a NodeValue that is too large for the slabs. */
+  NodeValue* allocateLarge(size_t nslots);
+
+  /** Free a NodeValue obtained from allocateLarge(). */
+  void deallocateLarge(NodeValue* nv);
+
+  /** The fraction of slab memory currently handed out. */
+  double occupancy() const;
+
+  /** Statistic reporting occupancy(), computed when it is read. */
+  class OccupancyStat : public ReadOnlyDataStat<double> {
+    const NodeValueAllocator& d_allocator;
+    mutable double d_value;
+   public:
+    OccupancyStat(const std::string& name, const NodeValueAllocator& a)
+        : ReadOnlyDataStat<double>(name), d_allocator(a), d_value(0) {}
+    double getData() const override {
+      d_value = d_allocator.occupancy();
+      return d_value;
+    }
+    const double& getDataRef() const override {
+      getData();
+      return d_value;
+    }
+  };/* class NodeValueAllocator::OccupancyStat */
+
+  SizeClass d_classes[MAX_SLAB_SLOTS + 1];
+
+  /** A slab and the slot count of its size class. */
+  typedef std::pair<char*, size_t> Slab;
+
+  /** All slabs, released in the destructor. */
+  std::vector<Slab> d_slabs;
+
+  /** Number of live NodeValues that were malloc()ed. */
+  int64_t d_largeNodeValues;
+
+  /** Guards d_slabs and d_largeNodeValues in concurrent mode. */
+  std::mutex d_mutex;
+
+  /** Whether the allocator is locked on access. */
+  bool d_concurrent;
+
+  /** Number of slabs allocated. */
+  IntStat d_statSlabs;
+
+  /** Fraction of the slab memory holding live NodeValues. */
+  OccupancyStat d_statOccupancy;
+
+  /** Number of live NodeValues too large for the slabs. */
+  ReferenceStat<int64_t> d_statLargeNodeValues;
+};/* class NodeValueAllocator */
+
+}/* CVC4::expr namespace */
+}/* CVC4 namespace */
+
+#endif /* __CVC4__EXPR__NODE_VALUE_ALLOCATOR_H */
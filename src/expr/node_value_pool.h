@@ -0,0 +1,180 @@
+/*********************                                                        */
+/*! \file node_value_pool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief The hash-consing pool of NodeValues owned by a NodeManager
+ **
+ ** The hash-consing pool of NodeValues owned by a NodeManager.  The
+ ** pool is split into lock-striped shards so that several threads may
+ ** build terms against the same NodeManager.  In the default
+ ** (single-threaded) mode only one shard is used and no locks are
+ ** taken, so the common case costs the same as a plain hash set.
+ **/
+
+#include "cvc4_private.h"
+
+// circular dependency
+#include "expr/node_value.h"
+
+#ifndef __CVC4__EXPR__NODE_VALUE_POOL_H
+#define __CVC4__EXPR__NODE_VALUE_POOL_H
+
+#include <mutex>
+#include <vector>
+#include <unordered_set>
+
+namespace CVC4 {
+namespace expr {
+
+class NodeValuePool {
+ public:
+  /** Number of shards used when the pool is in concurrent mode. */
+  static const unsigned NUM_SHARDS = 64;
+
+  NodeValuePool() : d_concurrent(false), d_numShards(1) {}
+
+  /** Whether the pool is currently safe for concurrent access. */
+  bool isConcurrent() const { return d_concurrent; }
+
+  /**
+   * Switch between single-threaded and concurrent mode.  Entering
+   * concurrent mode redistributes all entries over NUM_SHARDS shards;
+   * leaving it folds them back into a single shard.  This must not be
+   * called while other threads are accessing the pool.
+   */
+  void setConcurrent(bool concurrent) {
+    if (concurrent == d_concurrent) {
+      return;
+    }
+    unsigned numShards = concurrent ? NUM_SHARDS : 1;
+    std::vector<NodeValue*> all;
+    all.reserve(size());
+    for (unsigned i = 0; i < d_numShards; ++i) {
+      all.insert(all.end(), d_shards[i].d_set.begin(), d_shards[i].d_set.end());
+      d_shards[i].d_set.clear();
+    }
+    d_numShards = numShards;
+    d_concurrent = concurrent;
+    for (NodeValue* nv : all) {
+      d_shards[shardIndex(nv)].d_set.insert(nv);
+    }
+  }
+
+  /**
+   * Look up a NodeValue that is equal (in the hash-consing sense) to
+   * nv.  Returns NULL if there is none.
+   */
+  NodeValue* lookup(NodeValue* nv) const {
+    const Shard& s = d_shards[shardIndex(nv)];
+    ShardLock lock(s, d_concurrent);
+    Set::const_iterator find = s.d_set.find(nv);
+    return find == s.d_set.end() ? NULL : *find;
+  }
+
+  /**
+   * Insert nv into the pool, unless an equal NodeValue is already
+   * present.  Returns the NodeValue that is in the pool afterwards;
+   * this differs from nv only if another thread inserted an equal
+   * NodeValue since nv was looked up, in which case the caller is
+   * responsible for disposing of nv.
+   */
+  NodeValue* insert(NodeValue* nv) {
+    Shard& s = d_shards[shardIndex(nv)];
+    ShardLock lock(s, d_concurrent);
+    return *s.d_set.insert(nv).first;
+  }
+
+  /** Remove nv from the pool. */
+  void erase(NodeValue* nv) {
+    Shard& s = d_shards[shardIndex(nv)];
+    ShardLock lock(s, d_concurrent);
+    s.d_set.erase(nv);
+  }
+
+  /** Whether nv (or a NodeValue equal to it) is in the pool. */
+  bool contains(NodeValue* nv) const { return lookup(nv) != NULL; }
+
+  /** The number of NodeValues in the pool. */
+  size_t size() const {
+    size_t sz = 0;
+    for (unsigned i = 0; i < d_numShards; ++i) {
+      ShardLock lock(d_shards[i], d_concurrent);
+      sz += d_shards[i].d_set.size();
+    }
+    return sz;
+  }
+
+  /**
+   * Apply f to every NodeValue in the pool.  f must not modify the
+   * pool.
+   */
+  template <class F>
+  void forEach(F f) const {
+    for (unsigned i = 0; i < d_numShards; ++i) {
+      ShardLock lock(d_shards[i], d_concurrent);
+      for (NodeValue* nv : d_shards[i].d_set) {
+        f(nv);
+      }
+    }
+  }
+
+ private:
+  typedef std::unordered_set<NodeValue*,
+                             NodeValuePoolHashFunction,
+                             NodeValuePoolEq> Set;
+
+  /** A shard of the pool, with the mutex guarding it. */
+  struct Shard {
+    mutable std::mutex d_mutex;
+    Set d_set;
+  };/* struct NodeValuePool::Shard */
+
+  /** Locks a shard, but only when the pool is in concurrent mode. */
+  class ShardLock {
+    std::mutex* d_mutex;
+   public:
+    ShardLock(const Shard& s, bool concurrent)
+        : d_mutex(concurrent ? &s.d_mutex : NULL) {
+      if (d_mutex != NULL) {
+        d_mutex->lock();
+      }
+    }
+    ~ShardLock() {
+      if (d_mutex != NULL) {
+        d_mutex->unlock();
+      }
+    }
+  };/* class NodeValuePool::ShardLock */
+
+  unsigned shardIndex(const NodeValue* nv) const {
+    if (__builtin_expect(d_numShards == 1, true)) {
+      return 0;
+    }
+    size_t h = NodeValuePoolHashFunction()(nv);
+    // mix the high bits in; the low bits of poolHash() are weak for
+    // nodes with few children
+    h ^= h >> 17;
+    h *= 0x9e3779b97f4a7c15ull;
+    return (h >> 32) % d_numShards;
+  }
+
+  /** Whether shards are locked on access. */
+  bool d_concurrent;
+
+  /** Number of shards in use (1 or NUM_SHARDS). */
+  unsigned d_numShards;
+
+  Shard d_shards[NUM_SHARDS];
+};/* class NodeValuePool */
+
+}/* CVC4::expr namespace */
+}/* CVC4 namespace */
+
+#endif /* __CVC4__EXPR__NODE_VALUE_POOL_H */
@@ -46,6 +46,35 @@ void PickleData::writeToStringStream(std::ostringstream& oss) const {
   }
 }
 
+void PickleData::writeBinary(std::ostream& out) const {
+  uint32_t n = d_blocks.size();
+  out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  BlockDeque::const_iterator i = d_blocks.begin(), end = d_blocks.end();
+  for(; i != end; ++i) {
+    uint64_t data = (*i).d_body.d_data;
+    out.write(reinterpret_cast<const char*>(&data), sizeof(data));
+  }
+}
+
+bool PickleData::readBinary(std::istream& in) {
+  d_blocks.clear();
+  uint32_t n;
+  if(!in.read(reinterpret_cast<char*>(&n), sizeof(n))) {
+    return false;
+  }
+  for(uint32_t i = 0; i < n; ++i) {
+    uint64_t data;
+    if(!in.read(reinterpret_cast<char*>(&data), sizeof(data))) {
+      d_blocks.clear();
+      return false;
+    }
+    Block b;
+    b.d_body.d_data = data;
+    d_blocks.push_back(b);
+  }
+  return true;
+}
+
 std::string PickleData::toString() const {
   std::ostringstream oss;
   oss.flags(std::ios::oct | std::ios::showbase);
@@ -111,6 +111,15 @@ public:
   }
 
   void writeToStringStream(std::ostringstream& oss) const;
+
+  /** Write the blocks to out, in host byte order, preceded by their count. */
+  void writeBinary(std::ostream& out) const;
+
+  /**
+   * Replace the blocks by those written with writeBinary().  Returns
+   * false if in ends early.
+   */
+  bool readBinary(std::istream& in);
 };/* class PickleData */
 
 }/* CVC4::expr::pickle namespace */
@@ -63,6 +63,7 @@ public:
   void toCaseConstant(TNode n);
   void toCaseOperator(TNode n);
   void toCaseString(Kind k, const std::string& s);
+  static uint64_t variableKey(TNode n);
 
   /* Helper functions for toPickle */
   Node fromCaseOperator(Kind k, uint32_t nchildren);
@@ -179,13 +180,18 @@ void PicklerPrivate::toCaseOperator(TNode n)
   d_current << mkOperatorHeader(k, n.getNumChildren());
 }
 
+uint64_t PicklerPrivate::variableKey(TNode n)
+{
+  Assert(metaKindOf(n.getKind()) == kind::metakind::VARIABLE);
+  return reinterpret_cast<uint64_t>(n.d_nv);
+}
+
 void PicklerPrivate::toCaseVariable(TNode n)
 {
   Kind k = n.getKind();
   Assert(metaKindOf(k) == kind::metakind::VARIABLE);
 
-  const NodeValue* nv = n.d_nv;
-  uint64_t asInt = reinterpret_cast<uint64_t>(nv);
+  uint64_t asInt = variableKey(n);
   uint64_t mapped = d_pickler.variableToMap(asInt);
 
   uint32_t firstHalf = mapped >> 32;
@@ -237,8 +243,25 @@ void PicklerPrivate::toCaseConstant(TNode n) {
     d_current << mkBlockBody(bvse.signExtendAmount);
     break;
   }
+  case kind::BITVECTOR_ZERO_EXTEND_OP:
+    d_current << mkConstantHeader(k, 1);
+    d_current << mkBlockBody(n.getConst<BitVectorZeroExtend>());
+    break;
+  case kind::BITVECTOR_REPEAT_OP:
+    d_current << mkConstantHeader(k, 1);
+    d_current << mkBlockBody(n.getConst<BitVectorRepeat>());
+    break;
+  case kind::BITVECTOR_ROTATE_LEFT_OP:
+    d_current << mkConstantHeader(k, 1);
+    d_current << mkBlockBody(n.getConst<BitVectorRotateLeft>());
+    break;
+  case kind::BITVECTOR_ROTATE_RIGHT_OP:
+    d_current << mkConstantHeader(k, 1);
+    d_current << mkBlockBody(n.getConst<BitVectorRotateRight>());
+    break;
   default:
-    Unhandled(k);
+    // not representable; callers treat this like an unmappable variable
+    throw PicklingException();
   }
 }
 
@@ -286,6 +309,10 @@ void Pickler::debugPickleTest(Expr e) {
   Assert(e == from);
 }
 
+uint64_t Pickler::variableKey(Expr var) {
+  return PicklerPrivate::variableKey(var.getTNode());
+}
+
 Expr Pickler::fromPickle(Pickle& p) {
   Assert(d_private->atDefaultState());
 
@@ -380,6 +407,17 @@ Node PicklerPrivate::fromCaseConstant(Kind k, uint32_t constblocks) {
     BitVectorSignExtend bvse(signExtendAmount.d_body.d_data);
     return d_nm->mkConst<BitVectorSignExtend>(bvse);
   }
+  case kind::BITVECTOR_ZERO_EXTEND_OP:
+    return d_nm->mkConst(
+        BitVectorZeroExtend(d_current.dequeue().d_body.d_data));
+  case kind::BITVECTOR_REPEAT_OP:
+    return d_nm->mkConst(BitVectorRepeat(d_current.dequeue().d_body.d_data));
+  case kind::BITVECTOR_ROTATE_LEFT_OP:
+    return d_nm->mkConst(
+        BitVectorRotateLeft(d_current.dequeue().d_body.d_data));
+  case kind::BITVECTOR_ROTATE_RIGHT_OP:
+    return d_nm->mkConst(
+        BitVectorRotateRight(d_current.dequeue().d_body.d_data));
   default:
     Unhandled(k);
   }
@@ -469,6 +507,14 @@ Pickle::~Pickle() {
   delete d_data;
 }
 
+void Pickle::writeTo(std::ostream& out) const {
+  d_data->writeBinary(out);
+}
+
+bool Pickle::readFrom(std::istream& in) {
+  return d_data->readBinary(in);
+}
+
 uint64_t MapPickler::variableFromMap(uint64_t x) const 
 {
   VarMap::const_iterator i = d_fromMap.find(x);
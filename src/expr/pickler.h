@@ -26,6 +26,7 @@
 #include "base/exception.h"
 
 #include <exception>
+#include <iosfwd>
 #include <stack>
 
 namespace CVC4 {
@@ -49,6 +50,16 @@ public:
   Pickle(const Pickle& p);
   ~Pickle();
   Pickle& operator=(const Pickle& other);
+
+  /** Write this pickle to out in a compact binary form. */
+  void writeTo(std::ostream& out) const;
+
+  /**
+   * Replace the contents of this pickle by one written with writeTo().
+   * Returns false (leaving the pickle empty) if in doesn't hold a
+   * complete pickle.
+   */
+  bool readFrom(std::istream& in);
 };/* class Pickle */
 
 class CVC4_PUBLIC PicklingException : public Exception {
@@ -91,6 +102,12 @@ public:
 
   static void debugPickleTest(Expr e);
 
+  /**
+   * The value variableToMap() is passed for the variable var, for
+   * building the variable maps of a MapPickler.
+   */
+  static uint64_t variableKey(Expr var);
+
 };/* class Pickler */
 
 class CVC4_PUBLIC MapPickler : public Pickler {
@@ -21,14 +21,13 @@
 #  include <unistd.h>
 #endif /* HAVE_UNISTD_H */
 
-#include <boost/exception_ptr.hpp>
 #include <boost/lexical_cast.hpp>
-#include <boost/thread.hpp>
-#include <boost/thread/condition.hpp>
+#include <functional>
 #include <string>
 
 #include "cvc4autoconfig.h"
 #include "expr/pickler.h"
+#include "main/cube_and_conquer.h"
 #include "main/main.h"
 #include "main/portfolio.h"
 #include "options/options.h"
@@ -50,11 +49,14 @@ CommandExecutorPortfolio::CommandExecutorPortfolio(
       d_threadOptions(tOpts),
       d_vmaps(),
       d_lastWinner(0),
+      d_lemmaHub(NULL),
       d_channelsOut(),
       d_channelsIn(),
       d_ostringstreams(),
       d_statLastWinner("portfolio::lastWinner"),
-      d_statWaitTime("portfolio::waitTime")
+      d_statWaitTime("portfolio::waitTime"),
+      d_statCubes("portfolio::cubes", 0),
+      d_statCubeSplits("portfolio::cubeSplits", 0)
 {
   assert(d_threadOptions.size() == d_numThreads);
 
@@ -62,6 +64,24 @@ CommandExecutorPortfolio::CommandExecutorPortfolio(
   d_stats.registerStat(&d_statLastWinner);
 
   d_stats.registerStat(&d_statWaitTime);
+  d_stats.registerStat(&d_statCubes);
+  d_stats.registerStat(&d_statCubeSplits);
+
+  for(unsigned i = 0; i < d_numThreads; ++i) {
+    string prefix = "portfolio::thread#"
+        + boost::lexical_cast<string>(d_threadOptions[i].getThreadId());
+    d_statLemmasExported.push_back(
+        new IntStat(prefix + "::lemmasExported", 0));
+    d_statLemmasDropped.push_back(new IntStat(prefix + "::lemmasDropped", 0));
+    d_statLemmasImported.push_back(
+        new IntStat(prefix + "::lemmasImported", 0));
+    d_statLemmasDuplicate.push_back(
+        new IntStat(prefix + "::lemmasDuplicate", 0));
+    d_stats.registerStat(d_statLemmasExported[i]);
+    d_stats.registerStat(d_statLemmasDropped[i]);
+    d_stats.registerStat(d_statLemmasImported[i]);
+    d_stats.registerStat(d_statLemmasDuplicate[i]);
+  }
 
   /* Duplication, individualization */
   d_exprMgrs.push_back(&d_exprMgr);
@@ -98,6 +118,18 @@ CommandExecutorPortfolio::~CommandExecutorPortfolio()
 
   d_stats.unregisterStat(&d_statLastWinner);
   d_stats.unregisterStat(&d_statWaitTime);
+  d_stats.unregisterStat(&d_statCubes);
+  d_stats.unregisterStat(&d_statCubeSplits);
+  for(unsigned i = 0; i < d_numThreads; ++i) {
+    d_stats.unregisterStat(d_statLemmasExported[i]);
+    d_stats.unregisterStat(d_statLemmasDropped[i]);
+    d_stats.unregisterStat(d_statLemmasImported[i]);
+    d_stats.unregisterStat(d_statLemmasDuplicate[i]);
+    delete d_statLemmasExported[i];
+    delete d_statLemmasDropped[i];
+    delete d_statLemmasImported[i];
+    delete d_statLemmasDuplicate[i];
+  }
 }
 
 void CommandExecutorPortfolio::lemmaSharingInit()
@@ -110,28 +142,22 @@ void CommandExecutorPortfolio::lemmaSharingInit()
     // Disable sharing
     d_threadOptions[0].setSharingFilterByLength(0);
   } else {
-    // Setup sharing channels
-    const unsigned int sharingChannelSize = 1000000;
-
-    for(unsigned i = 0; i < d_numThreads; ++i){
-      d_channelsOut.push_back(
-          new SynchronizedSharedChannel<ChannelFormat>(sharingChannelSize));
-      d_channelsIn.push_back(
-          new SynchronizedSharedChannel<ChannelFormat>(sharingChannelSize));
-    }
+    // Setup sharing: each thread publishes its lemmas in the hub, and
+    // reads those of the others from it
+    d_lemmaHub = new LemmaHub(d_numThreads, d_options.getSharingFilterDuplicates());
 
     /* Lemma I/O channels */
     for(unsigned i = 0; i < d_numThreads; ++i) {
       int thread_id = d_threadOptions[i].getThreadId();
       string tag = "thread #" + boost::lexical_cast<string>(thread_id);
-      LemmaOutputChannel* outputChannel =
-          new PortfolioLemmaOutputChannel(tag, d_channelsOut[i], d_exprMgrs[i],
-                                          d_vmaps[i]->d_from, d_vmaps[i]->d_to);
-      LemmaInputChannel* inputChannel =
-          new PortfolioLemmaInputChannel(tag, d_channelsIn[i], d_exprMgrs[i],
-                                         d_vmaps[i]->d_from, d_vmaps[i]->d_to);
-      d_smts[i]->channels()->setLemmaInputChannel(inputChannel);
-      d_smts[i]->channels()->setLemmaOutputChannel(outputChannel);
+      d_channelsOut.push_back(
+          new PortfolioLemmaOutputChannel(tag, d_lemmaHub, i, d_exprMgrs[i],
+                                          d_vmaps[i]->d_from, d_vmaps[i]->d_to));
+      d_channelsIn.push_back(
+          new PortfolioLemmaInputChannel(tag, d_lemmaHub, i, d_exprMgrs[i],
+                                         d_vmaps[i]->d_from, d_vmaps[i]->d_to));
+      d_smts[i]->channels()->setLemmaInputChannel(d_channelsIn[i]);
+      d_smts[i]->channels()->setLemmaOutputChannel(d_channelsOut[i]);
     }
 
     /* Output to string stream  */
@@ -158,15 +184,19 @@ void CommandExecutorPortfolio::lemmaSharingCleanup()
   assert(d_channelsIn.size() == d_numThreads);
   assert(d_channelsOut.size() == d_numThreads);
   for(unsigned i = 0; i < d_numThreads; ++i) {
-    delete d_channelsIn[i];
-    delete d_channelsOut[i];
-    delete d_smts[i]->channels()->getLemmaInputChannel();
+    *d_statLemmasExported[i] += d_channelsOut[i]->d_exported;
+    *d_statLemmasDropped[i] += d_channelsOut[i]->d_dropped;
+    *d_statLemmasImported[i] += d_channelsIn[i]->d_imported;
+    *d_statLemmasDuplicate[i] += d_lemmaHub->getDuplicates(i);
     d_smts[i]->channels()->setLemmaInputChannel(NULL);
-    delete d_smts[i]->channels()->getLemmaOutputChannel();
     d_smts[i]->channels()->setLemmaOutputChannel(NULL);
+    delete d_channelsIn[i];
+    delete d_channelsOut[i];
   }
   d_channelsIn.clear();
   d_channelsOut.clear();
+  delete d_lemmaHub;
+  d_lemmaHub = NULL;
 
   // sstreams cleanup (if used)
   if(d_ostringstreams.size() != 0) {
@@ -223,6 +253,7 @@ bool CommandExecutorPortfolio::doCommandSingleton(Command* cmd)
                                  << "d_seq is " << d_seq << std::endl;
 
   if(mode == 0) {
+    recordAssertions(cmd);
     d_seq->addCommand(cmd->clone());
     Command* cmdExported =
       d_lastWinner == 0 ?
@@ -233,6 +264,14 @@ bool CommandExecutorPortfolio::doCommandSingleton(Command* cmd)
     if(d_lastWinner != 0) delete cmdExported;
     return ret;
   } else if(mode == 1) {               // portfolio
+    CheckSatCommand* cs = dynamic_cast<CheckSatCommand*>(cmd);
+    if(d_options.getCubeAndConquer() && d_numThreads > 1 &&
+       cs != NULL && cs->getExpr().isNull() &&
+       !d_options.getProof() && !d_options.getDumpUnsatCores()) {
+      // the cubes don't give a proof or unsat core of the whole query
+      return cubeAndConquer(cmd);
+    }
+
     d_seq->addCommand(cmd->clone());
 
     // We currently don't support changing number of threads for each
@@ -293,13 +332,13 @@ bool CommandExecutorPortfolio::doCommandSingleton(Command* cmd)
     lemmaSharingInit();
 
     /* Portfolio */
-    boost::function<bool()>* fns = new boost::function<bool()>[d_numThreads];
+    std::function<bool()>* fns = new std::function<bool()>[d_numThreads];
     for(unsigned i = 0; i < d_numThreads; ++i) {
       std::ostream* current_out_or_null = d_options.getVerbosity() >= -1 ?
           d_threadOptions[i].getOut() : NULL;
 
-      fns[i] = boost::bind(smtEngineInvoke, d_smts[i], seqs[i],
-                           current_out_or_null);
+      fns[i] = std::bind(smtEngineInvoke, d_smts[i], seqs[i],
+                         current_out_or_null);
     }
 
     assert(d_channelsIn.size() == d_numThreads
@@ -309,19 +348,26 @@ bool CommandExecutorPortfolio::doCommandSingleton(Command* cmd)
     assert(d_smts.size() == d_numThreads);
     assert( !d_statWaitTime.running() );
 
-    boost::function<void()>
-      smFn = d_numThreads <= 1 ? boost::function<void()>() :
-             boost::bind(sharingManager<ChannelFormat>,
-                         d_numThreads,
-                         &d_channelsOut[0],
-                         &d_channelsIn[0],
-                         &d_smts[0]);
+    // once there is a winner, interrupt the others
+    std::vector<SmtEngine*>& smts = d_smts;
+    std::function<void()> stopFn = [&smts]() {
+      for(unsigned t = 0; t < smts.size(); ++t) {
+        Trace("interrupt") << "Interrupting thread #" << t << std::endl;
+        try {
+          smts[t]->interrupt();
+        } catch(ModalException& e) {
+          // It's fine, the thread is probably not there.
+          Trace("interrupt") << "Could not interrupt thread #" << t
+                             << std::endl;
+        }
+      }
+    };
 
     size_t threadStackSize = d_options.getThreadStackSize();
     threadStackSize *= 1024 * 1024;
 
     pair<int, bool> portfolioReturn =
-        runPortfolio(d_numThreads, smFn, fns, threadStackSize,
+        runPortfolio(d_numThreads, stopFn, fns, threadStackSize,
                      d_options.getWaitToJoin(), d_statWaitTime);
 
 #ifdef CVC4_STATISTICS_ON
@@ -367,43 +413,7 @@ bool CommandExecutorPortfolio::doCommandSingleton(Command* cmd)
 
     delete[] fns;
 
-    bool status = portfolioReturn.second;
-
-    // dump the model/proof/unsat core if option is set
-    if(status) {
-      if( d_options.getProduceModels() &&
-          d_options.getDumpModels() &&
-          ( d_result.asSatisfiabilityResult() == Result::SAT ||
-            (d_result.isUnknown() &&
-             d_result.whyUnknown() == Result::INCOMPLETE) ) )
-      {
-        Command* gm = new GetModelCommand();
-        status = doCommandSingleton(gm);
-      } else if( d_options.getProof() &&
-                 d_options.getDumpProofs() &&
-                 d_result.asSatisfiabilityResult() == Result::UNSAT ) {
-        Command* gp = new GetProofCommand();
-        status = doCommandSingleton(gp);
-      } else if( d_options.getDumpInstantiations() &&
-                 ( ( d_options.getInstFormatMode() != INST_FORMAT_MODE_SZS &&
-                   ( d_result.asSatisfiabilityResult() == Result::SAT ||
-                     (d_result.isUnknown() &&
-                      d_result.whyUnknown() == Result::INCOMPLETE) ) ) ||
-                   d_result.asSatisfiabilityResult() == Result::UNSAT ) ) {
-        Command* gi = new GetInstantiationsCommand();
-        status = doCommandSingleton(gi);
-      } else if( d_options.getDumpSynth() &&
-                 d_result.asSatisfiabilityResult() == Result::UNSAT ){
-        Command* gi = new GetSynthSolutionCommand();
-        status = doCommandSingleton(gi);
-      } else if( d_options.getDumpUnsatCores() &&
-                 d_result.asSatisfiabilityResult() == Result::UNSAT ) {
-        Command* guc = new GetUnsatCoreCommand();
-        status = doCommandSingleton(guc);
-      }
-    }
-
-    return status;
+    return dumpQueryResult(portfolioReturn.second);
   } else if(mode == 2) {
     Command* cmdExported = d_lastWinner == 0 ?
         cmd : cmd->exportTo(d_exprMgrs[d_lastWinner], *(d_vmaps[d_lastWinner]));
@@ -423,6 +433,119 @@ bool CommandExecutorPortfolio::doCommandSingleton(Command* cmd)
 
 }/* CommandExecutorPortfolio::doCommandSingleton() */
 
+void CommandExecutorPortfolio::recordAssertions(Command* cmd)
+{
+  if(!d_options.getCubeAndConquer()) {
+    return;
+  }
+  AssertCommand* assertion = dynamic_cast<AssertCommand*>(cmd);
+  if(assertion != NULL) {
+    d_assertions.push_back(assertion->getExpr());
+  } else if(dynamic_cast<PushCommand*>(cmd) != NULL) {
+    d_assertionLevels.push_back(d_assertions.size());
+  } else if(dynamic_cast<PopCommand*>(cmd) != NULL &&
+            !d_assertionLevels.empty()) {
+    d_assertions.resize(d_assertionLevels.back());
+    d_assertionLevels.pop_back();
+  } else if(dynamic_cast<ResetAssertionsCommand*>(cmd) != NULL) {
+    d_assertions.clear();
+    d_assertionLevels.clear();
+  }
+}/* CommandExecutorPortfolio::recordAssertions() */
+
+bool CommandExecutorPortfolio::cubeAndConquer(Command* cmd)
+{
+  /* Bring the other threads up to date with the last winner */
+  for(unsigned i = 0; i < d_numThreads; ++i) {
+    if(int(i) == d_lastWinner) {
+      continue;
+    }
+    Command* seq;
+    try {
+      seq = i == 0 ? d_seq : d_seq->exportTo(d_exprMgrs[i], *(d_vmaps[i]));
+    } catch(ExportUnsupportedException& e) {
+      if(d_options.getFallbackSequential()) {
+        Notice() << "Unsupported theory encountered."
+                 << "Switching to sequential mode.";
+        return CommandExecutor::doCommandSingleton(cmd);
+      }
+      else
+        throw Exception("Certain theories (e.g., datatypes) are (currently)"
+                        " unsupported in portfolio\n mode. Please see option"
+                        " --fallback-sequential to make this a soft error.");
+    }
+    smtEngineInvoke(d_smts[i], seq, NULL);
+    if(i != 0) {
+      delete seq;
+    }
+  }
+  delete d_seq;
+  d_seq = new CommandSequence();
+
+  // a few more atoms than needed for the initial cubes, to split the cubes
+  // that turn out to be hard
+  unsigned depth = d_options.getCubeDepth();
+  std::vector<Expr> atoms;
+  selectSplitAtoms(d_assertions, depth + 16, atoms);
+
+  CubeAndConquer cubes(d_smts, d_exprMgrs, d_vmaps, atoms, depth,
+                       d_options.getCubeTimeLimit());
+  size_t threadStackSize = d_options.getThreadStackSize();
+  threadStackSize *= 1024 * 1024;
+  int winner = -1;
+  d_result = cubes.run(winner, threadStackSize);
+  d_statCubes += cubes.getNumCubes();
+  d_statCubeSplits += cubes.getNumSplits();
+  if(winner >= 0) {
+    // the winner has a model of the assertions
+    d_lastWinner = winner;
+  }
+
+  if(d_options.getVerbosity() >= -1) {
+    *d_options.getOut() << d_result << endl;
+  }
+  return dumpQueryResult(true);
+}/* CommandExecutorPortfolio::cubeAndConquer() */
+
+bool CommandExecutorPortfolio::dumpQueryResult(bool status)
+{
+  // dump the model/proof/unsat core if option is set
+  if(status) {
+    if( d_options.getProduceModels() &&
+        d_options.getDumpModels() &&
+        ( d_result.asSatisfiabilityResult() == Result::SAT ||
+          (d_result.isUnknown() &&
+           d_result.whyUnknown() == Result::INCOMPLETE) ) )
+    {
+      Command* gm = new GetModelCommand();
+      status = doCommandSingleton(gm);
+    } else if( d_options.getProof() &&
+               d_options.getDumpProofs() &&
+               d_result.asSatisfiabilityResult() == Result::UNSAT ) {
+      Command* gp = new GetProofCommand();
+      status = doCommandSingleton(gp);
+    } else if( d_options.getDumpInstantiations() &&
+               ( ( d_options.getInstFormatMode() != INST_FORMAT_MODE_SZS &&
+                 ( d_result.asSatisfiabilityResult() == Result::SAT ||
+                   (d_result.isUnknown() &&
+                    d_result.whyUnknown() == Result::INCOMPLETE) ) ) ||
+                 d_result.asSatisfiabilityResult() == Result::UNSAT ) ) {
+      Command* gi = new GetInstantiationsCommand();
+      status = doCommandSingleton(gi);
+    } else if( d_options.getDumpSynth() &&
+               d_result.asSatisfiabilityResult() == Result::UNSAT ){
+      Command* gi = new GetSynthSolutionCommand();
+      status = doCommandSingleton(gi);
+    } else if( d_options.getDumpUnsatCores() &&
+               d_result.asSatisfiabilityResult() == Result::UNSAT ) {
+      Command* guc = new GetUnsatCoreCommand();
+      status = doCommandSingleton(guc);
+    }
+  }
+
+  return status;
+}/* CommandExecutorPortfolio::dumpQueryResult() */
+
 void CommandExecutorPortfolio::flushStatistics(std::ostream& out) const {
   assert(d_numThreads == d_exprMgrs.size() &&
          d_exprMgrs.size() == d_smts.size());
@@ -45,14 +45,28 @@ class CommandExecutorPortfolio : public CommandExecutor {
 
   int d_lastWinner;
 
+  // The assertions, for picking the atoms to split on in
+  // --cube-and-conquer mode, and their number at each push
+  std::vector<Expr> d_assertions;
+  std::vector<size_t> d_assertionLevels;
+
   // These shall be reset for each check-sat
-  std::vector< SharedChannel<ChannelFormat>* > d_channelsOut;
-  std::vector< SharedChannel<ChannelFormat>* > d_channelsIn;
+  LemmaHub* d_lemmaHub;
+  std::vector<PortfolioLemmaOutputChannel*> d_channelsOut;
+  std::vector<PortfolioLemmaInputChannel*> d_channelsIn;
   std::vector<std::ostringstream*> d_ostringstreams;
 
   // Stats
   ReferenceStat<int> d_statLastWinner;
   TimerStat d_statWaitTime;
+  IntStat d_statCubes;
+  IntStat d_statCubeSplits;
+  // Lemmas exported, dropped as too large, imported and skipped as
+  // duplicates, per thread
+  std::vector<IntStat*> d_statLemmasExported;
+  std::vector<IntStat*> d_statLemmasDropped;
+  std::vector<IntStat*> d_statLemmasImported;
+  std::vector<IntStat*> d_statLemmasDuplicate;
 
 public:
   CommandExecutorPortfolio(ExprManager &exprMgr,
@@ -71,6 +85,12 @@ private:
   CommandExecutorPortfolio();
   void lemmaSharingInit();
   void lemmaSharingCleanup();
+  /** Keep track of the assertions for --cube-and-conquer. */
+  void recordAssertions(Command* cmd);
+  /** Solve a check-sat command by cube-and-conquer. */
+  bool cubeAndConquer(Command* cmd);
+  /** Dump the model, proof etc. after a query, if the options say so. */
+  bool dumpQueryResult(bool status);
 };/* class CommandExecutorPortfolio */
 
 }/* CVC4::main namespace */
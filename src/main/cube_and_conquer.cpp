@@ -0,0 +1,367 @@
+/*********************                                                        */
+/*! \file cube_and_conquer.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Cube-and-conquer solving of check-sat queries in portfolio mode.
+ **
+ ** Cube-and-conquer solving of check-sat queries in portfolio mode.
+ **/
+
+#include "main/cube_and_conquer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+#include "base/output.h"
+#include "expr/kind.h"
+#include "expr/type.h"
+#include "main/portfolio.h"
+
+namespace CVC4 {
+namespace main {
+
+namespace {
+
+/** A subformula to score, with its polarity (0 for both) and weight. */
+struct ScoreItem
+{
+  Expr d_expr;
+  int d_pol;
+  double d_weight;
+  ScoreItem(Expr e, int pol, double weight)
+      : d_expr(e), d_pol(pol), d_weight(weight)
+  {
+  }
+};
+
+bool isBooleanEqual(const Expr& e)
+{
+  return e.getKind() == kind::EQUAL && e[0].getType().isBoolean();
+}
+
+}  // namespace
+
+void selectSplitAtoms(const std::vector<Expr>& assertions,
+                      unsigned n,
+                      std::vector<Expr>& atoms)
+{
+  std::unordered_map<Expr, double, ExprHashFunction> scores;
+  // the atoms in order of their first occurrence, to break ties
+  std::vector<Expr> order;
+  // each subformula is scored once per polarity, so that shared
+  // subformulas do not blow up the traversal
+  std::set<std::pair<Expr, int> > visited;
+  std::vector<ScoreItem> toVisit;
+  for (const Expr& a : assertions)
+  {
+    toVisit.push_back(ScoreItem(a, 1, 1.0));
+  }
+  std::reverse(toVisit.begin(), toVisit.end());
+  while (!toVisit.empty())
+  {
+    ScoreItem item = toVisit.back();
+    toVisit.pop_back();
+    const Expr& e = item.d_expr;
+    int pol = item.d_pol;
+    double w = item.d_weight;
+    if (e.isConst() || !visited.insert(std::make_pair(e, pol)).second)
+    {
+      continue;
+    }
+    unsigned nc = e.getNumChildren();
+    std::vector<ScoreItem> children;
+    switch (e.getKind())
+    {
+      case kind::NOT: children.push_back(ScoreItem(e[0], -pol, w)); break;
+      case kind::AND:
+        // all conjuncts are needed to make it true, any one to make it false
+        for (unsigned i = 0; i < nc; ++i)
+        {
+          children.push_back(ScoreItem(e[i], pol, pol > 0 ? w : w / nc));
+        }
+        break;
+      case kind::OR:
+        for (unsigned i = 0; i < nc; ++i)
+        {
+          children.push_back(ScoreItem(e[i], pol, pol < 0 ? w : w / nc));
+        }
+        break;
+      case kind::IMPLIES:
+        children.push_back(ScoreItem(e[0], -pol, pol < 0 ? w : w / 2));
+        children.push_back(ScoreItem(e[1], pol, pol < 0 ? w : w / 2));
+        break;
+      case kind::XOR:
+        children.push_back(ScoreItem(e[0], 0, w));
+        children.push_back(ScoreItem(e[1], 0, w));
+        break;
+      case kind::ITE:
+        // only Boolean subformulas are visited, a term ite is part of an atom
+        children.push_back(ScoreItem(e[0], 0, w));
+        children.push_back(ScoreItem(e[1], pol, w / 2));
+        children.push_back(ScoreItem(e[2], pol, w / 2));
+        break;
+      case kind::FORALL:
+      case kind::EXISTS:
+        // don't split on formulas under binders
+        break;
+      default:
+        if (isBooleanEqual(e))
+        {
+          children.push_back(ScoreItem(e[0], 0, w));
+          children.push_back(ScoreItem(e[1], 0, w));
+        }
+        else
+        {
+          std::unordered_map<Expr, double, ExprHashFunction>::iterator it =
+              scores.find(e);
+          if (it == scores.end())
+          {
+            scores[e] = w;
+            order.push_back(e);
+          }
+          else
+          {
+            it->second += w;
+          }
+        }
+    }
+    toVisit.insert(toVisit.end(), children.rbegin(), children.rend());
+  }
+
+  std::stable_sort(order.begin(),
+                   order.end(),
+                   [&scores](const Expr& a, const Expr& b) {
+                     return scores[a] > scores[b];
+                   });
+  atoms.assign(order.begin(), order.begin() + std::min<size_t>(n, order.size()));
+  Debug("portfolio::cube") << "split atoms: " << atoms.size() << " of "
+                           << order.size() << std::endl;
+}
+
+CubeAndConquer::CubeAndConquer(
+    const std::vector<SmtEngine*>& smts,
+    const std::vector<ExprManager*>& exprMgrs,
+    const std::vector<ExprManagerMapCollection*>& vmaps,
+    const std::vector<Expr>& atoms,
+    unsigned depth,
+    unsigned timeLimit)
+    : d_smts(smts),
+      d_literals(smts.size()),
+      d_numAtoms(atoms.size()),
+      d_timeLimit(timeLimit),
+      d_perCallLimits(smts.size()),
+      d_inProgress(0),
+      d_stopped(false),
+      d_winner(-1),
+      d_cubes(0),
+      d_splits(0)
+{
+  for (unsigned t = 0; t < smts.size(); ++t)
+  {
+    d_perCallLimits[t] =
+        smts[t]->getOption("tlimit-per").getIntegerValue().getUnsignedLong();
+    for (const Expr& atom : atoms)
+    {
+      Expr a = t == 0 ? atom : atom.exportTo(exprMgrs[t], *vmaps[t]);
+      d_literals[t].push_back(a);
+      d_literals[t].push_back(a.notExpr());
+    }
+  }
+
+  // all combinations of the polarities of the first depth atoms
+  depth = std::min(depth, d_numAtoms);
+  d_open.push_back(Cube());
+  for (unsigned i = 0; i < depth; ++i)
+  {
+    for (size_t j = 0, size = d_open.size(); j < size; ++j)
+    {
+      Cube cube = d_open.front();
+      d_open.pop_front();
+      cube.push_back(true);
+      d_open.push_back(cube);
+      cube.back() = false;
+      d_open.push_back(cube);
+    }
+  }
+}
+
+Result CubeAndConquer::run(int& winner, size_t stackSize)
+{
+  // Thread 0 gets a worker thread too, so that all of them have the
+  // requested stack size.
+  std::vector<std::unique_ptr<WorkerThread> > threads;
+  for (unsigned t = 0; t < d_smts.size(); ++t)
+  {
+    threads.push_back(std::unique_ptr<WorkerThread>(new WorkerThread(
+        std::bind(&CubeAndConquer::work, this, t), stackSize)));
+  }
+  for (std::unique_ptr<WorkerThread>& t : threads)
+  {
+    t->join();
+  }
+  for (unsigned t = 0; t < d_smts.size(); ++t)
+  {
+    d_smts[t]->setTimeLimit(d_perCallLimits[t], false);
+  }
+  if (d_exception)
+  {
+    std::rethrow_exception(d_exception);
+  }
+  winner = d_winner;
+  if (!d_result.isNull())
+  {
+    return d_result;
+  }
+  if (!d_unknown.isNull())
+  {
+    return d_unknown;
+  }
+  return Result(Result::UNSAT);
+}
+
+void CubeAndConquer::work(unsigned thread)
+{
+  SmtEngine* smt = d_smts[thread];
+  const std::vector<Expr>& literals = d_literals[thread];
+  Cube cube;
+  std::vector<Expr> assumptions;
+  try
+  {
+    while (takeCube(cube))
+    {
+      assumptions.clear();
+      for (unsigned i = 0; i < cube.size(); ++i)
+      {
+        assumptions.push_back(literals[2 * i + (cube[i] ? 0 : 1)]);
+      }
+      // A cube that can't be split further is solved under the user's
+      // own per-call limit only, as is every cube if that limit is
+      // tighter than ours.
+      bool last = cube.size() == d_numAtoms;
+      unsigned long userLimit = d_perCallLimits[thread];
+      bool cubeLimit =
+          !last && (userLimit == 0 || d_timeLimit < userLimit);
+      smt->setTimeLimit(cubeLimit ? d_timeLimit : userLimit, false);
+      std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+      Result r = smt->checkSat(assumptions);
+      unsigned long elapsed =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count();
+      ++d_cubes;
+      Debug("portfolio::cube") << "thread " << thread << ": cube of size "
+                               << cube.size() << " is " << r << " after "
+                               << elapsed << "ms" << std::endl;
+
+      std::vector<Cube> subcubes;
+      if (r.isSat() == Result::SAT)
+      {
+        stop(thread, r);
+      }
+      else if (r.isSat() == Result::UNSAT)
+      {
+        // closed
+      }
+      else if (cubeLimit && r.whyUnknown() == Result::TIMEOUT
+               && elapsed >= d_timeLimit)
+      {
+        // A timeout that comes earlier is the user's cumulative limit
+        // running out, which splitting the cube won't help with.
+        ++d_splits;
+        cube.push_back(true);
+        subcubes.push_back(cube);
+        cube.back() = false;
+        subcubes.push_back(cube);
+      }
+      else
+      {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        // An interrupted cube is only expected once the search is over;
+        // otherwise it is still open, and the result can't be unsat.
+        if (d_unknown.isNull()
+            && !(d_stopped && r.whyUnknown() == Result::INTERRUPTED))
+        {
+          d_unknown = r;
+        }
+      }
+      finishCube(subcubes);
+    }
+  }
+  catch (...)
+  {
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+      if (!d_exception)
+      {
+        d_exception = std::current_exception();
+      }
+    }
+    stop(thread, Result());
+  }
+}
+
+bool CubeAndConquer::takeCube(Cube& cube)
+{
+  std::unique_lock<std::mutex> lock(d_mutex);
+  d_changed.wait(lock, [this]() {
+    return d_stopped || !d_open.empty() || d_inProgress == 0;
+  });
+  if (d_stopped || d_open.empty())
+  {
+    return false;
+  }
+  cube = d_open.front();
+  d_open.pop_front();
+  ++d_inProgress;
+  return true;
+}
+
+void CubeAndConquer::finishCube(const std::vector<Cube>& subcubes)
+{
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    --d_inProgress;
+    d_open.insert(d_open.end(), subcubes.begin(), subcubes.end());
+  }
+  d_changed.notify_all();
+}
+
+void CubeAndConquer::stop(unsigned thread, const Result& result)
+{
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (d_stopped)
+    {
+      return;
+    }
+    d_stopped = true;
+    d_result = result;
+    d_winner = result.isNull() ? -1 : int(thread);
+  }
+  d_changed.notify_all();
+  // A thread that takes its cube just before the search stops is not
+  // interrupted, and only returns when its cube is solved or times out.
+  for (unsigned t = 0; t < d_smts.size(); ++t)
+  {
+    if (t != thread)
+    {
+      d_smts[t]->interrupt();
+    }
+  }
+}
+
+}/* CVC4::main namespace */
+}/* CVC4 namespace */
@@ -0,0 +1,137 @@
+/*********************                                                        */
+/*! \file cube_and_conquer.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Cube-and-conquer solving of check-sat queries in portfolio mode.
+ **
+ ** The query is split on a few atoms of the assertions into cubes, i.e.
+ ** conjunctions of literals, which the portfolio threads solve as
+ ** assumptions.  A cube that is not solved within a time limit is split
+ ** further on the next atom.
+ **/
+
+#ifndef __CVC4__MAIN__CUBE_AND_CONQUER_H
+#define __CVC4__MAIN__CUBE_AND_CONQUER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include "expr/expr.h"
+#include "expr/expr_manager.h"
+#include "smt/smt_engine.h"
+#include "util/result.h"
+
+namespace CVC4 {
+namespace main {
+
+/**
+ * Select at most n atoms of the given assertions to split on, in order of
+ * decreasing score.  Like the justification heuristic, the score of an
+ * atom follows the structure of the assertions: an atom that every
+ * assertion needs to justify counts fully, one that is one of k ways of
+ * justifying a disjunction (or one of the branches of an ite) counts 1/k.
+ */
+void selectSplitAtoms(const std::vector<Expr>& assertions,
+                      unsigned n,
+                      std::vector<Expr>& atoms);
+
+class CubeAndConquer
+{
+ public:
+  /**
+   * A cube is given by the polarities of the first size() split atoms,
+   * true standing for the atom and false for its negation.
+   */
+  typedef std::vector<bool> Cube;
+
+  /**
+   * Prepare to solve with the given SmtEngines, one per thread, which
+   * have received the same assertions.  The atoms are from the expression
+   * manager of the first thread and are exported to the others with the
+   * given variable maps.
+   */
+  CubeAndConquer(const std::vector<SmtEngine*>& smts,
+                 const std::vector<ExprManager*>& exprMgrs,
+                 const std::vector<ExprManagerMapCollection*>& vmaps,
+                 const std::vector<Expr>& atoms,
+                 unsigned depth,
+                 unsigned timeLimit);
+
+  /**
+   * Solve all cubes, one worker thread per SmtEngine, with the given stack
+   * size in bytes unless it is 0 (as in runPortfolio()).  The result is
+   * sat as soon as some cube is sat, in which case winner is set to the
+   * thread that solved it, and unsat if all cubes are unsat.  Rethrows the
+   * first exception of a thread.
+   */
+  Result run(int& winner, size_t stackSize);
+
+  /** The number of cubes solved, or split, in run(). */
+  unsigned getNumCubes() const { return d_cubes; }
+  unsigned getNumSplits() const { return d_splits; }
+
+ private:
+  /** Solve cubes on the given thread until there are none left. */
+  void work(unsigned thread);
+
+  /**
+   * Take the next open cube, waiting while the cubes of the other threads
+   * may still be split.  Returns false if there are none left, or if the
+   * search is over.
+   */
+  bool takeCube(Cube& cube);
+
+  /** The cube taken by the thread is done, and split into the subcubes. */
+  void finishCube(const std::vector<Cube>& subcubes);
+
+  /** End the search with the given result, interrupting the other threads. */
+  void stop(unsigned thread, const Result& result);
+
+  const std::vector<SmtEngine*>& d_smts;
+
+  /**
+   * The literals of the split atoms in the expression manager of each
+   * thread (first index), atom i at 2i and its negation at 2i + 1.
+   */
+  std::vector<std::vector<Expr> > d_literals;
+
+  unsigned d_numAtoms;
+
+  unsigned d_timeLimit;
+
+  /** The per-call time limit of each thread, restored after run(). */
+  std::vector<unsigned long> d_perCallLimits;
+
+  std::mutex d_mutex;
+  std::condition_variable d_changed;
+  std::deque<Cube> d_open;
+  /** The number of cubes taken but not finished. */
+  unsigned d_inProgress;
+  bool d_stopped;
+
+  /** The final result, if stopped, and the thread that found it. */
+  Result d_result;
+  int d_winner;
+  /** The reason of the first cube that remained unknown, if any. */
+  Result d_unknown;
+  std::exception_ptr d_exception;
+
+  std::atomic<unsigned> d_cubes;
+  std::atomic<unsigned> d_splits;
+};/* class CubeAndConquer */
+
+}/* CVC4::main namespace */
+}/* CVC4 namespace */
+
+#endif /* __CVC4__MAIN__CUBE_AND_CONQUER_H */
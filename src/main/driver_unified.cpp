@@ -213,7 +213,8 @@ int runCvc4(int argc, char* argv[], Options& opts) {
   // incremental?
   if(opts.wasSetByUserIncrementalSolving() &&
      opts.getIncrementalSolving() &&
-     (! opts.getIncrementalParallel()) ) {
+     (! opts.getIncrementalParallel()) &&
+     (! opts.getCubeAndConquer()) ) {
     Notice() << "Notice: In --incremental mode, using the sequential solver"
              << " unless forced by...\n"
              << "Notice: ...the experimental --incremental-parallel option.\n";
@@ -13,13 +13,25 @@
  ** (potentially cooperative) race
  **/
 
-#include <boost/function.hpp>
-#include <boost/thread.hpp>
-#include <boost/bind.hpp>
-#include <boost/thread/condition.hpp>
-#include <boost/exception_ptr.hpp>
+#if HAVE_UNISTD_H
+#  include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(_POSIX_THREADS)
+#  include <limits.h>
+#endif /* _POSIX_THREADS */
 
 #include "base/output.h"
+#include "cvc4autoconfig.h"
+#include "main/portfolio.h"
 #include "options/options.h"
 #include "smt/smt_engine.h"
 #include "util/result.h"
@@ -27,123 +39,159 @@
 
 namespace CVC4 {
 
-/** Mutex to make sure at most one thread is winner */
-boost::mutex mutex_done;
+namespace {
 
-/** Mutex / condition variable to notify main when winner data written */
-boost::mutex mutex_main_wait;
-boost::condition_variable condition_var_main_wait;
+/**
+ * The state of a race, shared with its threads, as the threads may
+ * outlive runPortfolio() if they are not joined.
+ */
+template<typename S>
+struct Race {
+  std::mutex d_mutex;
+  /** Notified when the winner is known */
+  std::condition_variable d_done;
+  int d_winner;
+  std::vector<S> d_returnValues;
 
-bool global_flag_done;
-int global_winner;
+  Race(int numThreads) : d_winner(-1), d_returnValues(numThreads) {}
+};/* struct Race */
 
 template<typename S>
-void runThread(int thread_id, boost::function<S()> threadFn, S& returnValue)
+void runThread(std::shared_ptr< Race<S> > race, int thread_id,
+               std::function<S()> threadFn)
 {
   /* Uncomment line to delay first thread, useful to unearth errors/debug */
   // if(thread_id == 0) { sleep(1); }
-  returnValue = threadFn();
-
-  if( mutex_done.try_lock() ) {
-    if(global_flag_done == false) 
-    {
-      {
-        boost::lock_guard<boost::mutex> lock(mutex_main_wait);
-        global_winner = thread_id;
-        global_flag_done = true;
-      }
-      condition_var_main_wait.notify_all(); // we want main thread to quit
+  S returnValue = threadFn();
+
+  {
+    std::lock_guard<std::mutex> lock(race->d_mutex);
+    race->d_returnValues[thread_id] = returnValue;
+    if(race->d_winner >= 0) {
+      return;
     }
-    mutex_done.unlock();
+    race->d_winner = thread_id;
+  }
+  race->d_done.notify_all(); // we want main thread to quit
+}
+
+}/* anonymous namespace */
+
+WorkerThread::WorkerThread(std::function<void()> fn, size_t stackSize)
+#if defined(_POSIX_THREADS)
+  : d_posix(stackSize > 0)
+#endif /* _POSIX_THREADS */
+{
+  if(stackSize == 0) {
+    d_thread = std::thread(fn);
+    return;
+  }
+#if defined(_POSIX_THREADS)
+  pthread_attr_t attrs;
+  pthread_attr_init(&attrs);
+  if(pthread_attr_setstacksize(&attrs, stackSize) != 0) {
+    pthread_attr_destroy(&attrs);
+    std::stringstream ss;
+    ss << "cannot use a stack size of " << stackSize
+       << " bytes for worker threads";
+#if defined(PTHREAD_STACK_MIN)
+    ss << "; the minimum is " << PTHREAD_STACK_MIN << " bytes";
+#endif /* PTHREAD_STACK_MIN */
+    throw OptionException(ss.str());
   }
+  std::function<void()>* arg = new std::function<void()>(fn);
+  int error = pthread_create(&d_pthread, &attrs, start, arg);
+  pthread_attr_destroy(&attrs);
+  if(error != 0) {
+    delete arg;
+    throw Exception("could not create a worker thread with the given stack"
+                    " size");
+  }
+#else /* _POSIX_THREADS */
+  throw OptionException("cannot specify a stack size for worker threads on"
+                        " this platform");
+#endif /* _POSIX_THREADS */
+}
+
+void WorkerThread::join() {
+#if defined(_POSIX_THREADS)
+  if(d_posix) {
+    pthread_join(d_pthread, NULL);
+    return;
+  }
+#endif /* _POSIX_THREADS */
+  d_thread.join();
+}
+
+void WorkerThread::detach() {
+#if defined(_POSIX_THREADS)
+  if(d_posix) {
+    pthread_detach(d_pthread);
+    return;
+  }
+#endif /* _POSIX_THREADS */
+  d_thread.detach();
+}
+
+#if defined(_POSIX_THREADS)
+void* WorkerThread::start(void* arg) {
+  std::unique_ptr< std::function<void()> > fn(
+      static_cast<std::function<void()>*>(arg));
+  (*fn)();
+  return NULL;
 }
+#endif /* _POSIX_THREADS */
 
-template<typename T, typename S>
+template<typename S>
 std::pair<int, S> runPortfolio(int numThreads,
-                               boost::function<T()> driverFn,
-                               boost::function<S()> threadFns[],
+                               std::function<void()> stopFn,
+                               std::function<S()> threadFns[],
                                size_t stackSize,
                                bool optionWaitToJoin,
                                TimerStat& statWaitTime) {
-  boost::thread thread_driver;
-  boost::thread* threads = new boost::thread[numThreads];
-  S* threads_returnValue = new S[numThreads];
-
-  global_flag_done = false;
-  global_winner = -1;
+  std::shared_ptr< Race<S> > race(new Race<S>(numThreads));
+  std::vector< std::unique_ptr<WorkerThread> > threads;
 
   for(int t = 0; t < numThreads; ++t) {
-
-#if BOOST_HAS_THREAD_ATTR
-    boost::thread::attributes attrs;
-
-    if(stackSize > 0) {
-      attrs.set_stack_size(stackSize);
-    }
-
-    threads[t] =
-      boost::thread(attrs, boost::bind(runThread<S>, t, threadFns[t],
-                                       boost::ref(threads_returnValue[t]) ) );
-#else /* BOOST_HAS_THREAD_ATTR */
+    threads.push_back(std::unique_ptr<WorkerThread>(new WorkerThread(
+        std::bind(runThread<S>, race, t, threadFns[t]), stackSize)));
     if(stackSize > 0) {
-      throw OptionException("cannot specify a stack size for worker threads; requires CVC4 to be built with Boost thread library >= 1.50.0");
+      Chat() << "Created worker thread " << t << " with stack size "
+             << stackSize << std::endl;
     }
-
-    threads[t] =
-      boost::thread(boost::bind(runThread<S>, t, threadFns[t],
-                                boost::ref(threads_returnValue[t]) ) );
-
-#endif /* BOOST_HAS_THREAD_ATTR */
-
-#if defined(BOOST_THREAD_PLATFORM_PTHREAD)
-    if(Chat.isOn()) {
-      void *stackaddr;
-      size_t stacksize;
-      pthread_attr_t attr;
-      pthread_getattr_np(threads[t].native_handle(), &attr);
-      pthread_attr_getstack(&attr, &stackaddr, &stacksize);
-      Chat() << "Created worker thread " << t << " with stack size " << stacksize << std::endl;
-    }
-#endif
   }
 
-  if(not driverFn.empty())
-    thread_driver = boost::thread(driverFn);
-
-  boost::unique_lock<boost::mutex> lock(mutex_main_wait);
-  while(global_flag_done == false) {
-    condition_var_main_wait.wait(lock);
+  int winner;
+  {
+    std::unique_lock<std::mutex> lock(race->d_mutex);
+    race->d_done.wait(lock, [&race]() { return race->d_winner >= 0; });
+    winner = race->d_winner;
   }
 
   statWaitTime.start();
 
-  if(not driverFn.empty()) {
-    thread_driver.interrupt();
-    thread_driver.join();
-  }
+  stopFn();
 
   for(int t = 0; t < numThreads; ++t) {
     if(optionWaitToJoin) {
-      threads[t].join();
+      threads[t]->join();
+    } else {
+      threads[t]->detach();
     }
   }
 
-  std::pair<int, S> retval(global_winner, threads_returnValue[global_winner]);
-
-  delete[] threads;
-  delete[] threads_returnValue;
-
-  return retval;
+  std::lock_guard<std::mutex> lock(race->d_mutex);
+  return std::pair<int, S>(winner, race->d_returnValues[winner]);
 }
 
 // instantiation
 template
 std::pair<int, bool>
-runPortfolio<void, bool>(int,
-                         boost::function<void()>, 
-                         boost::function<bool()>*,
-                         size_t,
-                         bool,
-                         TimerStat&);
+runPortfolio<bool>(int,
+                   std::function<void()>,
+                   std::function<bool()>*,
+                   size_t,
+                   bool,
+                   TimerStat&);
 
 }/* CVC4 namespace */
@@ -16,9 +16,20 @@
 #ifndef __CVC4__PORTFOLIO_H
 #define __CVC4__PORTFOLIO_H
 
-#include <boost/function.hpp>
+#include "cvc4autoconfig.h"
+
+#if HAVE_UNISTD_H
+#  include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+
+#include <functional>
+#include <thread>
 #include <utility>
 
+#if defined(_POSIX_THREADS)
+#  include <pthread.h>
+#endif /* _POSIX_THREADS */
+
 #include "options/options.h"
 #include "smt/command.h"
 #include "smt/smt_engine.h"
@@ -26,15 +37,45 @@
 
 namespace CVC4 {
 
-template<typename T, typename S>
-std::pair<int, S> runPortfolio(int numThreads, 
-                               boost::function<T()> driverFn,
-                               boost::function<S()> threadFns[],
+/**
+ * A worker thread.  std::thread can't be given a stack size, so threads
+ * with a stack size are POSIX threads.
+ */
+class WorkerThread {
+public:
+  /**
+   * Start a thread that runs fn.  If stackSize is not 0, it is the stack
+   * size of the thread in bytes.  Throws an OptionException if the
+   * platform does not accept it.
+   */
+  WorkerThread(std::function<void()> fn, size_t stackSize);
+
+  void join();
+  void detach();
+
+private:
+  std::thread d_thread;
+#if defined(_POSIX_THREADS)
+  bool d_posix;
+  pthread_t d_pthread;
+
+  static void* start(void* arg);
+#endif /* _POSIX_THREADS */
+};/* class WorkerThread */
+
+/**
+ * Run the given functions in parallel, one thread each, until the first
+ * one returns, and then call stopFn to stop the others.  Returns the index
+ * and the return value of the first one.  If stackSize is not 0, it is the
+ * stack size of the threads in bytes.
+ */
+template<typename S>
+std::pair<int, S> runPortfolio(int numThreads,
+                               std::function<void()> stopFn,
+                               std::function<S()> threadFns[],
                                size_t stackSize,
                                bool optionWaitToJoin,
                                TimerStat& statWaitTime);
-// as we have defined things, S=void would give compile errors
-// do we want to fix this? yes, no, maybe?
 
 }/* CVC4 namespace */
 
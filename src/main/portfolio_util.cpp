@@ -118,12 +118,15 @@ void PortfolioLemmaOutputChannel::notifyNewLemma(Expr lemma) {
   if(int(lemma.getNumChildren()) > Options::currentGetSharingFilterByLength()) {
     return;
   }
-  ++cnt;
   Trace("sharing") << d_tag << ": " << lemma << std::endl;
   expr::pickle::Pickle pkl;
   try {
     d_pickler.toPickle(lemma, pkl);
-    d_sharedChannel->push(pkl);
+    if(!d_hub->publish(d_thread, pkl)) {
+      ++d_dropped;
+      return;
+    }
+    ++d_exported;
     if(Trace.isOn("showSharing") && Options::currentGetThreadId() == 0) {
       (*(Options::currentGetOut()))
           << "thread #0: notifyNewLemma: " << lemma << std::endl;
@@ -135,23 +138,35 @@ void PortfolioLemmaOutputChannel::notifyNewLemma(Expr lemma) {
 
 
 PortfolioLemmaInputChannel::PortfolioLemmaInputChannel(std::string tag,
-    SharedChannel<ChannelFormat>* c,
+    LemmaHub* hub,
+    unsigned thread,
     ExprManager* em,
     VarMap& to,
     VarMap& from)
-    : d_tag(tag), d_sharedChannel(c), d_pickler(em, to, from)
+    : d_tag(tag),
+      d_hub(hub),
+      d_thread(thread),
+      d_pickler(em, to, from),
+      d_pending(false),
+      d_imported(0)
 {}
 
 bool PortfolioLemmaInputChannel::hasNewLemma(){
   Debug("lemmaInputChannel") << d_tag << ": " << "hasNewLemma" << std::endl;
-  return !d_sharedChannel->empty();
+  if(!d_pending) {
+    d_pending = d_hub->fetch(d_thread, d_next);
+  }
+  return d_pending;
 }
 
 Expr PortfolioLemmaInputChannel::getNewLemma() {
   Debug("lemmaInputChannel") << d_tag << ": " << "getNewLemma" << std::endl;
-  expr::pickle::Pickle pkl = d_sharedChannel->pop();
+  hasNewLemma();
+  assert(d_pending);
+  d_pending = false;
+  ++d_imported;
 
-  Expr e = d_pickler.fromPickle(pkl);
+  Expr e = d_pickler.fromPickle(d_next);
   if(Trace.isOn("showSharing") && Options::currentGetThreadId() == 0) {
     (*Options::currentGetOut()) << "thread #0: getNewLemma: " << e << std::endl;
   }
@@ -15,36 +15,42 @@
 #ifndef __CVC4__PORTFOLIO_UTIL_H
 #define __CVC4__PORTFOLIO_UTIL_H
 
-#include <queue>
+#include <stdint.h>
+#include <string>
 
 #include "base/output.h"
 #include "expr/pickler.h"
 #include "smt/smt_engine.h"
+#include "smt_util/lemma_hub.h"
 #include "smt_util/lemma_input_channel.h"
 #include "smt_util/lemma_output_channel.h"
-#include "util/channel.h"
 
 namespace CVC4 {
 
-typedef expr::pickle::Pickle ChannelFormat;
-
 class PortfolioLemmaOutputChannel : public LemmaOutputChannel {
 private:
   std::string d_tag;
-  SharedChannel<ChannelFormat>* d_sharedChannel;
+  LemmaHub* d_hub;
+  unsigned d_thread;
   expr::pickle::MapPickler d_pickler;
 
 public:
-  int cnt;
+  /** The number of lemmas shared, and of those too large to share. */
+  uint64_t d_exported;
+  uint64_t d_dropped;
+
   PortfolioLemmaOutputChannel(std::string tag,
-                              SharedChannel<ChannelFormat> *c,
+                              LemmaHub* hub,
+                              unsigned thread,
                               ExprManager* em,
                               VarMap& to,
                               VarMap& from) :
     d_tag(tag),
-    d_sharedChannel(c),
+    d_hub(hub),
+    d_thread(thread),
     d_pickler(em, to, from),
-    cnt(0)
+    d_exported(0),
+    d_dropped(0)
   {}
 
   ~PortfolioLemmaOutputChannel() {}
@@ -55,15 +61,23 @@ public:
 class PortfolioLemmaInputChannel : public LemmaInputChannel {
 private:
   std::string d_tag;
-  SharedChannel<ChannelFormat>* d_sharedChannel;
+  LemmaHub* d_hub;
+  unsigned d_thread;
   expr::pickle::MapPickler d_pickler;
+  /** The lemma fetched by hasNewLemma(), if d_pending. */
+  expr::pickle::Pickle d_next;
+  bool d_pending;
 
 public:
+  /** The number of lemmas imported. */
+  uint64_t d_imported;
+
   PortfolioLemmaInputChannel(std::string tag,
-                             SharedChannel<ChannelFormat>* c,
+                             LemmaHub* hub,
+                             unsigned thread,
                              ExprManager* em,
                              VarMap& to,
-                               VarMap& from);
+                             VarMap& from);
 
   ~PortfolioLemmaInputChannel() {}
 
@@ -93,87 +107,6 @@ class OptionsList {
 
 void parseThreadSpecificOptions(OptionsList& list, const Options& opts);
 
-template<typename T>
-void sharingManager(unsigned numThreads,
-                    SharedChannel<T> *channelsOut[], // out and in with respect
-                    SharedChannel<T> *channelsIn[],
-                    SmtEngine *smts[])  // to smt engines
-{
-  Trace("sharing") << "sharing: thread started " << std::endl;
-  std::vector <int> cnt(numThreads); // Debug("sharing")
-
-  std::vector< std::queue<T> > queues;
-  for(unsigned i = 0; i < numThreads; ++i){
-    queues.push_back(std::queue<T>());
-  }
-
-  const unsigned int sharingBroadcastInterval = 1;
-
-  boost::mutex mutex_activity;
-
-  /* Disable interruption, so that we can check manually */
-  boost::this_thread::disable_interruption di;
-
-  while(not boost::this_thread::interruption_requested()) {
-
-    boost::this_thread::sleep
-      (boost::posix_time::milliseconds(sharingBroadcastInterval));
-
-    for(unsigned t = 0; t < numThreads; ++t) {
-
-      /* No activity on this channel */
-      if(channelsOut[t]->empty()) continue;
-
-      /* Alert if channel full, so that we increase sharingChannelSize
-         or decrease sharingBroadcastInterval */
-      assert(not channelsOut[t]->full());
-
-      T data = channelsOut[t]->pop();
-
-      if(Trace.isOn("sharing")) {
-        ++cnt[t];
-        Trace("sharing") << "sharing: Got data. Thread #" << t
-                         << ". Chunk " << cnt[t] << std::endl;
-      }
-
-      for(unsigned u = 0; u < numThreads; ++u) {
-        if(u != t){
-          Trace("sharing") << "sharing: adding to queue " << u << std::endl;
-          queues[u].push(data);
-        }
-      }/* end of inner for: broadcast activity */
-
-    } /* end of outer for: look for activity */
-
-    for(unsigned t = 0; t < numThreads; ++t){
-      /* Alert if channel full, so that we increase sharingChannelSize
-         or decrease sharingBroadcastInterval */
-      assert(not channelsIn[t]->full());
-
-      while(!queues[t].empty() && !channelsIn[t]->full()){
-        Trace("sharing") << "sharing: pushing on channel " << t << std::endl;
-        T data = queues[t].front();
-        channelsIn[t]->push(data);
-        queues[t].pop();
-      }
-    }
-  } /* end of infinite while */
-
-  Trace("interrupt")
-    << "sharing thread interrupted, interrupting all smtEngines" << std::endl;
-
-  for(unsigned t = 0; t < numThreads; ++t) {
-    Trace("interrupt") << "Interrupting thread #" << t << std::endl;
-    try{
-      smts[t]->interrupt();
-    }catch(ModalException &e){
-      // It's fine, the thread is probably not there.
-      Trace("interrupt") << "Could not interrupt thread #" << t << std::endl;
-    }
-  }
-
-  Trace("sharing") << "sharing: Interrupted, exiting." << std::endl;
-}/* sharingManager() */
 
 }/* CVC4 namespace */
 
@@ -198,6 +198,7 @@ public:
   InstFormatMode getInstFormatMode() const;
   OutputLanguage getOutputLanguage() const;
   bool getCheckProofs() const;
+  bool getCubeAndConquer() const;
   bool getContinuedExecution() const;
   bool getDumpInstantiations() const;
   bool getDumpModels() const;
@@ -220,6 +221,7 @@ public:
   bool getProof() const;
   bool getSegvSpin() const;
   bool getSemanticChecks() const;
+  bool getSharingFilterDuplicates() const;
   bool getStatistics() const;
   bool getStatsEveryQuery() const;
   bool getStatsHideZeros() const;
@@ -238,6 +240,8 @@ public:
   std::ostream* getOutConst() const; // TODO: Remove this.
   std::string getBinaryName() const;
   std::string getReplayInputFilename() const;
+  unsigned getCubeDepth() const;
+  unsigned getCubeTimeLimit() const;
   unsigned getParseStep() const;
   unsigned getThreadStackSize() const;
   unsigned getThreads() const;
@@ -1062,6 +1062,20 @@ void OptionsHandler::satSolverEnabledBuild(std::string option,
 #endif
 }
 
+void OptionsHandler::cadicalEnabledBuild(std::string option, bool value)
+{
+#ifndef CVC4_USE_CADICAL_PROPAGATOR
+  if (value)
+  {
+    std::stringstream ss;
+    ss << "option `" << option
+       << "' requires a CVC4 to be built with CaDiCaL 1.9 or later "
+          "(with the external propagator interface)";
+    throw OptionException(ss.str());
+  }
+#endif
+}
+
 const std::string OptionsHandler::s_bvSatSolverHelp = "\
 Sat solvers currently supported by the --bv-sat-solver option:\n\
 \n\
@@ -1684,6 +1698,8 @@ void OptionsHandler::showConfiguration(std::string option) {
   print_config_cond("cln", Configuration::isBuiltWithCln());
   print_config_cond("glpk", Configuration::isBuiltWithGlpk());
   print_config_cond("cadical", Configuration::isBuiltWithCadical());
+  print_config_cond("cadical-propagator",
+                    Configuration::isBuiltWithCadicalPropagator());
   print_config_cond("cryptominisat", Configuration::isBuiltWithCryptominisat());
   print_config_cond("gmp", Configuration::isBuiltWithGmp());
   print_config_cond("lfsc", Configuration::isBuiltWithLfsc());
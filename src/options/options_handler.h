@@ -128,6 +128,7 @@ public:
   void abcEnabledBuild(std::string option, std::string value);
   void satSolverEnabledBuild(std::string option, bool value);
   void satSolverEnabledBuild(std::string option, std::string optarg);
+  void cadicalEnabledBuild(std::string option, bool value);
 
   theory::bv::BitblastMode stringToBitblastMode(std::string option,
                                                 std::string optarg);
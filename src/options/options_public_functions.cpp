@@ -54,6 +54,10 @@ bool Options::getCheckProofs() const{
   return (*this)[options::checkProofs];
 }
 
+bool Options::getCubeAndConquer() const{
+  return (*this)[options::cubeAndConquer];
+}
+
 bool Options::getContinuedExecution() const{
   return (*this)[options::continuedExecution];
 }
@@ -142,6 +146,10 @@ bool Options::getSemanticChecks() const{
   return (*this)[options::semanticChecks];
 }
 
+bool Options::getSharingFilterDuplicates() const{
+  return (*this)[options::sharingFilterDuplicates];
+}
+
 bool Options::getStatistics() const{
   return (*this)[options::statistics];
 }
@@ -215,6 +223,14 @@ std::string Options::getReplayInputFilename() const{
   return (*this)[options::replayInputFilename];
 }
 
+unsigned Options::getCubeDepth() const{
+  return (*this)[options::cubeDepth];
+}
+
+unsigned Options::getCubeTimeLimit() const{
+  return (*this)[options::cubeTimeLimit];
+}
+
 unsigned Options::getParseStep() const{
   return (*this)[options::parseStep];
 }
@@ -0,0 +1,336 @@
+/*********************                                                        */
+/*! \file bvminisat_portfolio.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Portfolio of bvminisat solvers for the eager bit-blaster.
+ **
+ ** Portfolio of bvminisat solvers for the eager bit-blaster.
+ **/
+
+#include "prop/bvminisat/bvminisat_portfolio.h"
+
+#include <thread>
+
+#include "expr/node_manager.h"
+#include "options/bv_options.h"
+#include "prop/bvminisat/bvminisat.h"
+#include "util/resource_manager.h"
+
+namespace CVC4 {
+namespace prop {
+
+namespace {
+
+/**
+ * Diversify the search of the worker with the given index; worker 0
+ * keeps the default configuration.
+ */
+void configure(BVMinisat::SimpSolver& solver, unsigned index)
+{
+  if (index == 0)
+  {
+    return;
+  }
+  solver.random_seed = 91648253 + 7919 * index;
+  solver.rnd_init_act = true;
+  solver.rnd_pol = index % 2 == 0;
+  solver.random_var_freq = 0.005 * (index % 4);
+  solver.luby_restart = index % 3 != 1;
+  solver.restart_first = 100 << (index % 3);
+  solver.var_decay = 0.95 - 0.01 * (index % 5);
+}
+
+}  // namespace
+
+BVMinisatPortfolio::Worker::Worker(BVMinisatPortfolio& portfolio,
+                                   unsigned index,
+                                   context::Context* context)
+    : d_portfolio(portfolio),
+      d_index(index),
+      d_solver(new BVMinisat::SimpSolver(context)),
+      d_result(SAT_VALUE_UNKNOWN),
+      d_conflicts(0),
+      d_exported(0),
+      d_imported(0)
+{
+  configure(*d_solver, index);
+  d_solver->setNotify(this);
+}
+
+void BVMinisatPortfolio::Worker::spendResource(unsigned amount)
+{
+  // the resource manager is not thread-safe, the calling thread accounts
+  // for the portfolio
+  if (d_index == 0)
+  {
+    NodeManager::currentResourceManager()->spendResource(amount);
+  }
+}
+
+void BVMinisatPortfolio::Worker::exportClause(
+    const BVMinisat::vec<BVMinisat::Lit>& learnt)
+{
+  if (unsigned(learnt.size()) > d_portfolio.d_exchange->getMaxSize())
+  {
+    return;
+  }
+  d_words.clear();
+  for (int i = 0; i < learnt.size(); ++i)
+  {
+    d_words.push_back(BVMinisat::toInt(learnt[i]));
+  }
+  d_portfolio.d_exchange->publish(d_index, d_words.data(), d_words.size());
+  ++d_exported;
+}
+
+void BVMinisatPortfolio::Worker::importClauses()
+{
+  while (d_solver->okay() && d_portfolio.d_exchange->fetch(d_index, d_words))
+  {
+    d_clause.clear();
+    bool eliminated = false;
+    for (uint32_t word : d_words)
+    {
+      BVMinisat::Lit lit = BVMinisat::toLit(word);
+      // the learnt clauses of the other workers are implied by the
+      // original clauses, but may mention variables eliminated here
+      eliminated = eliminated || d_solver->isEliminated(BVMinisat::var(lit));
+      d_clause.push(lit);
+    }
+    if (!eliminated)
+    {
+      // as a learnt clause, so that reduceDB() can drop it again
+      d_solver->addLearntClause(d_clause);
+      ++d_imported;
+    }
+  }
+}
+
+void BVMinisatPortfolio::Worker::run()
+{
+  uint64_t conflictsBefore = d_solver->conflicts;
+  try
+  {
+    d_result = BVMinisatSatSolver::toSatLiteralValue(d_solver->solveLimited());
+  }
+  catch (...)
+  {
+    // e.g. out of resources: stop the others, solve() passes it on once
+    // they are done
+    d_exception = std::current_exception();
+    d_result = SAT_VALUE_UNKNOWN;
+    d_portfolio.interrupt();
+  }
+  d_conflicts = d_solver->conflicts - conflictsBefore;
+  int none = -1;
+  if (d_result != SAT_VALUE_UNKNOWN
+      && d_portfolio.d_winner.compare_exchange_strong(none, d_index))
+  {
+    for (const std::unique_ptr<Worker>& w : d_portfolio.d_workers)
+    {
+      if (w.get() != this)
+      {
+        w->d_solver->interrupt();
+      }
+    }
+  }
+}
+
+BVMinisatPortfolio::BVMinisatPortfolio(StatisticsRegistry* registry,
+                                       context::Context* mainSatContext,
+                                       unsigned threads,
+                                       const std::string& name)
+    : d_exchange(new ClauseExchange(threads, options::bvEagerShareSize())),
+      d_winner(-1),
+      d_statistics(registry, name)
+{
+  Assert(threads > 0);
+  for (unsigned i = 0; i < threads; ++i)
+  {
+    d_workers.push_back(
+        std::unique_ptr<Worker>(new Worker(*this, i, mainSatContext)));
+    if (threads > 1)
+    {
+      d_workers.back()->d_solver->setClauseShare(d_workers.back().get());
+    }
+  }
+}
+
+BVMinisatPortfolio::~BVMinisatPortfolio() {}
+
+BVMinisatPortfolio::Worker& BVMinisatPortfolio::answering() const
+{
+  int winner = d_winner.load();
+  return *d_workers[winner < 0 ? 0 : winner];
+}
+
+ClauseId BVMinisatPortfolio::addClause(SatClause& clause, bool removable)
+{
+  Debug("sat::minisat") << "Add clause " << clause << "\n";
+  BVMinisat::vec<BVMinisat::Lit> minisat_clause;
+  BVMinisatSatSolver::toMinisatClause(clause, minisat_clause);
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    ClauseId id;
+    w->d_solver->addClause(minisat_clause, id);
+  }
+  return ClauseIdError;
+}
+
+SatVariable BVMinisatPortfolio::newVar(bool isTheoryAtom,
+                                       bool preRegister,
+                                       bool canErase)
+{
+  SatVariable var = 0;
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    var = w->d_solver->newVar(true, true, !canErase);
+  }
+  return var;
+}
+
+void BVMinisatPortfolio::interrupt()
+{
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    w->d_solver->interrupt();
+  }
+}
+
+SatValue BVMinisatPortfolio::solve()
+{
+  long unsigned int resource = 0;
+  return solve(resource);
+}
+
+SatValue BVMinisatPortfolio::solve(long unsigned int& resource)
+{
+  Trace("limit") << "BVMinisatPortfolio::solve(): have limit of " << resource
+                 << " conflicts" << std::endl;
+  TimerStat::CodeTimer solveTimer(d_statistics.d_statSolveTime);
+  ++d_statistics.d_statCallsToSolve;
+  d_winner = -1;
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    w->d_exported = 0;
+    w->d_imported = 0;
+    w->d_exception = nullptr;
+    // each worker gets the whole budget, they run side by side
+    if (resource == 0)
+    {
+      w->d_solver->budgetOff();
+    }
+    else
+    {
+      w->d_solver->setConfBudget(resource);
+    }
+  }
+
+  // the workers read the options and the BV solver's debug flags
+  NodeManager* nm = NodeManager::currentNM();
+  std::vector<std::thread> threads;
+  for (unsigned i = 1; i < d_workers.size(); ++i)
+  {
+    Worker* w = d_workers[i].get();
+    threads.push_back(std::thread([nm, w]() {
+      NodeManagerScope nms(nm);
+      w->run();
+    }));
+  }
+  d_workers[0]->run();
+  for (std::thread& t : threads)
+  {
+    t.join();
+  }
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    w->d_solver->clearInterrupt();
+    d_statistics.d_statExported += w->d_exported;
+    d_statistics.d_statImported += w->d_imported;
+  }
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    if (w->d_exception)
+    {
+      std::rethrow_exception(w->d_exception);
+    }
+  }
+
+  // the conflicts of the solver whose answer is returned
+  resource = answering().d_conflicts;
+  Trace("limit") << "BVMinisatPortfolio::solve(): it took " << resource
+                 << " conflicts" << std::endl;
+  int winner = d_winner.load();
+  if (winner < 0)
+  {
+    return SAT_VALUE_UNKNOWN;
+  }
+  d_statistics.d_statWinners << uint32_t(winner);
+  Debug("sat::minisat") << "portfolio solved by worker " << winner << "\n";
+  return d_workers[winner]->d_result;
+}
+
+bool BVMinisatPortfolio::ok() const
+{
+  for (const std::unique_ptr<Worker>& w : d_workers)
+  {
+    if (!w->d_solver->okay())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+SatValue BVMinisatPortfolio::value(SatLiteral l)
+{
+  return BVMinisatSatSolver::toSatLiteralValue(
+      answering().d_solver->value(BVMinisatSatSolver::toMinisatLit(l)));
+}
+
+SatValue BVMinisatPortfolio::modelValue(SatLiteral l)
+{
+  return BVMinisatSatSolver::toSatLiteralValue(
+      answering().d_solver->modelValue(BVMinisatSatSolver::toMinisatLit(l)));
+}
+
+unsigned BVMinisatPortfolio::getAssertionLevel() const
+{
+  // we have no user context implemented so far
+  return 0;
+}
+
+BVMinisatPortfolio::Statistics::Statistics(StatisticsRegistry* registry,
+                                           const std::string& prefix)
+    : d_registry(registry),
+      d_statCallsToSolve(prefix + "::bvminisat_portfolio::calls_to_solve", 0),
+      d_statExported(prefix + "::bvminisat_portfolio::exported_clauses", 0),
+      d_statImported(prefix + "::bvminisat_portfolio::imported_clauses", 0),
+      d_statWinners(prefix + "::bvminisat_portfolio::winners"),
+      d_statSolveTime(prefix + "::bvminisat_portfolio::solve_time")
+{
+  d_registry->registerStat(&d_statCallsToSolve);
+  d_registry->registerStat(&d_statExported);
+  d_registry->registerStat(&d_statImported);
+  d_registry->registerStat(&d_statWinners);
+  d_registry->registerStat(&d_statSolveTime);
+}
+
+BVMinisatPortfolio::Statistics::~Statistics()
+{
+  d_registry->unregisterStat(&d_statCallsToSolve);
+  d_registry->unregisterStat(&d_statExported);
+  d_registry->unregisterStat(&d_statImported);
+  d_registry->unregisterStat(&d_statWinners);
+  d_registry->unregisterStat(&d_statSolveTime);
+}
+
+}  // namespace prop
+}  // namespace CVC4
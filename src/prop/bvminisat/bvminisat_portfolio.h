@@ -0,0 +1,147 @@
+/*********************                                                        */
+/*! \file bvminisat_portfolio.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Portfolio of bvminisat solvers for the eager bit-blaster.
+ **
+ ** Runs differently configured copies of bvminisat on the same clauses
+ ** in parallel, exchanging their short learnt clauses, and returns the
+ ** answer of the first one to finish.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__PROP__BVMINISAT_PORTFOLIO_H
+#define __CVC4__PROP__BVMINISAT_PORTFOLIO_H
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include "context/context.h"
+#include "prop/bvminisat/simp/SimpSolver.h"
+#include "prop/clause_exchange.h"
+#include "prop/sat_solver.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace prop {
+
+class BVMinisatPortfolio : public SatSolver
+{
+ private:
+  /** One of the solvers, with its own thread during solve(). */
+  class Worker : public BVMinisat::Notify, public BVMinisat::ClauseShare
+  {
+   public:
+    Worker(BVMinisatPortfolio& portfolio,
+           unsigned index,
+           context::Context* context);
+
+    bool notify(BVMinisat::Lit lit) override { return true; }
+    void notify(BVMinisat::vec<BVMinisat::Lit>& learnt) override {}
+    void spendResource(unsigned amount) override;
+    void safePoint(unsigned amount) override {}
+
+    void exportClause(const BVMinisat::vec<BVMinisat::Lit>& learnt) override;
+    void importClauses() override;
+
+    /**
+     * Solve within the conflict budget, and interrupt the other workers
+     * if this one finishes first or throws.
+     */
+    void run();
+
+    BVMinisatPortfolio& d_portfolio;
+    unsigned d_index;
+    std::unique_ptr<BVMinisat::SimpSolver> d_solver;
+    SatValue d_result;
+    /** The conflicts of the last solve(). */
+    uint64_t d_conflicts;
+    /** What the last solve() threw, rethrown by the calling thread. */
+    std::exception_ptr d_exception;
+    /** The number of clauses exported and imported in the last solve(). */
+    uint64_t d_exported;
+    uint64_t d_imported;
+    /** Buffer for exchanged clauses. */
+    std::vector<uint32_t> d_words;
+    BVMinisat::vec<BVMinisat::Lit> d_clause;
+  };/* class BVMinisatPortfolio::Worker */
+
+  std::vector<std::unique_ptr<Worker>> d_workers;
+
+  std::unique_ptr<ClauseExchange> d_exchange;
+
+  /** The index of the worker that finished the last solve(), or -1. */
+  std::atomic<int> d_winner;
+
+  /** The worker answering value() queries. */
+  Worker& answering() const;
+
+ public:
+  BVMinisatPortfolio(StatisticsRegistry* registry,
+                     context::Context* mainSatContext,
+                     unsigned threads,
+                     const std::string& name = "");
+  ~BVMinisatPortfolio() override;
+
+  ClauseId addClause(SatClause& clause, bool removable) override;
+
+  ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override
+  {
+    Unreachable("Minisat does not support native XOR reasoning");
+  }
+
+  SatVariable newVar(bool isTheoryAtom = false,
+                     bool preRegister = false,
+                     bool canErase = true) override;
+
+  SatVariable trueVar() override { return d_workers[0]->d_solver->trueVar(); }
+  SatVariable falseVar() override
+  {
+    return d_workers[0]->d_solver->falseVar();
+  }
+
+  void interrupt() override;
+
+  SatValue solve() override;
+  SatValue solve(long unsigned int&) override;
+  bool ok() const override;
+
+  SatValue value(SatLiteral l) override;
+  SatValue modelValue(SatLiteral l) override;
+
+  unsigned getAssertionLevel() const override;
+
+ private:
+  /* Disable the default constructor. */
+  BVMinisatPortfolio() CVC4_UNDEFINED;
+
+  class Statistics
+  {
+   public:
+    StatisticsRegistry* d_registry;
+    IntStat d_statCallsToSolve;
+    IntStat d_statExported;
+    IntStat d_statImported;
+    HistogramStat<uint32_t> d_statWinners;
+    TimerStat d_statSolveTime;
+    Statistics(StatisticsRegistry* registry, const std::string& prefix);
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
+};/* class BVMinisatPortfolio */
+
+}  // namespace prop
+}  // namespace CVC4
+
+#endif /* __CVC4__PROP__BVMINISAT_PORTFOLIO_H */
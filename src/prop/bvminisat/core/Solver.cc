@@ -91,7 +91,8 @@ Solver::Solver(CVC4::context::Context* c) :
 
     // Parameters (user settable):
     //
-    d_notify(nullptr)
+    d_notify(nullptr),
+    d_share(nullptr)
   , c(c)
   , verbosity        (0)
   , var_decay        (opt_var_decay)
@@ -303,6 +304,34 @@ bool Solver::addClause_(vec<Lit>& ps, ClauseId& id)
     return ok;
 }
 
+bool Solver::addLearntClause(vec<Lit>& ps)
+{
+    Assert(decisionLevel() == 0);
+    Assert(d_bvp == NULL);
+    if (!ok) return false;
+
+    // Check if clause is satisfied and remove false/duplicate literals:
+    sort(ps);
+    Lit p; int i, j;
+    for (i = j = 0, p = lit_Undef; i < ps.size(); i++) {
+      if (value(ps[i]) == l_True || ps[i] == ~p) return true;
+      if (value(ps[i]) != l_False && ps[i] != p) ps[j++] = p = ps[i];
+    }
+    ps.shrink(i - j);
+
+    if (ps.size() == 0) {
+      return ok = false;
+    } else if (ps.size() == 1) {
+      uncheckedEnqueue(ps[0]);
+      return ok = (propagate() == CRef_Undef);
+    }
+    CRef cr = ca.alloc(ps, true);
+    learnts.push(cr);
+    attachClause(cr);
+    claBumpActivity(ca[cr]);
+    return true;
+}
+
 void Solver::attachClause(CRef cr) {
     const Clause& c = ca[cr];
     assert(c.size() > 1);
@@ -982,6 +1011,7 @@ lbool Solver::search(int nof_conflicts, UIP uip)
 
             learnt_clause.clear();
             analyze(confl, learnt_clause, backtrack_level, uip);
+            if (d_share) d_share->exportClause(learnt_clause);
 
             Lit p = learnt_clause[0];
             //bool assumption = marker[var(p)] == 2;
@@ -1227,6 +1257,10 @@ lbool Solver::solve_()
         double rest_base = luby_restart ? luby(restart_inc, curr_restarts) : pow(restart_inc, curr_restarts);
         status = search(rest_base * restart_first);
         if (!withinBudget(CVC4::options::bvSatConflictStep())) break;
+        if (status == l_Undef && d_share && decisionLevel() == 0){
+            d_share->importClauses();
+            if (!ok) status = l_False;
+        }
         curr_restarts++;
     }
 
@@ -1475,13 +1509,15 @@ void ClauseAllocator::reloc(CRef& cr,
 }
 
 void Solver::setNotify(Notify* toNotify) { d_notify = toNotify; }
+
+void Solver::setClauseShare(ClauseShare* share) { d_share = share; }
 bool Solver::withinBudget(uint64_t amount) const
 {
   AlwaysAssert(d_notify);
   d_notify->spendResource(amount);
   d_notify->safePoint(0);
 
-  return !asynch_interrupt &&
+  return !asynch_interrupt.load(std::memory_order_relaxed) &&
          (conflict_budget < 0 || conflicts < (uint64_t)conflict_budget) &&
          (propagation_budget < 0 ||
           propagations < (uint64_t)propagation_budget);
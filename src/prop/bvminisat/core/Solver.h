@@ -21,6 +21,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #ifndef BVMinisat_Solver_h
 #define BVMinisat_Solver_h
 
+#include <atomic>
 #include <vector>
 
 #include "context/context.h"
@@ -65,6 +66,26 @@ public:
   virtual void safePoint(unsigned amount) = 0;
 };
 
+/** Interface for exchanging learnt clauses with other solvers */
+class ClauseShare {
+
+public:
+
+  virtual ~ClauseShare() {}
+
+  /**
+   * Offer a new learnt clause to the other solvers.
+   */
+  virtual void exportClause(const vec<Lit>& learnt) = 0;
+
+  /**
+   * Add the clauses learnt by the other solvers (through
+   * addLearntClause()).
+   * Called between restarts, at decision level 0.
+   */
+  virtual void importClauses() = 0;
+};
+
 //=================================================================================================
 // Solver -- the main class:
 class Solver {
@@ -82,6 +103,9 @@ private:
     /** To notify */
     Notify* d_notify;
 
+    /** To exchange learnt clauses with, if any */
+    ClauseShare* d_share;
+
     /** Cvc4 context */
     CVC4::context::Context* c;
 
@@ -100,6 +124,8 @@ public:
 
     void setNotify(Notify* toNotify);
 
+    void setClauseShare(ClauseShare* share);
+
     // Problem specification:
     //
     Var     newVar    (bool polarity = true, bool dvar = true); // Add a new variable with parameters specifying variable mode.
@@ -114,6 +140,9 @@ public:
     bool    addClause (Lit p, Lit q, Lit r, ClauseId& id);                    // Add a ternary clause to the solver. 
     bool    addClause_(      vec<Lit>& ps, ClauseId& id);                     // Add a clause to the solver without making superflous internal copy. Will
                                                                 // change the passed vector 'ps'.
+    bool    addLearntClause(vec<Lit>& ps);                      // Add a clause implied by the clauses of the solver as a learnt clause, which
+                                                                // reduceDB() may remove.  Only at decision level 0, without proofs.
+                                                                // Changes the passed vector 'ps'.
 
     // Solving:
     //
@@ -289,7 +318,8 @@ protected:
     //
     int64_t             conflict_budget;    // -1 means no budget.
     int64_t             propagation_budget; // -1 means no budget.
-    bool                asynch_interrupt;
+    std::atomic<bool>   asynch_interrupt;   // Set by other threads (e.g. the
+                                            // portfolio), only as a flag.
     
     //proof log
     CVC4::BitVectorProof * d_bvp;
@@ -458,8 +488,8 @@ inline void     Solver::setDecisionVar(Var v, bool b)
 }
 inline void     Solver::setConfBudget(int64_t x){ conflict_budget    = conflicts    + x; }
 inline void     Solver::setPropBudget(int64_t x){ propagation_budget = propagations + x; }
-inline void     Solver::interrupt(){ asynch_interrupt = true; }
-inline void     Solver::clearInterrupt(){ asynch_interrupt = false; }
+inline void     Solver::interrupt(){ asynch_interrupt.store(true, std::memory_order_relaxed); }
+inline void     Solver::clearInterrupt(){ asynch_interrupt.store(false, std::memory_order_relaxed); }
 inline void     Solver::budgetOff(){ conflict_budget = propagation_budget = -1; }
 
 inline lbool     Solver::solve         ()                    { budgetOff(); return solve_(); }
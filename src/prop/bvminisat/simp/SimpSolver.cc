@@ -365,7 +365,7 @@ bool SimpSolver::backwardSubsumptionCheck(bool verbose)
     while (subsumption_queue.size() > 0 || bwdsub_assigns < trail.size()){
 
         // Empty subsumption queue and return immediately on user-interrupt:
-        if (asynch_interrupt){
+        if (asynch_interrupt.load(std::memory_order_relaxed)){
             subsumption_queue.clear();
             bwdsub_assigns = trail.size();
             break; }
@@ -634,7 +634,7 @@ bool SimpSolver::eliminate(bool turn_off_elim)
             ok = false; goto cleanup; }
 
         // Empty elim_heap and return immediately on user-interrupt:
-        if (asynch_interrupt){
+        if (asynch_interrupt.load(std::memory_order_relaxed)){
             assert(bwdsub_assigns == trail.size());
             assert(subsumption_queue.size() == 0);
             assert(n_touched == 0);
@@ -645,7 +645,7 @@ bool SimpSolver::eliminate(bool turn_off_elim)
         for (int cnt = 0; !elim_heap.empty(); cnt++){
             Var elim = elim_heap.removeMin();
             
-            if (asynch_interrupt) break;
+            if (asynch_interrupt.load(std::memory_order_relaxed)) break;
 
             if (isEliminated(elim) || value(elim) != l_Undef) continue;
 
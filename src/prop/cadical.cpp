@@ -39,9 +39,8 @@ SatValue toSatValue(int result)
 
 SatValue toSatValueLit(int value)
 {
-  if (value == 1) return SAT_VALUE_TRUE;
-  Assert(value == -1);
-  return SAT_VALUE_FALSE;
+  // val() returns the literal itself if it is true, its negation otherwise
+  return value > 0 ? SAT_VALUE_TRUE : SAT_VALUE_FALSE;
 }
 
 CadicalLit toCadicalLit(const SatLiteral lit)
@@ -0,0 +1,790 @@
+/*********************                                                        */
+/*! \file cadical_dpll.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief CaDiCaL as the DPLL(T) SAT solver.
+ **
+ ** Implementation of the DPLL(T) SAT solver interface on top of CaDiCaL.
+ **/
+
+#include "prop/cadical_dpll.h"
+
+#ifdef CVC4_USE_CADICAL_PROPAGATOR
+
+#include <algorithm>
+
+#include "base/output.h"
+#include "prop/theory_proxy.h"
+
+namespace CVC4 {
+namespace prop {
+
+using CadicalLit = int;
+using CadicalVar = int;
+
+// helper functions
+namespace {
+
+SatValue toSatValue(int result)
+{
+  if (result == 10) return SAT_VALUE_TRUE;
+  if (result == 20) return SAT_VALUE_FALSE;
+  Assert(result == 0);
+  return SAT_VALUE_UNKNOWN;
+}
+
+CadicalLit toCadicalLit(const SatLiteral lit)
+{
+  return lit.isNegated() ? -lit.getSatVariable() : lit.getSatVariable();
+}
+
+CadicalVar toCadicalVar(SatVariable var) { return var; }
+
+SatLiteral toSatLiteral(CadicalLit lit)
+{
+  return lit < 0 ? SatLiteral(-lit, true) : SatLiteral(lit, false);
+}
+
+}  // namespace helper functions
+
+/**
+ * Counts the conflicts of CaDiCaL, which it doesn't report through its
+ * API, as the clauses it learns.  Each conflict learns one clause;
+ * inprocessing adds a few more.  The clauses themselves are declined.
+ */
+class CadicalConflictCounter : public CaDiCaL::Learner
+{
+ public:
+  CadicalConflictCounter() : d_count(0) {}
+
+  bool learning(int size) override
+  {
+    ++d_count;
+    return false;
+  }
+
+  void learn(int lit) override {}
+
+  unsigned long count() const { return d_count; }
+
+ private:
+  unsigned long d_count;
+};
+
+/**
+ * The external propagator connecting CaDiCaL to the theories.  It keeps
+ * its own copy of the assignment (CaDiCaL only reports it through
+ * notifications), pushes and pops the SAT context with CaDiCaL's
+ * decision levels and enqueues the assigned theory atoms.
+ *
+ * Literals fixed at the root level are not reassigned by CaDiCaL when it
+ * backtracks, so they are kept on the trail and enqueued again when the
+ * context levels in which the theories received them are popped.
+ */
+class CadicalPropagator : public CaDiCaL::ExternalPropagator
+{
+ public:
+  CadicalPropagator(CadicalDPLLSatSolver& solver,
+                    context::Context* context,
+                    TheoryProxy* proxy)
+      : d_solver(solver),
+        d_context(context),
+        d_proxy(proxy),
+        d_checkedTrail(0),
+        d_fixedMaxLevel(0),
+        d_propIndex(0),
+        d_reasonIndex(0),
+        d_inReason(false),
+        d_clauseIndex(0),
+        d_litIndex(0),
+        d_inSearch(false)
+  {
+  }
+
+  void notify_assignment(int lit, bool is_fixed) override;
+
+  void notify_new_decision_level() override
+  {
+    d_context->push();
+    d_levelStart.push_back(d_trail.size());
+  }
+
+  void notify_backtrack(size_t new_level) override { backtrack(new_level); }
+
+  bool cb_check_found_model(const std::vector<int>& model) override;
+
+  int cb_decide() override;
+
+  int cb_propagate() override;
+
+  int cb_add_reason_clause_lit(int propagated_lit) override;
+
+  bool cb_has_external_clause() override;
+
+  int cb_add_external_clause_lit() override;
+
+  /** Register a new variable. */
+  void addVar(SatVariable var,
+              bool isTheoryAtom,
+              bool preRegister,
+              bool isActivation);
+
+  /** Buffer a clause added during search, passed to CaDiCaL on request. */
+  void addClause(const SatClause& clause) { d_clauses.push_back(clause); }
+
+  /**
+   * Take the clauses not passed to CaDiCaL yet, e.g. the lemmas of a
+   * full check that was interrupted.
+   */
+  void takePendingClauses(std::vector<SatClause>& clauses);
+
+  /** Backtrack to the given decision level. */
+  void backtrack(size_t level);
+
+  /**
+   * Called after the SAT context was popped for a user level: enqueue
+   * the fixed theory literals again that the theories lost.
+   */
+  void userPop()
+  {
+    d_varsToRegister.clear();
+    reenqueueFixed();
+  }
+
+  void setInSearch(bool inSearch) { d_inSearch = inSearch; }
+
+  bool inSearch() const { return d_inSearch; }
+
+  /** The current value of the literal. */
+  SatValue value(SatLiteral l) const
+  {
+    SatVariable v = l.getSatVariable();
+    if (v >= d_vars.size() || d_vars[v].d_value == SAT_VALUE_UNKNOWN)
+    {
+      return SAT_VALUE_UNKNOWN;
+    }
+    return l.isNegated() ? invertValue(d_vars[v].d_value) : d_vars[v].d_value;
+  }
+
+ private:
+  struct VarInfo
+  {
+    /** The value of the positive literal. */
+    SatValue d_value;
+    bool d_isTheoryAtom;
+    bool d_isActivation;
+    bool d_isFixed;
+    /** The context level at which the literal was enqueued last. */
+    int d_enqueueLevel;
+  };
+
+  /** Run a theory check and collect the theory propagations. */
+  void theoryCheck(theory::Theory::Effort effort);
+
+  /** Add the explanation of a theory propagation as a clause. */
+  void addExplanation(SatLiteral l);
+
+  /** Enqueue the fixed theory literals not known in the current context. */
+  void reenqueueFixed();
+
+  CadicalDPLLSatSolver& d_solver;
+
+  context::Context* d_context;
+
+  TheoryProxy* d_proxy;
+
+  /** Indexed by variable. */
+  std::vector<VarInfo> d_vars;
+
+  /** The assigned literals, in order. */
+  std::vector<SatLiteral> d_trail;
+
+  /** The start of each decision level > 0 on the trail. */
+  std::vector<size_t> d_levelStart;
+
+  /** The trail size at the last theory check. */
+  size_t d_checkedTrail;
+
+  /**
+   * The fixed theory literals, with the context level at which they were
+   * enqueued, and the highest of these levels.
+   */
+  std::vector<std::pair<SatLiteral, int>> d_fixedTheoryLits;
+  int d_fixedMaxLevel;
+
+  /**
+   * Variables to register with the theories again when backtracking
+   * below the decision level at which they were created.
+   */
+  std::vector<std::pair<SatVariable, size_t>> d_varsToRegister;
+
+  /** The theory propagations not passed to CaDiCaL yet. */
+  std::vector<SatLiteral> d_propagations;
+  size_t d_propIndex;
+
+  /** The reason clause being passed to CaDiCaL. */
+  SatClause d_reason;
+  size_t d_reasonIndex;
+  bool d_inReason;
+
+  /** The clauses to pass to CaDiCaL. */
+  std::vector<SatClause> d_clauses;
+  size_t d_clauseIndex;
+  size_t d_litIndex;
+
+  /** Whether CaDiCaL is solving. */
+  bool d_inSearch;
+};/* class CadicalPropagator */
+
+void CadicalPropagator::notify_assignment(int lit, bool is_fixed)
+{
+  SatLiteral l = toSatLiteral(lit);
+  VarInfo& info = d_vars[l.getSatVariable()];
+  if (info.d_isActivation)
+  {
+    return;
+  }
+  SatValue val = l.isNegated() ? SAT_VALUE_FALSE : SAT_VALUE_TRUE;
+  if (info.d_value != SAT_VALUE_UNKNOWN)
+  {
+    // a literal assigned before becomes fixed
+    Assert(info.d_value == val);
+    if (is_fixed && !info.d_isFixed)
+    {
+      info.d_isFixed = true;
+      if (info.d_isTheoryAtom)
+      {
+        d_fixedTheoryLits.push_back(std::make_pair(l, info.d_enqueueLevel));
+        d_fixedMaxLevel = std::max(d_fixedMaxLevel, info.d_enqueueLevel);
+      }
+    }
+    return;
+  }
+  info.d_value = val;
+  info.d_isFixed = is_fixed;
+  d_trail.push_back(l);
+  if (info.d_isTheoryAtom)
+  {
+    d_proxy->enqueueTheoryLiteral(l);
+    info.d_enqueueLevel = d_context->getLevel();
+    if (is_fixed)
+    {
+      d_fixedTheoryLits.push_back(std::make_pair(l, info.d_enqueueLevel));
+      d_fixedMaxLevel = std::max(d_fixedMaxLevel, info.d_enqueueLevel);
+    }
+  }
+}
+
+void CadicalPropagator::backtrack(size_t level)
+{
+  if (level >= d_levelStart.size())
+  {
+    return;
+  }
+  Debug("cadical::propagator") << "backtrack to level " << level << std::endl;
+
+  size_t start = d_levelStart[level];
+  size_t j = start;
+  for (size_t i = start; i < d_trail.size(); ++i)
+  {
+    SatLiteral l = d_trail[i];
+    VarInfo& info = d_vars[l.getSatVariable()];
+    if (info.d_isFixed)
+    {
+      d_trail[j++] = l;
+    }
+    else
+    {
+      info.d_value = SAT_VALUE_UNKNOWN;
+    }
+  }
+  d_trail.resize(j);
+  d_checkedTrail = std::min(d_checkedTrail, d_trail.size());
+
+  for (size_t i = level; i < d_levelStart.size(); ++i)
+  {
+    d_context->pop();
+  }
+  d_levelStart.resize(level);
+
+  d_propagations.clear();
+  d_propIndex = 0;
+
+  reenqueueFixed();
+
+  // the theories forgot the variables created above this level
+  while (!d_varsToRegister.empty() && d_varsToRegister.back().second > level)
+  {
+    SatVariable var = d_varsToRegister.back().first;
+    d_varsToRegister.pop_back();
+    d_proxy->variableNotify(var);
+  }
+}
+
+void CadicalPropagator::reenqueueFixed()
+{
+  int level = d_context->getLevel();
+  if (d_fixedMaxLevel <= level)
+  {
+    return;
+  }
+  for (std::pair<SatLiteral, int>& fixed : d_fixedTheoryLits)
+  {
+    if (fixed.second > level)
+    {
+      d_proxy->enqueueTheoryLiteral(fixed.first);
+      fixed.second = level;
+      d_vars[fixed.first.getSatVariable()].d_enqueueLevel = level;
+    }
+  }
+  d_fixedMaxLevel = level;
+}
+
+void CadicalPropagator::addVar(SatVariable var,
+                               bool isTheoryAtom,
+                               bool preRegister,
+                               bool isActivation)
+{
+  if (var >= d_vars.size())
+  {
+    VarInfo info = {SAT_VALUE_UNKNOWN, false, false, false, 0};
+    d_vars.resize(var + 1, info);
+  }
+  d_vars[var].d_isTheoryAtom = isTheoryAtom;
+  d_vars[var].d_isActivation = isActivation;
+  if (preRegister && !d_levelStart.empty())
+  {
+    d_varsToRegister.push_back(std::make_pair(var, d_levelStart.size()));
+  }
+}
+
+void CadicalPropagator::theoryCheck(theory::Theory::Effort effort)
+{
+  d_checkedTrail = d_trail.size();
+  d_proxy->theoryCheck(effort);
+
+  SatClause propagations;
+  d_proxy->theoryPropagate(propagations);
+  for (const SatLiteral& l : propagations)
+  {
+    SatValue val = value(l);
+    if (val == SAT_VALUE_UNKNOWN)
+    {
+      d_propagations.push_back(l);
+    }
+    else if (val == SAT_VALUE_FALSE)
+    {
+      // a conflict, CaDiCaL learns it from the explanation
+      addExplanation(l);
+    }
+  }
+}
+
+void CadicalPropagator::addExplanation(SatLiteral l)
+{
+  SatClause explanation;
+  d_proxy->explainPropagation(l, explanation);
+  d_solver.addClause(explanation, true);
+}
+
+int CadicalPropagator::cb_propagate()
+{
+  if (!d_clauses.empty())
+  {
+    // let CaDiCaL add the lemmas first
+    return 0;
+  }
+  if (d_propIndex == d_propagations.size())
+  {
+    d_propagations.clear();
+    d_propIndex = 0;
+    if (d_checkedTrail < d_trail.size())
+    {
+      theoryCheck(theory::Theory::EFFORT_STANDARD);
+    }
+  }
+  while (d_propIndex < d_propagations.size())
+  {
+    SatLiteral l = d_propagations[d_propIndex++];
+    if (value(l) == SAT_VALUE_UNKNOWN)
+    {
+      ++d_solver.d_statistics.d_numTheoryPropagations;
+      return toCadicalLit(l);
+    }
+  }
+  return 0;
+}
+
+int CadicalPropagator::cb_add_reason_clause_lit(int propagated_lit)
+{
+  if (!d_inReason)
+  {
+    SatLiteral l = toSatLiteral(propagated_lit);
+    d_reason.clear();
+    d_proxy->explainPropagation(l, d_reason);
+    Assert(!d_reason.empty() && d_reason[0] == l);
+    d_reasonIndex = 0;
+    d_inReason = true;
+  }
+  if (d_reasonIndex < d_reason.size())
+  {
+    return toCadicalLit(d_reason[d_reasonIndex++]);
+  }
+  d_inReason = false;
+  return 0;
+}
+
+bool CadicalPropagator::cb_has_external_clause()
+{
+  if (d_clauseIndex == d_clauses.size())
+  {
+    d_clauses.clear();
+    d_clauseIndex = 0;
+    return false;
+  }
+  return true;
+}
+
+int CadicalPropagator::cb_add_external_clause_lit()
+{
+  const SatClause& clause = d_clauses[d_clauseIndex];
+  if (d_litIndex < clause.size())
+  {
+    return toCadicalLit(clause[d_litIndex++]);
+  }
+  d_litIndex = 0;
+  ++d_clauseIndex;
+  return 0;
+}
+
+void CadicalPropagator::takePendingClauses(std::vector<SatClause>& clauses)
+{
+  Assert(d_litIndex == 0);
+  clauses.insert(
+      clauses.end(), d_clauses.begin() + d_clauseIndex, d_clauses.end());
+  d_clauses.clear();
+  d_clauseIndex = 0;
+}
+
+bool CadicalPropagator::cb_check_found_model(const std::vector<int>& model)
+{
+  for (;;)
+  {
+    ++d_solver.d_statistics.d_numFullChecks;
+    theoryCheck(theory::Theory::EFFORT_FULL);
+    if (!d_clauses.empty())
+    {
+      return false;
+    }
+    if (d_propIndex < d_propagations.size())
+    {
+      // CaDiCaL does not propagate in a complete assignment, so pass the
+      // propagations of new literals as their explanations
+      for (; d_propIndex < d_propagations.size(); ++d_propIndex)
+      {
+        addExplanation(d_propagations[d_propIndex]);
+      }
+      d_propagations.clear();
+      d_propIndex = 0;
+      return false;
+    }
+    if (!d_proxy->theoryNeedCheck())
+    {
+      return true;
+    }
+  }
+}
+
+int CadicalPropagator::cb_decide()
+{
+  SatLiteral l = d_proxy->getNextTheoryDecisionRequest();
+  while (l != undefSatLiteral)
+  {
+    if (value(l) == SAT_VALUE_UNKNOWN)
+    {
+      ++d_solver.d_statistics.d_numTheoryDecisions;
+      return toCadicalLit(l);
+    }
+    l = d_proxy->getNextTheoryDecisionRequest();
+  }
+  bool stopSearch = false;
+  l = d_proxy->getNextDecisionEngineRequest(stopSearch);
+  if (!stopSearch && l != undefSatLiteral && value(l) == SAT_VALUE_UNKNOWN)
+  {
+    return toCadicalLit(l);
+  }
+  return 0;
+}
+
+CadicalDPLLSatSolver::CadicalDPLLSatSolver(StatisticsRegistry* registry)
+    : d_solver(new CaDiCaL::Solver()),
+      d_conflictCounter(new CadicalConflictCounter()),
+      d_context(nullptr),
+      d_okay(1, true),
+      d_hasModel(false),
+      // Note: CaDiCaL variables start with index 1 rather than 0 since negated
+      //       literals are represented as the negation of the index.
+      d_nextVar(1),
+      d_true(0),
+      d_false(0),
+      d_statistics(registry)
+{
+  d_solver->set("quiet", 1);  // CaDiCaL is verbose by default
+  d_solver->connect_learner(d_conflictCounter.get());
+}
+
+CadicalDPLLSatSolver::~CadicalDPLLSatSolver()
+{
+  if (d_propagator)
+  {
+    d_solver->disconnect_external_propagator();
+  }
+  d_solver->disconnect_learner();
+}
+
+void CadicalDPLLSatSolver::initialize(context::Context* context,
+                                      TheoryProxy* theoryProxy)
+{
+  d_context = context;
+  d_propagator.reset(new CadicalPropagator(*this, context, theoryProxy));
+  d_solver->connect_external_propagator(d_propagator.get());
+
+  d_true = newVar(false, false, false);
+  d_false = newVar(false, false, false);
+  d_solver->add(toCadicalVar(d_true));
+  d_solver->add(0);
+  d_solver->add(-toCadicalVar(d_false));
+  d_solver->add(0);
+}
+
+ClauseId CadicalDPLLSatSolver::addClause(SatClause& clause, bool removable)
+{
+  d_hasModel = false;
+  ++d_statistics.d_numClauses;
+  if (d_activationLits.empty() && clause.empty())
+  {
+    d_okay.back() = false;
+  }
+  if (d_propagator->inSearch())
+  {
+    ++d_statistics.d_numLemmas;
+    SatClause c(clause);
+    if (!d_activationLits.empty())
+    {
+      c.push_back(SatLiteral(d_activationLits.back(), true));
+    }
+    d_propagator->addClause(c);
+    return ClauseIdError;
+  }
+  for (const SatLiteral& lit : clause)
+  {
+    d_solver->add(toCadicalLit(lit));
+  }
+  if (!d_activationLits.empty())
+  {
+    d_solver->add(-toCadicalVar(d_activationLits.back()));
+  }
+  d_solver->add(0);
+  return ClauseIdError;
+}
+
+SatVariable CadicalDPLLSatSolver::newVar(bool isTheoryAtom,
+                                         bool preRegister,
+                                         bool canErase)
+{
+  return newVarInternal(isTheoryAtom, preRegister, false);
+}
+
+SatVariable CadicalDPLLSatSolver::newVarInternal(bool isTheoryAtom,
+                                                 bool preRegister,
+                                                 bool isActivation)
+{
+  SatVariable var = d_nextVar++;
+  d_propagator->addVar(var, isTheoryAtom, preRegister, isActivation);
+  d_solver->add_observed_var(toCadicalVar(var));
+  ++d_statistics.d_numVariables;
+  return var;
+}
+
+SatValue CadicalDPLLSatSolver::solveInternal()
+{
+  TimerStat::CodeTimer codeTimer(d_statistics.d_solveTime);
+  ++d_statistics.d_numSatCalls;
+
+  // lemmas left over from an interrupted search
+  std::vector<SatClause> pending;
+  d_propagator->takePendingClauses(pending);
+  for (const SatClause& clause : pending)
+  {
+    for (const SatLiteral& lit : clause)
+    {
+      d_solver->add(toCadicalLit(lit));
+    }
+    d_solver->add(0);
+  }
+
+  for (SatVariable a : d_activationLits)
+  {
+    d_solver->assume(toCadicalVar(a));
+  }
+  d_propagator->setInSearch(true);
+  SatValue res = toSatValue(d_solver->solve());
+  d_propagator->setInSearch(false);
+
+  d_hasModel = (res == SAT_VALUE_TRUE);
+  if (res == SAT_VALUE_FALSE)
+  {
+    bool failedActivation = false;
+    for (SatVariable a : d_activationLits)
+    {
+      failedActivation = failedActivation || d_solver->failed(toCadicalVar(a));
+    }
+    if (!failedActivation)
+    {
+      // inconsistent without any user level
+      d_okay.assign(d_okay.size(), false);
+    }
+    else
+    {
+      d_okay.back() = false;
+    }
+  }
+  return res;
+}
+
+SatValue CadicalDPLLSatSolver::solve() { return solveInternal(); }
+
+SatValue CadicalDPLLSatSolver::solve(long unsigned int& resource)
+{
+  Trace("limit") << "SatSolver::solve(): have limit of " << resource
+                 << " conflicts" << std::endl;
+  if (resource != 0)
+  {
+    d_solver->limit("conflicts", resource);
+  }
+  unsigned long conflictsBefore = d_conflictCounter->count();
+  SatValue result = solveInternal();
+  resource = d_conflictCounter->count() - conflictsBefore;
+  Trace("limit") << "SatSolver::solve(): it took " << resource
+                 << " conflicts" << std::endl;
+  return result;
+}
+
+void CadicalDPLLSatSolver::interrupt() { d_solver->terminate(); }
+
+SatValue CadicalDPLLSatSolver::value(SatLiteral l)
+{
+  return d_propagator->value(l);
+}
+
+SatValue CadicalDPLLSatSolver::modelValue(SatLiteral l)
+{
+  if (!d_hasModel)
+  {
+    return SAT_VALUE_UNKNOWN;
+  }
+  return d_solver->val(toCadicalLit(l)) > 0 ? SAT_VALUE_TRUE : SAT_VALUE_FALSE;
+}
+
+unsigned CadicalDPLLSatSolver::getAssertionLevel() const
+{
+  return d_activationLits.size();
+}
+
+bool CadicalDPLLSatSolver::ok() const { return d_okay.back(); }
+
+void CadicalDPLLSatSolver::push()
+{
+  d_propagator->backtrack(0);
+  d_hasModel = false;
+  d_activationLits.push_back(newVarInternal(false, false, true));
+  d_okay.push_back(d_okay.back());
+  d_context->push();
+}
+
+void CadicalDPLLSatSolver::pop()
+{
+  Assert(!d_activationLits.empty());
+  d_propagator->backtrack(0);
+  d_hasModel = false;
+
+  // the pending lemmas belong to the popped level
+  std::vector<SatClause> pending;
+  d_propagator->takePendingClauses(pending);
+
+  d_solver->add(-toCadicalVar(d_activationLits.back()));
+  d_solver->add(0);
+  d_activationLits.pop_back();
+  d_okay.pop_back();
+  d_context->pop();
+  d_propagator->userPop();
+}
+
+void CadicalDPLLSatSolver::resetTrail() { d_propagator->backtrack(0); }
+
+bool CadicalDPLLSatSolver::properExplanation(SatLiteral lit,
+                                             SatLiteral expl) const
+{
+  return true;
+}
+
+void CadicalDPLLSatSolver::requirePhase(SatLiteral lit)
+{
+  d_solver->phase(toCadicalLit(lit));
+}
+
+bool CadicalDPLLSatSolver::flipDecision() { return false; }
+
+bool CadicalDPLLSatSolver::isDecision(SatVariable decn) const
+{
+  if (d_propagator->value(SatLiteral(decn)) == SAT_VALUE_UNKNOWN)
+  {
+    return false;
+  }
+  return d_solver->is_decision(toCadicalVar(decn));
+}
+
+CadicalDPLLSatSolver::Statistics::Statistics(StatisticsRegistry* registry)
+    : d_registry(registry),
+      d_numSatCalls("sat::cadical::calls_to_solve", 0),
+      d_numVariables("sat::cadical::variables", 0),
+      d_numClauses("sat::cadical::clauses", 0),
+      d_numLemmas("sat::cadical::lemmas", 0),
+      d_numTheoryPropagations("sat::cadical::theory_propagations", 0),
+      d_numTheoryDecisions("sat::cadical::theory_decisions", 0),
+      d_numFullChecks("sat::cadical::full_checks", 0),
+      d_solveTime("sat::cadical::solve_time")
+{
+  d_registry->registerStat(&d_numSatCalls);
+  d_registry->registerStat(&d_numVariables);
+  d_registry->registerStat(&d_numClauses);
+  d_registry->registerStat(&d_numLemmas);
+  d_registry->registerStat(&d_numTheoryPropagations);
+  d_registry->registerStat(&d_numTheoryDecisions);
+  d_registry->registerStat(&d_numFullChecks);
+  d_registry->registerStat(&d_solveTime);
+}
+
+CadicalDPLLSatSolver::Statistics::~Statistics()
+{
+  d_registry->unregisterStat(&d_numSatCalls);
+  d_registry->unregisterStat(&d_numVariables);
+  d_registry->unregisterStat(&d_numClauses);
+  d_registry->unregisterStat(&d_numLemmas);
+  d_registry->unregisterStat(&d_numTheoryPropagations);
+  d_registry->unregisterStat(&d_numTheoryDecisions);
+  d_registry->unregisterStat(&d_numFullChecks);
+  d_registry->unregisterStat(&d_solveTime);
+}
+
+}  // namespace prop
+}  // namespace CVC4
+
+#endif  // CVC4_USE_CADICAL_PROPAGATOR
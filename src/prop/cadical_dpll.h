@@ -0,0 +1,167 @@
+/*********************                                                        */
+/*! \file cadical_dpll.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief CaDiCaL as the DPLL(T) SAT solver.
+ **
+ ** Implementation of the DPLL(T) SAT solver interface on top of CaDiCaL,
+ ** communicating with the theories through CaDiCaL's external propagator
+ ** interface (IPASIR-UP, CaDiCaL 1.9).
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__PROP__CADICAL_DPLL_H
+#define __CVC4__PROP__CADICAL_DPLL_H
+
+#ifdef CVC4_USE_CADICAL_PROPAGATOR
+
+#include <memory>
+#include <vector>
+
+#include <cadical.hpp>
+
+#include "context/context.h"
+#include "prop/sat_solver.h"
+#include "util/statistics_registry.h"
+
+namespace CVC4 {
+namespace prop {
+
+class CadicalConflictCounter;
+class CadicalPropagator;
+
+/**
+ * CaDiCaL as the main SAT solver.  All variables are observed by the
+ * propagator (see CadicalPropagator), which pushes the SAT context on
+ * each decision level and passes the assigned theory atoms, theory
+ * propagations, lemmas and decisions between CaDiCaL and the
+ * TheoryProxy, playing the role Minisat's search loop plays otherwise.
+ *
+ * User levels are implemented with activation literals: each clause
+ * added at user level k > 0 is extended with the negation of the
+ * activation literal of level k, which is assumed by each solve() and
+ * permanently falsified when the level is popped.
+ *
+ * There are no clause ids, so this solver supports neither proofs nor
+ * unsat cores.
+ */
+class CadicalDPLLSatSolver : public DPLLSatSolverInterface
+{
+ public:
+  CadicalDPLLSatSolver(StatisticsRegistry* registry);
+
+  ~CadicalDPLLSatSolver() override;
+
+  void initialize(context::Context* context,
+                  TheoryProxy* theoryProxy) override;
+
+  ClauseId addClause(SatClause& clause, bool removable) override;
+
+  ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override
+  {
+    Unreachable("CaDiCaL does not support adding XOR clauses.");
+  }
+
+  SatVariable newVar(bool isTheoryAtom,
+                     bool preRegister,
+                     bool canErase) override;
+
+  SatVariable trueVar() override { return d_true; }
+
+  SatVariable falseVar() override { return d_false; }
+
+  SatValue solve() override;
+
+  SatValue solve(long unsigned int& resource) override;
+
+  void interrupt() override;
+
+  SatValue value(SatLiteral l) override;
+
+  SatValue modelValue(SatLiteral l) override;
+
+  unsigned getAssertionLevel() const override;
+
+  bool ok() const override;
+
+  void push() override;
+
+  void pop() override;
+
+  void resetTrail() override;
+
+  bool properExplanation(SatLiteral lit, SatLiteral expl) const override;
+
+  void requirePhase(SatLiteral lit) override;
+
+  bool flipDecision() override;
+
+  bool isDecision(SatVariable decn) const override;
+
+ private:
+  /** Create a new variable and make the propagator observe it. */
+  SatVariable newVarInternal(bool isTheoryAtom,
+                             bool preRegister,
+                             bool isActivation);
+
+  /** Solve under the activation literals of the current user levels. */
+  SatValue solveInternal();
+
+  std::unique_ptr<CaDiCaL::Solver> d_solver;
+
+  std::unique_ptr<CadicalPropagator> d_propagator;
+
+  /** Counts the conflicts, for solve(resource). */
+  std::unique_ptr<CadicalConflictCounter> d_conflictCounter;
+
+  /** The SAT context, pushed for each user level and decision level. */
+  context::Context* d_context;
+
+  /** The activation literals of the user levels 1, 2, ... */
+  std::vector<SatVariable> d_activationLits;
+
+  /** Whether the clauses were found inconsistent, for each user level. */
+  std::vector<bool> d_okay;
+
+  /** Whether the last call to solve() found a model. */
+  bool d_hasModel;
+
+  /** The next variable, CaDiCaL variables start at 1. */
+  SatVariable d_nextVar;
+
+  SatVariable d_true;
+  SatVariable d_false;
+
+  struct Statistics
+  {
+    StatisticsRegistry* d_registry;
+    IntStat d_numSatCalls;
+    IntStat d_numVariables;
+    IntStat d_numClauses;
+    IntStat d_numLemmas;
+    IntStat d_numTheoryPropagations;
+    IntStat d_numTheoryDecisions;
+    IntStat d_numFullChecks;
+    TimerStat d_solveTime;
+    Statistics(StatisticsRegistry* registry);
+    ~Statistics();
+  };
+
+  Statistics d_statistics;
+
+  friend class CadicalPropagator;
+};/* class CadicalDPLLSatSolver */
+
+}  // namespace prop
+}  // namespace CVC4
+
+#endif  // CVC4_USE_CADICAL_PROPAGATOR
+#endif  // __CVC4__PROP__CADICAL_DPLL_H
@@ -0,0 +1,126 @@
+/*********************                                                        */
+/*! \file clause_exchange.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Lock-free exchange of short clauses between SAT solver threads.
+ **
+ ** Each ring is written like a sequence lock: the writer announces the
+ ** words it is about to overwrite (d_writing) before writing them, and a
+ ** reader checks after copying a clause that the announced words did not
+ ** reach it.
+ **/
+
+#include "prop/clause_exchange.h"
+
+#include "base/cvc4_assert.h"
+
+namespace CVC4 {
+namespace prop {
+
+ClauseExchange::Ring::Ring(size_t capacity)
+    : d_words(new std::atomic<uint32_t>[capacity]),
+      d_writing(0),
+      d_published(0)
+{
+}
+
+ClauseExchange::ClauseExchange(unsigned solvers,
+                               unsigned maxSize,
+                               size_t capacity)
+    : d_maxSize(maxSize),
+      d_capacity(capacity),
+      d_readPos(solvers, std::vector<uint64_t>(solvers, 0)),
+      d_nextRing(solvers, 0)
+{
+  Assert(capacity > maxSize + 1);
+  for (unsigned i = 0; i < solvers; ++i)
+  {
+    d_rings.push_back(std::unique_ptr<Ring>(new Ring(capacity)));
+  }
+}
+
+bool ClauseExchange::publish(unsigned solver,
+                             const uint32_t* lits,
+                             size_t size)
+{
+  if (size > d_maxSize)
+  {
+    return false;
+  }
+  Ring& ring = *d_rings[solver];
+  // only this solver writes to its ring
+  uint64_t start = ring.d_published.load(std::memory_order_relaxed);
+  uint64_t end = start + size + 1;
+  ring.d_writing.store(end, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  ring.d_words[start % d_capacity].store(size, std::memory_order_relaxed);
+  for (size_t i = 0; i < size; ++i)
+  {
+    ring.d_words[(start + 1 + i) % d_capacity].store(
+        lits[i], std::memory_order_relaxed);
+  }
+  ring.d_published.store(end, std::memory_order_release);
+  return true;
+}
+
+bool ClauseExchange::read(const Ring& ring,
+                          uint64_t& pos,
+                          std::vector<uint32_t>& clause)
+{
+  uint64_t published = ring.d_published.load(std::memory_order_acquire);
+  if (pos == published)
+  {
+    return false;
+  }
+  if (published - pos > d_capacity)
+  {
+    // lapped by the writer
+    pos = published;
+    return false;
+  }
+  uint32_t size = ring.d_words[pos % d_capacity].load(std::memory_order_relaxed);
+  clause.clear();
+  if (size <= d_maxSize)
+  {
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      clause.push_back(ring.d_words[(pos + 1 + i) % d_capacity].load(
+          std::memory_order_relaxed));
+    }
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (ring.d_writing.load(std::memory_order_relaxed) - pos > d_capacity)
+  {
+    // overwritten while reading
+    pos = ring.d_published.load(std::memory_order_acquire);
+    return false;
+  }
+  Assert(size <= d_maxSize);
+  pos += size + 1;
+  return true;
+}
+
+bool ClauseExchange::fetch(unsigned solver, std::vector<uint32_t>& clause)
+{
+  unsigned n = d_rings.size();
+  for (unsigned i = 0; i < n; ++i)
+  {
+    unsigned r = d_nextRing[solver];
+    d_nextRing[solver] = (r + 1) % n;
+    if (r != solver && read(*d_rings[r], d_readPos[solver][r], clause))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace prop
+}  // namespace CVC4
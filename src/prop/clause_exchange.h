@@ -0,0 +1,96 @@
+/*********************                                                        */
+/*! \file clause_exchange.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Lock-free exchange of short clauses between SAT solver threads.
+ **
+ ** Each solver publishes its clauses into its own ring buffer, which the
+ ** other solvers read without blocking it; a reader that falls behind by
+ ** more than the capacity of a ring skips the clauses it missed.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__PROP__CLAUSE_EXCHANGE_H
+#define __CVC4__PROP__CLAUSE_EXCHANGE_H
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CVC4 {
+namespace prop {
+
+class ClauseExchange
+{
+ public:
+  /**
+   * Create an exchange between the given number of solvers, for clauses
+   * of at most maxSize literals, each encoded as a 32-bit word.
+   */
+  ClauseExchange(unsigned solvers, unsigned maxSize, size_t capacity = 1 << 16);
+
+  unsigned getMaxSize() const { return d_maxSize; }
+
+  /**
+   * Publish a clause of the given solver.  Clauses with more than
+   * maxSize literals are ignored.  Never blocks.  Returns true if the
+   * clause was published.
+   */
+  bool publish(unsigned solver, const uint32_t* lits, size_t size);
+
+  /**
+   * Fetch the next clause published by another solver for the given
+   * solver, returns false if there is none.  Never blocks.
+   */
+  bool fetch(unsigned solver, std::vector<uint32_t>& clause);
+
+ private:
+  /** The clauses published by one solver, as (size, literals...) words. */
+  struct Ring
+  {
+    Ring(size_t capacity);
+
+    std::unique_ptr<std::atomic<uint32_t>[]> d_words;
+    /** The end of the words written or being written. */
+    std::atomic<uint64_t> d_writing;
+    /** The end of the published words. */
+    std::atomic<uint64_t> d_published;
+  };/* struct ClauseExchange::Ring */
+
+  /**
+   * Read the next clause from the ring into clause, starting at pos.
+   * Returns false if there is no published clause at pos, or if it was
+   * overwritten while reading, in which case pos skips to the end of
+   * the published words.
+   */
+  bool read(const Ring& ring, uint64_t& pos, std::vector<uint32_t>& clause);
+
+  unsigned d_maxSize;
+
+  size_t d_capacity;
+
+  std::vector<std::unique_ptr<Ring>> d_rings;
+
+  /**
+   * The read position of each solver (first index) in the ring of each
+   * solver (second index), only accessed by the reading solver.
+   */
+  std::vector<std::vector<uint64_t>> d_readPos;
+
+  /** The ring each solver fetches from next, to alternate between them. */
+  std::vector<unsigned> d_nextRing;
+};/* class ClauseExchange */
+
+}  // namespace prop
+}  // namespace CVC4
+
+#endif /* __CVC4__PROP__CLAUSE_EXCHANGE_H */
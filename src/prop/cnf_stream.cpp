@@ -17,12 +17,16 @@
  **/
 #include "prop/cnf_stream.h"
 
+#include <atomic>
 #include <queue>
+#include <thread>
+#include <unordered_map>
 
 #include "base/cvc4_assert.h"
 #include "base/output.h"
 #include "expr/expr.h"
 #include "expr/node.h"
+#include "expr/node_manager_attributes.h"
 #include "options/bv_options.h"
 #include "proof/clause_id.h"
 #include "proof/cnf_proof.h"
@@ -33,6 +37,7 @@
 #include "prop/theory_proxy.h"
 #include "smt/command.h"
 #include "smt/smt_engine_scope.h"
+#include "smt/smt_statistics_registry.h"
 #include "theory/theory.h"
 #include "theory/theory_engine.h"
 
@@ -63,6 +68,8 @@ TseitinCnfStream::TseitinCnfStream(SatSolver* satSolver, Registrar* registrar,
   : CnfStream(satSolver, registrar, context, fullLitToNodeMap, name)
 {}
 
+TseitinCnfStream::~TseitinCnfStream() {}
+
 void CnfStream::assertClause(TNode node, SatClause& c) {
   Debug("cnf") << "Inserting into stream " << c << " node = " << node << endl;
   if(Dump.isOn("clauses")) {
@@ -94,6 +101,13 @@ void CnfStream::assertClause(TNode node, SatClause& c) {
     );
 }
 
+void CnfStream::convertAndAssertBatch(const std::vector<Node>& nodes,
+                                      unsigned threads) {
+  for(size_t i = 0; i < nodes.size(); ++i) {
+    convertAndAssert(nodes[i], false, false, RULE_GIVEN);
+  }
+}
+
 void CnfStream::assertClause(TNode node, SatLiteral a) {
   SatClause clause(1);
   clause[0] = a;
@@ -748,5 +762,452 @@ void TseitinCnfStream::convertAndAssert(TNode node, bool negated) {
   }
 }
 
+class TseitinCnfStream::BatchStatistics {
+ public:
+  /** Time spent encoding the formulas (in parallel) */
+  TimerStat d_encodeTime;
+  /** Time spent merging the encodings (on the calling thread) */
+  TimerStat d_mergeTime;
+  /** Number of formulas converted in parallel */
+  IntStat d_parallelFormulas;
+  /** Number of formulas that had to be converted on the calling thread */
+  IntStat d_serialFormulas;
+
+  BatchStatistics(const std::string& name)
+      : d_encodeTime("prop::CnfStream" + name + "::batchEncodeTime"),
+        d_mergeTime("prop::CnfStream" + name + "::batchMergeTime"),
+        d_parallelFormulas("prop::CnfStream" + name + "::batchParallel", 0),
+        d_serialFormulas("prop::CnfStream" + name + "::batchSerial", 0) {
+    smtStatisticsRegistry()->registerStat(&d_encodeTime);
+    smtStatisticsRegistry()->registerStat(&d_mergeTime);
+    smtStatisticsRegistry()->registerStat(&d_parallelFormulas);
+    smtStatisticsRegistry()->registerStat(&d_serialFormulas);
+  }
+
+  ~BatchStatistics() {
+    smtStatisticsRegistry()->unregisterStat(&d_encodeTime);
+    smtStatisticsRegistry()->unregisterStat(&d_mergeTime);
+    smtStatisticsRegistry()->unregisterStat(&d_parallelFormulas);
+    smtStatisticsRegistry()->unregisterStat(&d_serialFormulas);
+  }
+};/* class TseitinCnfStream::BatchStatistics */
+
+/**
+ * The Tseitin encoding of one formula, over local literals: a local
+ * literal is twice the index of an entry of d_entries, plus one if it
+ * is negated.  d_events replays the conversion: a DEFINE event for
+ * each entry that the serial conversion would give a new literal, in
+ * the same order, and a CLAUSE event for each clause it would assert.
+ */
+struct TseitinCnfStream::LocalEncoding {
+  enum EntryKind {
+    /** Had a literal before the batch started */
+    PREDEFINED,
+    /** Converted by convertAtom() */
+    ATOM,
+    /** A Boolean connective, given a literal by newLiteral() */
+    GATE
+  };
+
+  struct Entry {
+    TNode d_node;
+    EntryKind d_kind;
+    /** The literal, for PREDEFINED entries */
+    SatLiteral d_literal;
+  };
+
+  /** Event tags, in the low two bits of an event word */
+  static const uint32_t DEFINE = 1;
+  static const uint32_t CLAUSE = 2;
+
+  std::vector<Entry> d_entries;
+
+  /**
+   * DEFINE events are one word, (entry << 2) | DEFINE.  CLAUSE events
+   * are (size << 2) | CLAUSE, then the entry defined by the clause plus
+   * one (or 0 and the index in d_formulas, for clauses of the formula
+   * itself), then the literals.
+   */
+  std::vector<uint32_t> d_events;
+
+  /**
+   * The (sub)formulas encodeAssertion() was called on, and whether they
+   * were negated; the clauses asserting one are given the formula (or
+   * its negation) as convertAndAssert() gives them
+   */
+  std::vector<std::pair<TNode, bool> > d_formulas;
+
+  /** Local literals of the non-negation subformulas already encoded */
+  std::unordered_map<TNode, uint32_t, TNodeHashFunction> d_cache;
+
+  /** The number of convertAndAssert() calls the conversion makes */
+  unsigned d_calls;
+
+  /**
+   * Set if the formula can't be encoded off the calling thread, in
+   * which case it is converted normally instead.
+   */
+  bool d_serial;
+
+  /** The NodeManager, for reading cached types */
+  NodeManager* d_nm;
+
+  LocalEncoding() : d_calls(0), d_serial(false), d_nm(NULL) {}
+
+  uint32_t addEntry(TNode node, EntryKind kind,
+                    SatLiteral literal = SatLiteral()) {
+    Entry e = { node, kind, literal };
+    d_entries.push_back(e);
+    uint32_t lit = 2 * (d_entries.size() - 1);
+    d_cache[node] = lit;
+    if(kind != PREDEFINED) {
+      d_events.push_back(((d_entries.size() - 1) << 2) | DEFINE);
+    }
+    return lit;
+  }
+
+  /** Add a clause defining the entry of the literal owner */
+  void addClause(uint32_t owner, const std::vector<uint32_t>& lits) {
+    d_events.push_back((uint32_t(lits.size()) << 2) | CLAUSE);
+    if(owner == uint32_t(-1)) {
+      // a clause of the formula encodeAssertion() is at
+      d_events.push_back(0);
+      d_events.push_back(d_formulas.size() - 1);
+    } else {
+      d_events.push_back(owner / 2 + 1);
+    }
+    d_events.insert(d_events.end(), lits.begin(), lits.end());
+  }
+
+  void addClause(uint32_t owner, uint32_t a, uint32_t b) {
+    std::vector<uint32_t> lits(2);
+    lits[0] = a;
+    lits[1] = b;
+    addClause(owner, lits);
+  }
+
+  void addClause(uint32_t owner, uint32_t a, uint32_t b, uint32_t c) {
+    std::vector<uint32_t> lits(3);
+    lits[0] = a;
+    lits[1] = b;
+    lits[2] = c;
+    addClause(owner, lits);
+  }
+
+  /**
+   * Whether node (an EQUAL) is a Boolean equivalence.  Only cached
+   * types can be read here; if the type isn't known, the formula is
+   * left to the calling thread.
+   */
+  bool isIff(TNode node) {
+    TypeNode type;
+    if(!d_nm->getAttribute(node[0], expr::TypeAttr(), type)) {
+      d_serial = true;
+      return false;
+    }
+    return type.isBoolean();
+  }
+};/* struct TseitinCnfStream::LocalEncoding */
+
+/** Marks a clause of the formula itself (rather than of a definition) */
+static const uint32_t NO_OWNER = uint32_t(-1);
+
+uint32_t TseitinCnfStream::encodeLiteral(TNode node, bool negated,
+                                         LocalEncoding& enc) const {
+  if(enc.d_serial) {
+    return 0;
+  }
+  uint32_t lit;
+  std::unordered_map<TNode, uint32_t, TNodeHashFunction>::const_iterator
+    find = enc.d_cache.find(node);
+  NodeToLiteralMap::const_iterator global;
+  if(find != enc.d_cache.end()) {
+    lit = (*find).second;
+  } else if((global = d_nodeToLiteralMap.find(node))
+            != d_nodeToLiteralMap.end()) {
+    lit = enc.addEntry(node, LocalEncoding::PREDEFINED, (*global).second);
+  } else {
+    // Mirrors toCNF() and the handleX() functions
+    std::vector<uint32_t> clause;
+    Kind k = node.getKind();
+    if(k == EQUAL && !enc.isIff(node)) {
+      k = UNDEFINED_KIND;
+    }
+    if(enc.d_serial) {
+      return 0;
+    }
+    switch(k) {
+    case NOT:
+      lit = encodeLiteral(node[0], true, enc);
+      break;
+    case XOR: {
+      uint32_t a = encodeLiteral(node[0], false, enc);
+      uint32_t b = encodeLiteral(node[1], false, enc);
+      lit = enc.addEntry(node, LocalEncoding::GATE);
+      enc.addClause(lit, a, b, lit ^ 1);
+      enc.addClause(lit, a ^ 1, b ^ 1, lit ^ 1);
+      enc.addClause(lit, a, b ^ 1, lit);
+      enc.addClause(lit, a ^ 1, b, lit);
+      break;
+    }
+    case ITE: {
+      uint32_t c = encodeLiteral(node[0], false, enc);
+      uint32_t t = encodeLiteral(node[1], false, enc);
+      uint32_t e = encodeLiteral(node[2], false, enc);
+      lit = enc.addEntry(node, LocalEncoding::GATE);
+      enc.addClause(lit, lit ^ 1, t, e);
+      enc.addClause(lit, lit ^ 1, c ^ 1, t);
+      enc.addClause(lit, lit ^ 1, c, e);
+      enc.addClause(lit, lit, t ^ 1, e ^ 1);
+      enc.addClause(lit, lit, c ^ 1, t ^ 1);
+      enc.addClause(lit, lit, c, e ^ 1);
+      break;
+    }
+    case IMPLIES: {
+      uint32_t a = encodeLiteral(node[0], false, enc);
+      uint32_t b = encodeLiteral(node[1], false, enc);
+      lit = enc.addEntry(node, LocalEncoding::GATE);
+      enc.addClause(lit, lit ^ 1, a ^ 1, b);
+      enc.addClause(lit, a, lit);
+      enc.addClause(lit, b ^ 1, lit);
+      break;
+    }
+    case EQUAL: {
+      uint32_t a = encodeLiteral(node[0], false, enc);
+      uint32_t b = encodeLiteral(node[1], false, enc);
+      lit = enc.addEntry(node, LocalEncoding::GATE);
+      enc.addClause(lit, a ^ 1, b, lit ^ 1);
+      enc.addClause(lit, a, b ^ 1, lit ^ 1);
+      enc.addClause(lit, a ^ 1, b ^ 1, lit);
+      enc.addClause(lit, a, b, lit);
+      break;
+    }
+    case OR:
+    case AND: {
+      // an AND is encoded as the OR of the negated children, negated
+      uint32_t flip = k == AND ? 1 : 0;
+      for(TNode::const_iterator i = node.begin(); i != node.end(); ++i) {
+        clause.push_back(encodeLiteral(*i, false, enc) ^ flip);
+      }
+      lit = enc.addEntry(node, LocalEncoding::GATE);
+      uint32_t gateLit = lit ^ flip;
+      for(size_t i = 0; i < clause.size(); ++i) {
+        enc.addClause(lit, gateLit, clause[i] ^ 1);
+      }
+      clause.push_back(gateLit ^ 1);
+      enc.addClause(lit, clause);
+      break;
+    }
+    default:
+      lit = enc.addEntry(node, LocalEncoding::ATOM);
+      break;
+    }
+  }
+  return negated ? lit ^ 1 : lit;
+}
+
+void TseitinCnfStream::encodeAssertion(TNode node, bool negated,
+                                       LocalEncoding& enc) const {
+  if(enc.d_serial) {
+    return;
+  }
+  ++enc.d_calls;
+  enc.d_formulas.push_back(std::make_pair(node, negated));
+  // Mirrors convertAndAssert() and the convertAndAssertX() functions
+  std::vector<uint32_t> clause;
+  Kind k = node.getKind();
+  if(k == EQUAL && !enc.isIff(node)) {
+    k = UNDEFINED_KIND;
+  }
+  switch(k) {
+  case AND:
+  case OR:
+    if((k == AND) != negated) {
+      // a conjunction: assert each conjunct separately
+      for(TNode::const_iterator i = node.begin(); i != node.end(); ++i) {
+        encodeAssertion(*i, negated, enc);
+      }
+    } else {
+      for(TNode::const_iterator i = node.begin(); i != node.end(); ++i) {
+        clause.push_back(encodeLiteral(*i, negated, enc));
+      }
+      enc.addClause(NO_OWNER, clause);
+    }
+    break;
+  case XOR:
+  case EQUAL: {
+    uint32_t p = encodeLiteral(node[0], false, enc);
+    uint32_t q = encodeLiteral(node[1], false, enc);
+    if((k == XOR) != negated) {
+      enc.addClause(NO_OWNER, p ^ 1, q ^ 1);
+      enc.addClause(NO_OWNER, p, q);
+    } else {
+      enc.addClause(NO_OWNER, p ^ 1, q);
+      enc.addClause(NO_OWNER, p, q ^ 1);
+    }
+    break;
+  }
+  case IMPLIES:
+    if(!negated) {
+      uint32_t p = encodeLiteral(node[0], false, enc);
+      uint32_t q = encodeLiteral(node[1], false, enc);
+      enc.addClause(NO_OWNER, p ^ 1, q);
+    } else {
+      encodeAssertion(node[0], false, enc);
+      encodeAssertion(node[1], true, enc);
+    }
+    break;
+  case ITE: {
+    uint32_t p = encodeLiteral(node[0], false, enc);
+    uint32_t q = encodeLiteral(node[1], negated, enc);
+    uint32_t r = encodeLiteral(node[2], negated, enc);
+    enc.addClause(NO_OWNER, p ^ 1, q);
+    enc.addClause(NO_OWNER, p, r);
+    break;
+  }
+  case NOT:
+    encodeAssertion(node[0], !negated, enc);
+    break;
+  default:
+    clause.push_back(encodeLiteral(node, negated, enc));
+    enc.addClause(NO_OWNER, clause);
+    break;
+  }
+}
+
+void TseitinCnfStream::mergeEncoding(const LocalEncoding& enc) {
+  Assert(!enc.d_serial);
+  d_removable = false;
+  for(unsigned i = 0; i < enc.d_calls; ++i) {
+    if (d_convertAndAssertCounter % ResourceManager::getFrequencyCount() == 0) {
+      NodeManager::currentResourceManager()->spendResource(options::cnfStep());
+      d_convertAndAssertCounter = 0;
+    }
+    ++d_convertAndAssertCounter;
+  }
+
+  std::vector<SatLiteral> literals(enc.d_entries.size());
+  // entries that already had a literal when they came up: their
+  // definitions were asserted then
+  std::vector<bool> defined(enc.d_entries.size(), false);
+  for(size_t e = 0; e < enc.d_entries.size(); ++e) {
+    if(enc.d_entries[e].d_kind == LocalEncoding::PREDEFINED) {
+      literals[e] = enc.d_entries[e].d_literal;
+      defined[e] = true;
+    }
+  }
+
+  const std::vector<uint32_t>& events = enc.d_events;
+  for(size_t i = 0; i < events.size();) {
+    uint32_t word = events[i++];
+    if((word & 3) == LocalEncoding::DEFINE) {
+      size_t e = word >> 2;
+      const LocalEncoding::Entry& entry = enc.d_entries[e];
+      if(hasLiteral(entry.d_node)) {
+        // defined by an earlier formula (or a lemma) of the batch
+        literals[e] = getLiteral(entry.d_node);
+        defined[e] = true;
+      } else if(entry.d_kind == LocalEncoding::ATOM) {
+        literals[e] = convertAtom(entry.d_node);
+      } else {
+        literals[e] = newLiteral(entry.d_node);
+      }
+    } else {
+      Assert((word & 3) == LocalEncoding::CLAUSE);
+      size_t size = word >> 2;
+      uint32_t owner = events[i++];
+      // the node convertAndAssert() would give the clause: the asserted
+      // formula, or the definition, with the polarity it is asserted in
+      TNode source;
+      bool negated = false;
+      if(owner == 0) {
+        const std::pair<TNode, bool>& formula = enc.d_formulas[events[i++]];
+        source = formula.first;
+        negated = formula.second;
+      } else if(!defined[owner - 1]) {
+        source = enc.d_entries[owner - 1].d_node;
+        // the clauses with the negated gate literal are the ones of the
+        // negated definition
+        for(size_t j = 0; j < size; ++j) {
+          if(events[i + j] == 2 * (owner - 1) + 1) {
+            negated = true;
+          }
+        }
+      }
+      if(!source.isNull()) {
+        SatClause clause(size);
+        for(size_t j = 0; j < size; ++j) {
+          uint32_t lit = events[i + j];
+          clause[j] = (lit & 1) ? ~literals[lit >> 1] : literals[lit >> 1];
+        }
+        if(negated) {
+          assertClause(source.negate(), clause);
+        } else {
+          assertClause(source, clause);
+        }
+      }
+      i += size;
+    }
+  }
+}
+
+void TseitinCnfStream::convertAndAssertBatch(const std::vector<Node>& nodes,
+                                             unsigned threads) {
+  if(threads <= 1 || nodes.size() < 2 || d_cnfProof != NULL
+     || !NodeManager::supportsConcurrentAccess()) {
+    CnfStream::convertAndAssertBatch(nodes, threads);
+    return;
+  }
+  if(!d_batchStatistics) {
+    d_batchStatistics.reset(new BatchStatistics(d_name));
+  }
+  Debug("cnf") << "convertAndAssertBatch(" << nodes.size() << " formulas, "
+               << threads << " threads)" << endl;
+
+  NodeManager* nm = NodeManager::currentNM();
+  std::vector<LocalEncoding> encodings(nodes.size());
+  {
+    TimerStat::CodeTimer codeTimer(d_batchStatistics->d_encodeTime);
+    // The workers copy Nodes (when looking up the translation cache and
+    // cached types), so reference counts must be atomic meanwhile
+    nm->setConcurrentAccess(true);
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for(unsigned t = 1; t < threads && t < nodes.size(); ++t) {
+      workers.push_back(std::thread([&]() {
+        NodeManagerScope nms(nm);
+        for(size_t i; (i = next.fetch_add(1)) < nodes.size();) {
+          encodings[i].d_nm = nm;
+          encodeAssertion(nodes[i], false, encodings[i]);
+        }
+      }));
+    }
+    for(size_t i; (i = next.fetch_add(1)) < nodes.size();) {
+      encodings[i].d_nm = nm;
+      encodeAssertion(nodes[i], false, encodings[i]);
+    }
+    for(size_t t = 0; t < workers.size(); ++t) {
+      workers[t].join();
+    }
+    nm->setConcurrentAccess(false);
+  }
+
+  TimerStat::CodeTimer codeTimer(d_batchStatistics->d_mergeTime);
+  for(size_t i = 0; i < nodes.size(); ++i) {
+    if(encodings[i].d_serial) {
+      ++d_batchStatistics->d_serialFormulas;
+      convertAndAssert(nodes[i], false, false, RULE_GIVEN);
+    } else {
+      ++d_batchStatistics->d_parallelFormulas;
+      mergeEncoding(encodings[i]);
+    }
+    // release the memory as we go
+    LocalEncoding().d_entries.swap(encodings[i].d_entries);
+    LocalEncoding().d_events.swap(encodings[i].d_events);
+    LocalEncoding().d_cache.swap(encodings[i].d_cache);
+    LocalEncoding().d_formulas.swap(encodings[i].d_formulas);
+  }
+}
+
 }/* CVC4::prop namespace */
 }/* CVC4 namespace */
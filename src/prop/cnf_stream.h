@@ -25,6 +25,9 @@
 #ifndef __CVC4__PROP__CNF_STREAM_H
 #define __CVC4__PROP__CNF_STREAM_H
 
+#include <memory>
+#include <vector>
+
 #include "context/cdinsert_hashmap.h"
 #include "context/cdlist.h"
 #include "expr/node.h"
@@ -211,6 +214,17 @@ class CnfStream {
                                 ProofRule proof_id,
                                 TNode from = TNode::null()) = 0;
 
+  /**
+   * Converts and asserts a batch of input formulas, with the same
+   * effect as convertAndAssert(node, false, false, RULE_GIVEN) on each
+   * of them in order.  Implementations may use up to the given number
+   * of threads; this one converts them one by one.
+   * @param nodes the formulas to convert and assert
+   * @param threads the number of threads to use
+   */
+  virtual void convertAndAssertBatch(const std::vector<Node>& nodes,
+                                     unsigned threads);
+
   /**
    * Get the node that is represented by the given SatLiteral.
    * @param literal the literal from the sat solver
@@ -280,6 +294,8 @@ class TseitinCnfStream : public CnfStream {
                    context::Context* context, bool fullLitToNodeMap = false,
                    std::string name = "");
 
+  ~TseitinCnfStream();
+
   /**
    * Convert a given formula to CNF and assert it to the SAT solver.
    * @param node the formula to assert
@@ -292,7 +308,43 @@ class TseitinCnfStream : public CnfStream {
                         ProofRule rule,
                         TNode from = TNode::null()) override;
 
+  /**
+   * Converts and asserts a batch of input formulas.  With more than
+   * one thread, the Tseitin encoding of each formula is computed on
+   * its own, in parallel, against a snapshot of the translation cache.
+   * The encodings are then merged in order on the calling thread,
+   * which creates the SAT variables and asserts the clauses.  Sub-
+   * formulas encoded by several formulas only keep their first
+   * definition, so the variables and clauses are the same as if the
+   * formulas had been converted one by one.
+   */
+  void convertAndAssertBatch(const std::vector<Node>& nodes,
+                             unsigned threads) override;
+
  private:
+  /** The encoding of a formula computed by convertAndAssertBatch(). */
+  struct LocalEncoding;
+
+  /** Statistics of convertAndAssertBatch(); created on first use. */
+  class BatchStatistics;
+  std::unique_ptr<BatchStatistics> d_batchStatistics;
+
+  /**
+   * Compute the encoding of asserting node (negated, if so) into enc.
+   * This runs on a worker thread, so it only reads Nodes and the
+   * translation cache.
+   */
+  void encodeAssertion(TNode node, bool negated, LocalEncoding& enc) const;
+
+  /**
+   * Compute the encoding of node into enc, as toCNF() would, and
+   * return its local literal.
+   */
+  uint32_t encodeLiteral(TNode node, bool negated, LocalEncoding& enc) const;
+
+  /** Create the variables and assert the clauses of enc. */
+  void mergeEncoding(const LocalEncoding& enc);
+
   /**
    * Same as above, except that removable is remembered.
    */
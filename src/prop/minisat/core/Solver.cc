@@ -127,11 +127,26 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy, CVC4::context::Context* context,
     //
   , learntsize_adjust_start_confl (100)
   , learntsize_adjust_inc         (1.5)
+  , lbd_tiers                     (false)
+  , lbd_core                      (2)
+  , lbd_tier2                     (6)
+  , reduce_first                  (2000)
+  , reduce_inc                    (300)
+  , ema_restart                   (false)
+  , ema_restart_margin            (0.8)
+  , ema_restart_min               (50)
+  , inprocessing                  (false)
+  , inprocess_first               (5000)
+  , inprocess_inc                 (5000)
+  , vivify_effort                 (0.1)
 
     // Statistics: (formerly in 'SolverStats')
     //
   , solves(0), starts(0), decisions(0), rnd_decisions(0), propagations(0), conflicts(0), resources_consumed(0)
   , dec_vars(0), clauses_literals(0), learnts_literals(0), max_literals(0), tot_literals(0)
+  , inprocessings(0), vivified_lits(0), subsumed_removable(0)
+  , imported_lemmas(0), imported_lemmas_used(0)
+  , importing_lemmas(false)
 
   , ok                 (true)
   , cla_inc            (1)
@@ -143,6 +158,13 @@ Solver::Solver(CVC4::prop::TheoryProxy* proxy, CVC4::context::Context* context,
   , order_heap         (VarOrderLt(activity))
   , progress_estimate  (0)
   , remove_satisfied   (!enable_incremental)
+  , lbd_stamp_counter  (0)
+  , reductions         (0)
+  , next_reduce        (0)
+  , lbd_ema_fast       (1.0 / 32)
+  , lbd_ema_slow       (1e-4)
+  , next_inprocess     (0)
+  , inprocess_props    (0)
 
     // Resource constraints:
     //
@@ -393,6 +415,7 @@ bool Solver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
       lemmas.push();
       ps.copyTo(lemmas.last());
       lemmas_removable.push(removable);
+      lemmas_imported.push(importing_lemmas);
       PROOF(
             // Store the expression being converted to CNF until
             // the clause is actually created
@@ -436,6 +459,10 @@ bool Solver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
         cr = ca.alloc(clauseLevel, ps, false);
         clauses_persistent.push(cr);
 	attachClause(cr);
+        if (importing_lemmas) {
+          ca[cr].setImported(true);
+          imported_lemmas++;
+        }
 
         if(PROOF_ON()) {
           PROOF(
@@ -538,14 +565,14 @@ bool Solver::satisfied(const Clause& c) const {
 
 // Revert to the state at given level (keeping all assignment at 'level' but not beyond).
 //
-void Solver::cancelUntil(int level) {
+void Solver::cancelUntil(int level, bool dumpState) {
     Debug("minisat") << "minisat::cancelUntil(" << level << ")" << std::endl;
 
     if (decisionLevel() > level){
         // Pop the SMT context
         for (int l = trail_lim.size() - level; l > 0; --l) {
           context->pop();
-          if(Dump.isOn("state")) {
+          if(dumpState && Dump.isOn("state")) {
             proxy->dumpStatePop();
           }
         }
@@ -707,7 +734,14 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
           Clause& c = ca[confl];
           max_resolution_level = std::max(max_resolution_level, c.level());
 
-          if (c.removable()) claBumpActivity(c);
+          if (c.removable()) {
+            claBumpActivity(c);
+            if (lbd_tiers) claUpdateLBD(c);
+          }
+          if (c.imported()) {
+            c.setImported(false);
+            imported_lemmas_used++;
+          }
         }
 
         for (int j = (p == lit_Undef) ? 0 : 1, size = ca[confl].size();
@@ -1122,6 +1156,10 @@ CRef Solver::propagateBool()
 |  Description:
 |    Remove half of the learnt clauses, minus the clauses locked by the current assignment. Locked
 |    clauses are clauses that are reason to some assignment. Binary clauses are never removed.
+|
+|    In LBD mode (see 'lbd_tiers'), core clauses are never removed, tier-2 clauses that were not
+|    used in conflict analysis since the last reduction are demoted to the local tier, and half of
+|    the local clauses are removed, by activity, minus the locked and recently used ones.
 |________________________________________________________________________________________________@*/
 struct reduceDB_lt {
     ClauseAllocator& ca;
@@ -1131,6 +1169,11 @@ struct reduceDB_lt {
 };
 void Solver::reduceDB()
 {
+    if (lbd_tiers) {
+        reduceDBTiered();
+        return;
+    }
+
     int     i, j;
     double  extra_lim = cla_inc / clauses_removable.size();    // Remove any clause below this activity
 
@@ -1148,6 +1191,44 @@ void Solver::reduceDB()
     checkGarbage();
 }
 
+struct reduceDBTiered_lt {
+    ClauseAllocator& ca;
+    reduceDBTiered_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    static bool reducible(const Clause& c) { return c.tier() == tier_Local && c.size() > 2; }
+    bool operator () (CRef x, CRef y) {
+        return reducible(ca[x]) && (!reducible(ca[y]) || ca[x].activity() < ca[y].activity()); }
+};
+void Solver::reduceDBTiered()
+{
+    int     i, j;
+    int     nof_reducible = 0;
+
+    for (i = 0; i < clauses_removable.size(); i++){
+        Clause& c = ca[clauses_removable[i]];
+        if (c.tier() == tier_Tier2 && !c.used())
+            c.setTier(tier_Local);
+        if (reduceDBTiered_lt::reducible(c))
+            nof_reducible++;
+    }
+
+    // The reducible clauses come first, by increasing activity. Delete the unlocked and unused
+    // ones from the first half of them:
+    sort(clauses_removable, reduceDBTiered_lt(ca));
+    for (i = j = 0; i < clauses_removable.size(); i++){
+        Clause& c = ca[clauses_removable[i]];
+        if (i < nof_reducible / 2 && !c.used() && !locked(c))
+            removeClause(clauses_removable[i]);
+        else{
+            c.setUsed(false);
+            clauses_removable[j++] = clauses_removable[i]; }
+    }
+    clauses_removable.shrink(i - j);
+
+    reductions++;
+    scheduleReduce();
+    checkGarbage();
+}
+
 
 void Solver::removeSatisfied(vec<CRef>& cs)
 {
@@ -1224,6 +1305,203 @@ bool Solver::simplify()
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  inprocess : [void]  ->  [bool]
+|
+|  Description:
+|    Simplify the clause database between two restarts: remove the satisfied and subsumed removable
+|    clauses, and vivify the most useful ones. Only Boolean propagation is used, the theories are
+|    not involved. Removable clauses are the only ones changed here (see SimpSolver for variable
+|    elimination). Returns FALSE if the problem was found to be unsatisfiable.
+|________________________________________________________________________________________________@*/
+bool Solver::inprocess()
+{
+    assert(decisionLevel() == 0);
+    Debug("minisat::inprocess") << "Solver::inprocess(): " << clauses_removable.size() << " removable clauses" << std::endl;
+
+    inprocessings++;
+    if (!simplify())
+        return false;
+
+    subsumeRemovable();
+    if (!vivifyRemovable())
+        return false;
+
+    scheduleInprocess();
+    inprocess_props = propagations;
+    return true;
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  subsumeRemovable : [void]  ->  [void]
+|
+|  Description:
+|    Remove the removable clauses subsumed by other removable clauses (from the same or a lower user
+|    level). This also removes the duplicates of theory lemmas that were re-added after removal.
+|    Clauses are checked by increasing size, against the clauses kept so far, each of which is in
+|    the occurrence list of just one of its literals.
+|________________________________________________________________________________________________@*/
+struct subsumeRemovable_lt {
+    ClauseAllocator& ca;
+    subsumeRemovable_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    bool operator () (CRef x, CRef y) { return ca[x].size() < ca[y].size(); }
+};
+void Solver::subsumeRemovable()
+{
+    vec<CRef> cands;
+    clauses_removable.copyTo(cands);
+    sort(cands, subsumeRemovable_lt(ca));
+
+    vec<vec<CRef> > occs;
+    occs.growTo(2 * nVars());
+    for (int i = 0; i < cands.size(); i++){
+        Clause& c = ca[cands[i]];
+        for (int k = 0; k < c.size(); k++)
+            seen[var(c[k])] = sign(c[k]) ? 2 : 1;
+
+        // Look for a kept clause all the literals of which are marked:
+        int best = 0;
+        Clause* subsumer = NULL;
+        for (int k = 0; k < c.size() && subsumer == NULL; k++){
+            const vec<CRef>& os = occs[toInt(c[k])];
+            if (os.size() < occs[toInt(c[best])].size())
+                best = k;
+            for (int o = 0; o < os.size(); o++){
+                Clause& d = ca[os[o]];
+                if (d.level() > c.level())
+                    continue;
+                int l = 0;
+                while (l < d.size() && seen[var(d[l])] == (sign(d[l]) ? 2 : 1))
+                    l++;
+                if (l == d.size()){
+                    subsumer = &d;
+                    break; }
+            }
+        }
+
+        for (int k = 0; k < c.size(); k++)
+            seen[var(c[k])] = 0;
+
+        if (subsumer != NULL && !locked(c)){
+            if (c.tier() < subsumer->tier())
+                subsumer->setTier(c.tier());
+            subsumed_removable++;
+            removeClause(cands[i]);
+        }else
+            occs[toInt(c[best])].push(cands[i]);
+    }
+
+    int i, j;
+    for (i = j = 0; i < clauses_removable.size(); i++)
+        if (ca[clauses_removable[i]].mark() != 1)
+            clauses_removable[j++] = clauses_removable[i];
+    clauses_removable.shrink(i - j);
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  vivifyRemovable : [void]  ->  [bool]
+|
+|  Description:
+|    Shorten removable clauses by asserting the negation of their literals one by one, each at a new
+|    decision level: a literal that is then false can be removed, and a conflict, or a literal that
+|    is then true, makes the remaining literals redundant. The clause itself may take part in the
+|    propagation, as it is implied by the clause database. The shortened clauses belong to the
+|    current user level, the highest level of the clauses that may have been used.
+|
+|    Each clause is vivified once, the core and tier-2 clauses first, by decreasing activity, for a
+|    number of propagations relative to the search since the last inprocessing. Returns FALSE if
+|    the problem was found to be unsatisfiable.
+|________________________________________________________________________________________________@*/
+struct vivifyRemovable_lt {
+    ClauseAllocator& ca;
+    vivifyRemovable_lt(ClauseAllocator& ca_) : ca(ca_) {}
+    bool operator () (CRef x, CRef y) {
+        return ca[x].tier() < ca[y].tier() || (ca[x].tier() == ca[y].tier() && ca[x].activity() > ca[y].activity()); }
+};
+bool Solver::vivifyRemovable()
+{
+    assert(decisionLevel() == 0);
+
+    vec<CRef> cands;
+    for (int i = 0; i < clauses_removable.size(); i++){
+        const Clause& c = ca[clauses_removable[i]];
+        if (c.size() > 2 && !c.vivified())
+            cands.push(clauses_removable[i]);
+    }
+    sort(cands, vivifyRemovable_lt(ca));
+
+    uint64_t limit = propagations + (uint64_t)((propagations - inprocess_props) * vivify_effort);
+    vec<Lit> lits, shortened;
+    for (int i = 0; i < cands.size() && propagations < limit; i++){
+        CRef    cr = cands[i];
+        Clause& c  = ca[cr];
+        if (c.mark() != 0 || locked(c) || satisfied(c))
+            continue;
+        c.setVivified(true);
+        lits.clear();
+        for (int k = 0; k < c.size(); k++)
+            lits.push(c[k]);
+
+        shortened.clear();
+        for (int k = 0; k < lits.size(); k++){
+            Lit p = lits[k];
+            if (value(p) == l_True){
+                shortened.push(p);
+                break; }
+            if (value(p) == l_False)
+                continue;
+            shortened.push(p);
+            if (k == lits.size() - 1)
+                break;
+            // Probing levels are not decisions, so keep them out of the
+            // state dump.
+            newDecisionLevel(false);
+            uncheckedEnqueue(~p);
+            if (propagateBool() != CRef_Undef)
+                break;
+        }
+        cancelUntil(0, false);
+
+        if (shortened.size() == lits.size())
+            continue;
+        vivified_lits += lits.size() - shortened.size();
+        Debug("minisat::inprocess") << "Solver::vivifyRemovable(): " << lits.size() << " to " << shortened.size() << " literals" << std::endl;
+
+        if (shortened.size() == 1){
+            removeClause(cr);
+            uncheckedEnqueue(shortened[0]);
+            if (propagateBool() != CRef_Undef)
+                return ok = false;
+        }else{
+            float    act = c.activity();
+            unsigned lbd = std::min(c.lbd(), (unsigned)shortened.size());
+            removeClause(cr);
+            CRef ncr = ca.alloc(assertionLevel, shortened, true);
+            Clause& nc = ca[ncr];
+            nc.activity() = act;
+            nc.setLbd(lbd);
+            nc.setTier(lbd_tiers ? tierOf(lbd) : tier_Local);
+            nc.setVivified(true);
+            clauses_removable.push(ncr);
+            attachClause(ncr);
+        }
+    }
+
+    int i, j;
+    for (i = j = 0; i < clauses_removable.size(); i++)
+        if (ca[clauses_removable[i]].mark() != 1)
+            clauses_removable[j++] = clauses_removable[i];
+    clauses_removable.shrink(i - j);
+    checkGarbage();
+    return true;
+}
+
+
 /*_________________________________________________________________________________________________
 |
 |  search : (nof_conflicts : int) (params : const SearchParams&)  ->  [lbool]
@@ -1264,6 +1542,12 @@ lbool Solver::search(int nof_conflicts)
             // Analyze the conflict
             learnt_clause.clear();
             int max_level = analyze(confl, learnt_clause, backtrack_level);
+            unsigned lbd = 0;
+            if (lbd_tiers || ema_restart) {
+                lbd = computeLBD(learnt_clause);
+                lbd_ema_fast.update(lbd);
+                lbd_ema_slow.update(lbd);
+            }
             cancelUntil(backtrack_level);
 
             // Assert the conflict clause and the asserting literal
@@ -1280,6 +1564,10 @@ lbool Solver::search(int nof_conflicts)
               clauses_removable.push(cr);
               attachClause(cr);
               claBumpActivity(ca[cr]);
+              if (lbd_tiers) {
+                ca[cr].setLbd(lbd);
+                ca[cr].setTier(tierOf(lbd));
+              }
               uncheckedEnqueue(learnt_clause[0], cr);
               PROOF(ClauseId id =
                         ProofManager::getSatProof()->registerClause(cr, LEARNT);
@@ -1335,6 +1623,7 @@ lbool Solver::search(int nof_conflicts)
             }
 
             if (nof_conflicts >= 0 && conflictC >= nof_conflicts ||
+                emaRestartDue(conflictC) ||
                 !withinBudget(options::satConflictStep())) {
                 // Reached bound on number of conflicts:
                 progress_estimate = progressEstimate();
@@ -1350,7 +1639,8 @@ lbool Solver::search(int nof_conflicts)
                 return l_False;
             }
 
-            if (clauses_removable.size()-nAssigns() >= max_learnts) {
+            if (lbd_tiers ? conflicts >= next_reduce
+                          : clauses_removable.size()-nAssigns() >= max_learnts) {
                 // Reduce the set of learnt clauses:
                 reduceDB();
             }
@@ -1459,6 +1749,8 @@ lbool Solver::solve_()
     max_learnts               = nClauses() * learntsize_factor;
     learntsize_adjust_confl   = learntsize_adjust_start_confl;
     learntsize_adjust_cnt     = (int)learntsize_adjust_confl;
+    scheduleReduce();
+    scheduleInprocess();
     lbool   status            = l_Undef;
 
     if (verbosity >= 1){
@@ -1472,9 +1764,14 @@ lbool Solver::solve_()
     int curr_restarts = 0;
     while (status == l_Undef){
         double rest_base = luby_restart ? luby(restart_inc, curr_restarts) : pow(restart_inc, curr_restarts);
-        status = search(rest_base * restart_first);
+        // With LBD restarts, search restarts by itself (see 'emaRestartDue()')
+        status = search(ema_restart ? -1 : rest_base * restart_first);
         if (!withinBudget(options::satConflictStep())) break; // FIXME add restart option?
         curr_restarts++;
+
+        // Shortened and removed clauses have no resolution proofs
+        if (status == l_Undef && inprocessing && !PROOF_ON() && conflicts >= next_inprocess && !inprocess())
+            status = l_False;
     }
 
     if(!withinBudget(options::satConflictStep()))
@@ -1810,6 +2107,10 @@ CRef Solver::updateLemmas() {
       }
 
       lemma_ref = ca.alloc(clauseLevel, lemma, removable);
+      if (lemmas_imported[i]) {
+        ca[lemma_ref].setImported(true);
+        imported_lemmas++;
+      }
       PROOF
         (
          TNode cnf_assertion = lemmas_cnf_assertion[i].first;
@@ -1821,6 +2122,8 @@ CRef Solver::updateLemmas() {
          ProofManager::getCnfProof()->setClauseDefinition(id, cnf_def);
          );
       if (removable) {
+        // In LBD mode, removable lemmas start in the local tier and are
+        // promoted once they take part in conflicts
         clauses_removable.push(lemma_ref);
       } else {
         clauses_persistent.push(lemma_ref);
@@ -1865,6 +2168,7 @@ CRef Solver::updateLemmas() {
   lemmas.clear();
   lemmas_cnf_assertion.clear();
   lemmas_removable.clear();
+  lemmas_imported.clear();
 
   if (conflict != CRef_Undef) {
     theoryConflict = true;
@@ -1896,7 +2200,14 @@ void ClauseAllocator::reloc(CRef& cr,
   // Copy extra data-fields:
   // (This could be cleaned-up. Generalize Clause-constructor to be applicable here instead?)
   to[cr].mark(c.mark());
-  if (to[cr].removable())         to[cr].activity() = c.activity();
+  to[cr].setImported(c.imported());
+  if (to[cr].removable()) {
+    to[cr].activity() = c.activity();
+    to[cr].setLbd(c.lbd());
+    to[cr].setTier(c.tier());
+    to[cr].setUsed(c.used());
+    to[cr].setVivified(c.vivified());
+  }
   else if (to[cr].has_extra()) to[cr].calcAbstraction();
 }
 
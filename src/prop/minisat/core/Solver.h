@@ -23,6 +23,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "cvc4_private.h"
 
+#include <algorithm>
 #include <iosfwd>
 
 #include "base/output.h"
@@ -97,6 +98,9 @@ protected:
   /** Is the lemma removable */
   vec<bool> lemmas_removable;
 
+  /** Is the lemma imported from another portfolio thread */
+  vec<bool> lemmas_imported;
+
   /** Nodes being converted to CNF */
   std::vector< std::pair<CVC4::Node, CVC4::Node > >lemmas_cnf_assertion;
 
@@ -272,10 +276,30 @@ public:
     int       learntsize_adjust_start_confl;
     double    learntsize_adjust_inc;
 
+    bool      lbd_tiers;          // Keep removable clauses in tiers by LBD and reduce them on a conflict schedule. (default false)
+    unsigned  lbd_core;           // Removable clauses with an LBD up to this are never reduced.                  (default 2)
+    unsigned  lbd_tier2;          // Removable clauses with an LBD up to this are kept while they are used.       (default 6)
+    int       reduce_first;       // The number of conflicts before the first tiered reduction.                  (default 2000)
+    int       reduce_inc;         // The increase of the number of conflicts between tiered reductions.          (default 300)
+    bool      ema_restart;        // Restart on the LBD moving averages instead of the luby/geometric sequence.  (default false)
+    double    ema_restart_margin; // Restart when the fast LBD average times this exceeds the slow one.          (default 0.8)
+    int       ema_restart_min;    // The minimal number of conflicts between two LBD restarts.                   (default 50)
+    bool      inprocessing;       // Simplify the clause database between restarts (see 'inprocess()').          (default false)
+    int       inprocess_first;    // The number of conflicts before the first inprocessing.                      (default 5000)
+    int       inprocess_inc;      // The increase of the number of conflicts between inprocessings.              (default 5000)
+    double    vivify_effort;      // Vivification propagations, relative to the search propagations since the last inprocessing. (default 0.1)
+
     // Statistics: (read-only member variable)
     //
     uint64_t solves, starts, decisions, rnd_decisions, propagations, conflicts, resources_consumed;
     uint64_t dec_vars, clauses_literals, learnts_literals, max_literals, tot_literals;
+    uint64_t inprocessings, vivified_lits, subsumed_removable;
+    uint64_t imported_lemmas, imported_lemmas_used;
+
+    // Clauses added while set are lemmas imported from another portfolio thread; they are
+    // counted in imported_lemmas_used when they first take part in a conflict.
+    //
+    bool      importing_lemmas;
 
 protected:
 
@@ -317,6 +341,16 @@ protected:
         bool operator()(const Watcher& w) const { return ca[w.cref].mark() == 1; }
     };
 
+    // Exponential moving average. While fewer than 1/alpha values have been seen, it is the
+    // plain average of these values.
+    struct EMA {
+        double   value;
+        double   alpha;
+        uint64_t count;
+        EMA(double alpha) : value(0), alpha(alpha), count(0) {}
+        void update(double x) { count++; value += std::max(alpha, 1.0 / count) * (x - value); }
+    };
+
     struct VarOrderLt {
         const vec<double>&  activity;
         bool operator () (Var x, Var y) const { return activity[x] > activity[y]; }
@@ -378,6 +412,15 @@ protected:
     double              learntsize_adjust_confl;
     int                 learntsize_adjust_cnt;
 
+    vec<uint64_t>       lbd_stamp;          // For each decision level, the last LBD computation that counted it.
+    uint64_t            lbd_stamp_counter;
+    uint64_t            reductions;         // The number of tiered reductions so far.
+    uint64_t            next_reduce;        // The number of conflicts at which the next tiered reduction happens.
+    EMA                 lbd_ema_fast;       // Moving average of the LBD of the recent learnt clauses.
+    EMA                 lbd_ema_slow;       // Moving average of the LBD of all learnt clauses.
+    uint64_t            next_inprocess;     // The number of conflicts at which the next inprocessing happens.
+    uint64_t            inprocess_props;    // The number of propagations at the end of the last inprocessing.
+
     // Resource contraints:
     //
     int64_t             conflict_budget;    // -1 means no budget.
@@ -388,7 +431,7 @@ protected:
     //
     void     insertVarOrder   (Var x);                                                 // Insert a variable in the decision order priority queue.
     Lit      pickBranchLit    ();                                                      // Return the next decision variable.
-    void     newDecisionLevel ();                                                      // Begins a new decision level.
+    void     newDecisionLevel (bool dumpState = true);                                 // Begins a new decision level (dumping a push unless probing).
     void     uncheckedEnqueue (Lit p, CRef from = CRef_Undef);                         // Enqueue a literal. Assumes value of literal is undefined.
     bool     enqueue          (Lit p, CRef from = CRef_Undef);                         // Test if fact 'p' contradicts current state, enqueue otherwise.
     bool     theoryConflict;                                                           // Was the last conflict a theory conflict
@@ -397,13 +440,20 @@ protected:
     void     propagateTheory  ();                                                      // Perform Theory propagation.
     void     theoryCheck      (CVC4::theory::Theory::Effort effort);                   // Perform a theory satisfiability check. Adds lemmas.
     CRef     updateLemmas     ();                                                      // Add the lemmas, backtraking if necessary and return a conflict if there is one
-    void     cancelUntil      (int level);                                             // Backtrack until a certain level.
+    void     cancelUntil      (int level, bool dumpState = true);                      // Backtrack until a certain level (dumping the pops unless probing).
     int      analyze          (CRef confl, vec<Lit>& out_learnt, int& out_btlevel);    // (bt = backtrack)
     void     analyzeFinal     (Lit p, vec<Lit>& out_conflict);                         // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()') - true if p is redundant
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
+    void     reduceDBTiered   ();                                                      // Reduce the set of learnt clauses by LBD tiers.
+    void     scheduleReduce   ();                                                      // Set the conflict count of the next tiered reduction.
+    bool     emaRestartDue    (int nof_conflicts) const;                               // Should search restart, given the LBD moving averages.
+    virtual bool inprocess    ();                                                      // Simplify the clause database at level 0. Returns FALSE if unsatisfiable.
+    void     scheduleInprocess();                                                      // Set the conflict count of the next inprocessing.
+    bool     vivifyRemovable  ();                                                      // Shorten removable clauses by probing the negation of their literals.
+    void     subsumeRemovable ();                                                      // Remove the removable clauses subsumed by other removable clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
 
@@ -415,6 +465,13 @@ protected:
     void     claDecayActivity ();                      // Decay all clauses with the specified factor. Implemented by increasing the 'bump' value instead.
     void     claBumpActivity  (Clause& c);             // Increase a clause with the current 'bump' value.
 
+    // Maintaining the LBD of removable clauses:
+    //
+    template<class Lits>
+    unsigned computeLBD       (const Lits& c);         // The number of distinct decision levels of the literals of 'c'.
+    LearntTier tierOf         (unsigned lbd) const;    // The retention tier of a clause with the given LBD.
+    void     claUpdateLBD     (Clause& c);             // Mark a clause used in conflict analysis, and promote it if its LBD dropped.
+
     // Operations on clauses:
     //
     void     attachClause     (CRef cr);               // Attach a clause to watcher lists.
@@ -504,6 +561,35 @@ inline void Solver::claBumpActivity (Clause& c) {
                 ca[clauses_removable[i]].activity() *= 1e-20;
             cla_inc *= 1e-20; } }
 
+template<class Lits>
+inline unsigned Solver::computeLBD(const Lits& c) {
+    lbd_stamp_counter++;
+    unsigned lbd = 0;
+    for (int i = 0; i < c.size(); i++){
+        int l = level(var(c[i]));
+        if (l >= lbd_stamp.size()) lbd_stamp.growTo(l + 1, 0);
+        if (lbd_stamp[l] != lbd_stamp_counter){
+            lbd_stamp[l] = lbd_stamp_counter;
+            lbd++; } }
+    return lbd; }
+
+inline LearntTier Solver::tierOf(unsigned lbd) const {
+    return lbd <= lbd_core ? tier_Core : lbd <= lbd_tier2 ? tier_Tier2 : tier_Local; }
+
+inline void Solver::claUpdateLBD(Clause& c) {
+    c.setUsed(true);
+    if (c.tier() == tier_Core) return;
+    unsigned lbd = computeLBD(c);
+    if (lbd < c.lbd()){
+        c.setLbd(lbd);
+        if (tierOf(lbd) < c.tier()) c.setTier(tierOf(lbd)); } }
+
+inline void Solver::scheduleInprocess() { next_inprocess = conflicts + inprocess_first + inprocessings * inprocess_inc; }
+inline void Solver::scheduleReduce() { next_reduce = conflicts + reduce_first + reductions * reduce_inc; }
+inline bool Solver::emaRestartDue(int nof_conflicts) const {
+    return ema_restart && nof_conflicts >= ema_restart_min
+        && lbd_ema_fast.value * ema_restart_margin > lbd_ema_slow.value; }
+
 inline void Solver::checkGarbage(void){ return checkGarbage(garbage_frac); }
 inline void Solver::checkGarbage(double gf){
     if (ca.wasted() > ca.size() * gf)
@@ -521,7 +607,7 @@ inline bool     Solver::addClause       (Lit p, Lit q, bool removable, ClauseId&
 inline bool     Solver::addClause       (Lit p, Lit q, Lit r, bool removable, ClauseId& id)
                                                                 { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); return addClause_(add_tmp, removable, id); }
 inline bool     Solver::locked          (const Clause& c) const { return value(c[0]) == l_True && isPropagatedBy(var(c[0]), c); }
-inline void     Solver::newDecisionLevel()                      { trail_lim.push(trail.size()); flipped.push(false); context->push(); if(Dump.isOn("state")) { Dump("state") << CVC4::PushCommand(); } }
+inline void     Solver::newDecisionLevel(bool dumpState)        { trail_lim.push(trail.size()); flipped.push(false); context->push(); if(dumpState && Dump.isOn("state")) { Dump("state") << CVC4::PushCommand(); } }
 
 inline int      Solver::decisionLevel ()      const   { return trail_lim.size(); }
 inline uint32_t Solver::abstractLevel (Var x) const   { return 1 << (level(x) & 31); }
@@ -186,6 +186,11 @@ namespace Minisat{
 //=================================================================================================
 // Clause -- a simple class for representing a clause:
 
+// Retention tiers of removable clauses when they are managed by LBD (see Solver::lbd_tiers):
+// core clauses are kept, tier-2 clauses are kept while they are used, and local clauses are
+// reduced by activity.
+enum LearntTier { tier_Core = 0, tier_Tier2 = 1, tier_Local = 2 };
+
 class Clause {
     struct {
         unsigned mark      : 2;
@@ -193,7 +198,12 @@ class Clause {
         unsigned has_extra : 1;
         unsigned reloced   : 1;
         unsigned size      : 27;
-        unsigned level     : 32; }                            header;
+        unsigned level     : 32;
+        unsigned lbd       : 27;
+        unsigned tier      : 2;
+        unsigned used      : 1;
+        unsigned vivified  : 1;
+        unsigned imported  : 1; }                             header;
     union { Lit lit; float act; uint32_t abs; CRef rel; } data[0];
 
     friend class ClauseAllocator;
@@ -207,6 +217,12 @@ class Clause {
         header.reloced   = 0;
         header.size      = ps.size();
         header.level     = level;
+        header.lbd       = 0;
+        header.tier      = tier_Local;
+        header.used      = 0;
+        header.vivified  = 0;
+        header.imported  = 0;
+        setLbd(ps.size());
 
         for (int i = 0; i < ps.size(); i++) 
             data[i].lit = ps[i];
@@ -237,6 +253,21 @@ public:
     void         mark        (uint32_t m)    { header.mark = m; }
     const Lit&   last        ()      const   { return data[header.size-1].lit; }
 
+    // Literal block distance (number of distinct decision levels) and retention tier, only
+    // meaningful for removable clauses:
+    unsigned     lbd         ()      const   { return header.lbd; }
+    void         setLbd      (unsigned l)    { header.lbd = l < (1u << 27) ? l : (1u << 27) - 1; }
+    LearntTier   tier        ()      const   { return (LearntTier)header.tier; }
+    void         setTier     (LearntTier t)  { header.tier = t; }
+    bool         used        ()      const   { return header.used; }
+    void         setUsed     (bool u)        { header.used = u; }
+    bool         vivified    ()      const   { return header.vivified; }
+    void         setVivified (bool v)        { header.vivified = v; }
+
+    // A lemma imported from another portfolio thread, until it first takes part in a conflict:
+    bool         imported    ()      const   { return header.imported; }
+    void         setImported (bool i)        { header.imported = i; }
+
     bool         reloced     ()      const   { return header.reloced; }
     CRef         relocation  ()      const   { return data[0].rel; }
     void         relocate    (CRef c)        { header.reloced = 1; data[0].rel = c; }
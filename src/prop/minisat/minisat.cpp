@@ -139,6 +139,9 @@ void MinisatSatSolver::setupOptions() {
   d_minisat->clause_decay = options::satClauseDecay();
   d_minisat->restart_first = options::satRestartFirst();
   d_minisat->restart_inc = options::satRestartInc();
+  d_minisat->lbd_tiers = options::satLbdTiers();
+  d_minisat->ema_restart = options::satEmaRestarts();
+  d_minisat->inprocessing = options::satInprocessing();
 }
 
 ClauseId MinisatSatSolver::addClause(SatClause& clause, bool removable) {
@@ -179,6 +182,9 @@ SatValue MinisatSatSolver::solve(unsigned long& resource) {
 SatValue MinisatSatSolver::solve() {
   setupOptions();
   d_minisat->budgetOff();
+  // an interrupt() that came after the previous call had returned
+  // isn't meant for this one
+  d_minisat->clearInterrupt();
   return toSatLiteralValue(d_minisat->solve());
 }
 
@@ -218,6 +224,10 @@ bool MinisatSatSolver::isDecision(SatVariable decn) const {
   return d_minisat->isDecision( decn );
 }
 
+void MinisatSatSolver::setImportingLemmas(bool importing) {
+  d_minisat->importing_lemmas = importing;
+}
+
 /** Incremental interface */
 
 unsigned MinisatSatSolver::getAssertionLevel() const {
@@ -246,7 +256,12 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry) :
     d_statClausesLiterals("sat::clauses_literals"),
     d_statLearntsLiterals("sat::learnts_literals"),
     d_statMaxLiterals("sat::max_literals"),
-    d_statTotLiterals("sat::tot_literals")
+    d_statTotLiterals("sat::tot_literals"),
+    d_statInprocessings("sat::inprocessings"),
+    d_statVivifiedLiterals("sat::vivified_literals"),
+    d_statSubsumedRemovable("sat::subsumed_removable"),
+    d_statImportedLemmas("sat::imported_lemmas"),
+    d_statImportedLemmasUsed("sat::imported_lemmas_used")
 {
   d_registry->registerStat(&d_statStarts);
   d_registry->registerStat(&d_statDecisions);
@@ -257,6 +272,11 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry* registry) :
   d_registry->registerStat(&d_statLearntsLiterals);
   d_registry->registerStat(&d_statMaxLiterals);
   d_registry->registerStat(&d_statTotLiterals);
+  d_registry->registerStat(&d_statInprocessings);
+  d_registry->registerStat(&d_statVivifiedLiterals);
+  d_registry->registerStat(&d_statSubsumedRemovable);
+  d_registry->registerStat(&d_statImportedLemmas);
+  d_registry->registerStat(&d_statImportedLemmasUsed);
 }
 
 MinisatSatSolver::Statistics::~Statistics() {
@@ -269,6 +289,11 @@ MinisatSatSolver::Statistics::~Statistics() {
   d_registry->unregisterStat(&d_statLearntsLiterals);
   d_registry->unregisterStat(&d_statMaxLiterals);
   d_registry->unregisterStat(&d_statTotLiterals);
+  d_registry->unregisterStat(&d_statInprocessings);
+  d_registry->unregisterStat(&d_statVivifiedLiterals);
+  d_registry->unregisterStat(&d_statSubsumedRemovable);
+  d_registry->unregisterStat(&d_statImportedLemmas);
+  d_registry->unregisterStat(&d_statImportedLemmasUsed);
 }
 
 void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* d_minisat){
@@ -281,6 +306,11 @@ void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* d_minisat){
   d_statLearntsLiterals.setData(d_minisat->learnts_literals);
   d_statMaxLiterals.setData(d_minisat->max_literals);
   d_statTotLiterals.setData(d_minisat->tot_literals);
+  d_statInprocessings.setData(d_minisat->inprocessings);
+  d_statVivifiedLiterals.setData(d_minisat->vivified_lits);
+  d_statSubsumedRemovable.setData(d_minisat->subsumed_removable);
+  d_statImportedLemmas.setData(d_minisat->imported_lemmas);
+  d_statImportedLemmasUsed.setData(d_minisat->imported_lemmas_used);
 }
 
 } /* namespace CVC4::prop */
@@ -82,6 +82,8 @@ public:
 
   bool isDecision(SatVariable decn) const override;
 
+  void setImportingLemmas(bool importing) override;
+
  private:
 
   /** The SatSolver used */
@@ -100,6 +102,9 @@ public:
     ReferenceStat<uint64_t> d_statConflicts, d_statClausesLiterals;
     ReferenceStat<uint64_t> d_statLearntsLiterals,  d_statMaxLiterals;
     ReferenceStat<uint64_t> d_statTotLiterals;
+    ReferenceStat<uint64_t> d_statInprocessings, d_statVivifiedLiterals;
+    ReferenceStat<uint64_t> d_statSubsumedRemovable;
+    ReferenceStat<uint64_t> d_statImportedLemmas, d_statImportedLemmasUsed;
   public:
     Statistics(StatisticsRegistry* registry);
     ~Statistics();
@@ -179,6 +179,14 @@ bool SimpSolver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
     if (!Solver::addClause_(ps, removable, id))
         return false;
 
+    if (use_simplification && minisat_busy){
+        // The clause was queued as a lemma (see 'updateLemmas()'), so it will never be in the
+        // occurrence lists, and eliminating one of its variables would ignore it:
+        for (int i = 0; i < ps.size(); i++)
+            if (!frozen[var(ps[i])])
+                setFrozen(var(ps[i]), true);
+    }
+
     if (use_simplification && clauses_persistent.size() == nclauses + 1){
         CRef          cr = clauses_persistent.last();
         const Clause& c  = ca[cr];
@@ -701,6 +709,40 @@ bool SimpSolver::eliminate(bool turn_off_elim)
 }
 
 
+// Inprocessing also eliminates variables. The variables that may be eliminated are those that
+// are not frozen, i.e. not theory atoms (see 'newVar()'), so this is only enabled when no theory
+// introduces new literals (see 'use_elim'). The variables of the lemmas added during search are
+// frozen too (see 'addClause_()'), as these clauses are not in the occurrence lists. The removable
+// clauses containing an eliminated variable are removed: they may be implied by the original
+// clauses, but not by the resolvents.
+bool SimpSolver::inprocess()
+{
+    if (!Solver::inprocess())
+        return false;
+    if (!use_simplification || !use_elim || assumptions.size() > 0)
+        return true;
+
+    if (!eliminate(false))
+        return false;
+
+    int i, j;
+    for (i = j = 0; i < clauses_removable.size(); i++){
+        const Clause& c = ca[clauses_removable[i]];
+        int k = 0;
+        while (k < c.size() && !isEliminated(var(c[k])))
+            k++;
+        if (k < c.size() && !locked(c))
+            Solver::removeClause(clauses_removable[i]);
+        else
+            clauses_removable[j++] = clauses_removable[i];
+    }
+    clauses_removable.shrink(i - j);
+    checkGarbage();
+
+    return true;
+}
+
+
 void SimpSolver::cleanUpClauses()
 {
     occurs.cleanAll();
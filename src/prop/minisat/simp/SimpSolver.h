@@ -161,6 +161,7 @@ class SimpSolver : public Solver {
     bool          merge                    (const Clause& _ps, const Clause& _qs, Var v, int& size);
     bool          backwardSubsumptionCheck (bool verbose = false);
     bool          eliminateVar             (Var v);
+    bool          inprocess                () override;
     void          extendModel              ();
 
     void          removeClause             (CRef cr);
@@ -28,6 +28,7 @@
 #include "options/decision_options.h"
 #include "options/main_options.h"
 #include "options/options.h"
+#include "options/prop_options.h"
 #include "options/smt_options.h"
 #include "proof/proof_manager.h"
 #include "proof/proof_manager.h"
@@ -92,7 +93,14 @@ PropEngine::PropEngine(TheoryEngine* te, DecisionEngine *de, Context* satContext
 
   Debug("prop") << "Constructing the PropEngine" << endl;
 
-  d_satSolver = SatSolverFactory::createDPLLMinisat(smtStatisticsRegistry());
+  if (options::satCadical())
+  {
+    d_satSolver = SatSolverFactory::createDPLLCadical(smtStatisticsRegistry());
+  }
+  else
+  {
+    d_satSolver = SatSolverFactory::createDPLLMinisat(smtStatisticsRegistry());
+  }
 
   d_registrar = new theory::TheoryRegistrar(d_theoryEngine);
   d_cnfStream = new CVC4::prop::TseitinCnfStream
@@ -129,6 +137,13 @@ void PropEngine::assertFormula(TNode node) {
   d_cnfStream->convertAndAssert(node, false, false, RULE_GIVEN);
 }
 
+void PropEngine::assertFormulas(const std::vector<Node>& nodes) {
+  Assert(!d_inCheckSat, "Sat solver in solve()!");
+  Debug("prop") << "assertFormulas(" << nodes.size() << " formulas)" << endl;
+  // Assert as non-removable
+  d_cnfStream->convertAndAssertBatch(nodes, options::cnfThreads());
+}
+
 void PropEngine::assertLemma(TNode node, bool negated,
                              bool removable,
                              ProofRule rule,
@@ -140,6 +155,13 @@ void PropEngine::assertLemma(TNode node, bool negated,
   d_cnfStream->convertAndAssert(node, removable, negated, rule, from);
 }
 
+void PropEngine::assertSharedLemma(TNode node) {
+  Debug("prop::lemmas") << "assertSharedLemma(" << node << ")" << endl;
+  d_satSolver->setImportingLemmas(true);
+  d_cnfStream->convertAndAssert(node, true, false, RULE_INVALID, TNode::null());
+  d_satSolver->setImportingLemmas(false);
+}
+
 void PropEngine::requirePhase(TNode n, bool phase) {
   Debug("prop") << "requirePhase(" << n << ", " << phase << ")" << endl;
 
@@ -123,6 +123,14 @@ public:
    */
   void assertFormula(TNode node);
 
+  /**
+   * Converts the given formulas to CNF and asserts the CNF to the SAT
+   * solver, as assertFormula() does for each of them in order.  The
+   * conversion uses up to --cnf-threads threads.
+   * @param nodes the formulas to assert
+   */
+  void assertFormulas(const std::vector<Node>& nodes);
+
   /**
    * Converts the given formula to CNF and assert the CNF to the SAT solver.
    * The formula can be removed by the SAT solver after backtracking lower
@@ -136,6 +144,12 @@ public:
    */
   void assertLemma(TNode node, bool negated, bool removable, ProofRule rule, TNode from = TNode::null());
 
+  /**
+   * Asserts a (removable) lemma shared by another portfolio thread, so
+   * that the SAT solver can tell whether it gets used.
+   */
+  void assertSharedLemma(TNode node);
+
   /**
    * If ever n is decided upon, it must be in the given phase.  This
    * occurs *globally*, i.e., even if the literal is untranslated by
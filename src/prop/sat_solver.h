@@ -161,6 +161,13 @@ public:
   virtual bool flipDecision() = 0;
 
   virtual bool isDecision(SatVariable decn) const = 0;
+
+  /**
+   * Clauses added while importing is set come from lemmas shared by other
+   * portfolio threads; solvers that support it count how many of them are
+   * used in conflicts.
+   */
+  virtual void setImportingLemmas(bool importing) {}
 };/* class DPLLSatSolverInterface */
 
 inline std::ostream& operator <<(std::ostream& out, prop::SatLiteral lit) {
@@ -17,7 +17,9 @@
 #include "prop/sat_solver_factory.h"
 
 #include "prop/bvminisat/bvminisat.h"
+#include "prop/bvminisat/bvminisat_portfolio.h"
 #include "prop/cadical.h"
+#include "prop/cadical_dpll.h"
 #include "prop/cryptominisat.h"
 #include "prop/minisat/minisat.h"
 
@@ -32,12 +34,31 @@ BVSatSolverInterface* SatSolverFactory::createMinisat(
   return new BVMinisatSatSolver(registry, mainSatContext, name);
 }
 
+SatSolver* SatSolverFactory::createMinisatPortfolio(
+    context::Context* mainSatContext,
+    StatisticsRegistry* registry,
+    unsigned threads,
+    const std::string& name)
+{
+  return new BVMinisatPortfolio(registry, mainSatContext, threads, name);
+}
+
 DPLLSatSolverInterface* SatSolverFactory::createDPLLMinisat(
     StatisticsRegistry* registry)
 {
   return new MinisatSatSolver(registry);
 }
 
+DPLLSatSolverInterface* SatSolverFactory::createDPLLCadical(
+    StatisticsRegistry* registry)
+{
+#ifdef CVC4_USE_CADICAL_PROPAGATOR
+  return new CadicalDPLLSatSolver(registry);
+#else
+  Unreachable("CVC4 was not compiled with CaDiCaL 1.9 support.");
+#endif
+}
+
 SatSolver* SatSolverFactory::createCryptoMinisat(StatisticsRegistry* registry,
                                                  const std::string& name)
 {
@@ -36,9 +36,17 @@ class SatSolverFactory
                                              StatisticsRegistry* registry,
                                              const std::string& name = "");
 
+  static SatSolver* createMinisatPortfolio(context::Context* mainSatContext,
+                                           StatisticsRegistry* registry,
+                                           unsigned threads,
+                                           const std::string& name = "");
+
   static DPLLSatSolverInterface* createDPLLMinisat(
       StatisticsRegistry* registry);
 
+  static DPLLSatSolverInterface* createDPLLCadical(
+      StatisticsRegistry* registry);
+
   static SatSolver* createCryptoMinisat(StatisticsRegistry* registry,
                                         const std::string& name = "");
 
@@ -20,6 +20,7 @@
 #include "decision/decision_engine.h"
 #include "expr/expr_stream.h"
 #include "options/decision_options.h"
+#include "options/main_options.h"
 #include "prop/cnf_stream.h"
 #include "prop/prop_engine.h"
 #include "proof/cnf_proof.h"
@@ -51,14 +52,17 @@ TheoryProxy::TheoryProxy(PropEngine* propEngine,
       d_replayLog(replayLog),
       d_replayStream(replayStream),
       d_queue(context),
-      d_replayedDecisions("prop::theoryproxy::replayedDecisions", 0)
+      d_replayedDecisions("prop::theoryproxy::replayedDecisions", 0),
+      d_sharedLemmasFiltered("prop::theoryproxy::sharedLemmasFiltered", 0)
 {
   smtStatisticsRegistry()->registerStat(&d_replayedDecisions);
+  smtStatisticsRegistry()->registerStat(&d_sharedLemmasFiltered);
 }
 
 TheoryProxy::~TheoryProxy() {
   /* nothing to do for now */
   smtStatisticsRegistry()->unregisterStat(&d_replayedDecisions);
+  smtStatisticsRegistry()->unregisterStat(&d_sharedLemmasFiltered);
 }
 
 /** The lemma input channel we are using. */
@@ -181,7 +185,12 @@ void TheoryProxy::notifyRestart() {
             Debug("shared") << "=) " << asNode << std::endl;
           }
 
-          d_propEngine->assertLemma(d_theoryEngine->preprocess(asNode), false, true, RULE_INVALID);
+          if(options::sharingFilterByAtoms() && !hasAllAtoms(asNode)) {
+            Debug("shared") << "unknown atoms " << asNode << std::endl;
+            ++d_sharedLemmasFiltered;
+            continue;
+          }
+          d_propEngine->assertSharedLemma(d_theoryEngine->preprocess(asNode));
         } else {
           Debug("shared") << "=(" << asNode << std::endl;
         }
@@ -192,6 +201,16 @@ void TheoryProxy::notifyRestart() {
   }
 }
 
+bool TheoryProxy::hasAllAtoms(TNode clause) const {
+  for(TNode lit : clause) {
+    TNode atom = lit.getKind() == kind::NOT ? lit[0] : lit;
+    if(!d_cnfStream->hasLiteral(atom)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void TheoryProxy::notifyNewLemma(SatClause& lemma) {
   Assert(lemma.size() > 0);
   if(outputChannel() != NULL) {
@@ -104,6 +104,9 @@ public:
   void dumpStatePop();
 
  private:
+  /** Whether all atoms of the clause have a SAT literal already. */
+  bool hasAllAtoms(TNode clause) const;
+
   /** The prop engine we are using. */
   PropEngine* d_propEngine;
 
@@ -146,6 +149,12 @@ public:
    */
   IntStat d_replayedDecisions;
 
+  /**
+   * Statistic: the number of shared lemmas dropped because they mention
+   * atoms unknown here (via --filter-lemma-atoms).
+   */
+  IntStat d_sharedLemmasFiltered;
+
 };/* class SatSolver */
 
 }/* CVC4::prop namespace */
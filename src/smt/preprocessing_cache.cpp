@@ -0,0 +1,265 @@
+/*********************                                                        */
+/*! \file preprocessing_cache.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief An on-disk cache of preprocessed assertions
+ **
+ ** An on-disk cache of preprocessed assertions.
+ **/
+
+#include "smt/preprocessing_cache.h"
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "base/configuration.h"
+#include "base/output.h"
+#include "expr/node_manager_attributes.h"
+#include "expr/pickler.h"
+#include "expr/variable_type_map.h"
+#include "options/options.h"
+
+using namespace std;
+
+namespace CVC4 {
+namespace smt {
+
+namespace {
+
+/** Identifies cache files (and the version of their layout). */
+const char MAGIC[8] = { 'C', 'V', 'C', '4', 'P', 'P', 'C', '1' };
+
+/** The option naming the cache directory, which doesn't affect the key. */
+const char CACHE_DIR_OPTION[] = "preprocess-cache-dir";
+
+const uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+const uint64_t FNV_PRIME = 0x100000001b3ull;
+
+uint64_t mix(uint64_t h, uint64_t x) {
+  for(unsigned i = 0; i < 8; ++i) {
+    h = (h ^ (x & 0xff)) * FNV_PRIME;
+    x >>= 8;
+  }
+  return h;
+}
+
+uint64_t mix(uint64_t h, const std::string& s) {
+  for(size_t i = 0; i < s.size(); ++i) {
+    h = (h ^ static_cast<unsigned char>(s[i])) * FNV_PRIME;
+  }
+  // terminate, so that consecutive strings can't run together
+  return mix(h, uint64_t(s.size()));
+}
+
+template <class T>
+void writeRaw(ostream& out, const T& x) {
+  out.write(reinterpret_cast<const char*>(&x), sizeof(x));
+}
+
+template <class T>
+bool readRaw(istream& in, T& x) {
+  return bool(in.read(reinterpret_cast<char*>(&x), sizeof(x)));
+}
+
+}/* CVC4::smt::<anonymous> namespace */
+
+PreprocessingCache::PreprocessingCache(ExprManager* em,
+                                       const std::string& dir)
+    : d_exprManager(em), d_dir(dir), d_key(0) {}
+
+void PreprocessingCache::setInput(const std::vector<Node>& assertions,
+                                  const LogicInfo& logic) {
+  d_symbols.clear();
+  d_signature.clear();
+
+  uint64_t key = mix(FNV_OFFSET, Configuration::getVersionString());
+  key = mix(key, uint64_t(kind::LAST_KIND));
+  // simplification depends on the enabled theories, which the options
+  // don't all show
+  key = mix(key, logic.getLogicString());
+  std::vector<std::vector<std::string> > opts =
+      Options::current()->getOptions();
+  for(size_t i = 0; i < opts.size(); ++i) {
+    if(opts[i][0] != CACHE_DIR_OPTION) {
+      key = mix(key, opts[i][0]);
+      key = mix(key, opts[i][1]);
+    }
+  }
+
+  // hash the assertions structurally, visiting each shared subterm once
+  unordered_map<TNode, uint64_t, TNodeHashFunction> hashes;
+  unordered_set<TNode, TNodeHashFunction> expanded;
+  vector<TNode> visit;
+  for(size_t i = 0; i < assertions.size(); ++i) {
+    visit.push_back(assertions[i]);
+    while(!visit.empty()) {
+      TNode cur = visit.back();
+      if(hashes.find(cur) != hashes.end()) {
+        visit.pop_back();
+        continue;
+      }
+      if(expanded.insert(cur).second) {
+        for(size_t j = cur.getNumChildren(); j > 0; --j) {
+          visit.push_back(cur[j - 1]);
+        }
+        if(cur.getMetaKind() == kind::metakind::PARAMETERIZED) {
+          visit.push_back(cur.getOperator());
+        }
+        continue;
+      }
+      visit.pop_back();
+
+      uint64_t h = mix(FNV_OFFSET, uint64_t(cur.getKind()));
+      switch(cur.getMetaKind()) {
+      case kind::metakind::VARIABLE: {
+        std::string name;
+        cur.getAttribute(expr::VarNameAttr(), name);
+        std::string type = cur.getType().toString();
+        h = mix(mix(mix(h, uint64_t(d_symbols.size())), name), type);
+        d_symbols.push_back(cur);
+        d_signature += name + " : " + type + "\n";
+        break;
+      }
+      case kind::metakind::CONSTANT:
+        h = mix(h, cur.toString());
+        break;
+      default:
+        if(cur.getMetaKind() == kind::metakind::PARAMETERIZED) {
+          h = mix(h, hashes[cur.getOperator()]);
+        }
+        for(TNode::iterator j = cur.begin(); j != cur.end(); ++j) {
+          h = mix(h, hashes[*j]);
+        }
+      }
+      hashes[cur] = h;
+    }
+    key = mix(key, hashes[assertions[i]]);
+  }
+  d_key = mix(key, d_signature);
+  Trace("pp-cache") << "PreprocessingCache: " << assertions.size()
+                    << " assertions, " << d_symbols.size()
+                    << " symbols, key " << getPath() << endl;
+}
+
+std::string PreprocessingCache::getPath() const {
+  std::ostringstream path;
+  path << d_dir << "/" << std::hex << d_key << ".cvc4pp";
+  return path.str();
+}
+
+bool PreprocessingCache::load(std::vector<Node>& assertions,
+                              size_t& realAssertionsEnd,
+                              bool& noConflict) const {
+  std::ifstream in(getPath().c_str(), std::ios::binary);
+  if(!in) {
+    return false;
+  }
+
+  char magic[sizeof(MAGIC)];
+  uint64_t key, sigSize, end;
+  uint8_t conflictFree;
+  uint32_t n;
+  if(!in.read(magic, sizeof(magic))
+     || !std::equal(magic, magic + sizeof(MAGIC), MAGIC)
+     || !readRaw(in, key) || key != d_key
+     || !readRaw(in, sigSize) || sigSize != d_signature.size()) {
+    Trace("pp-cache") << "PreprocessingCache: stale entry" << endl;
+    return false;
+  }
+  std::string signature(sigSize, '\0');
+  if(!in.read(&signature[0], sigSize) || signature != d_signature) {
+    Trace("pp-cache") << "PreprocessingCache: key collision" << endl;
+    return false;
+  }
+  if(!readRaw(in, end) || !readRaw(in, conflictFree) || !readRaw(in, n)) {
+    return false;
+  }
+
+  VarMap toMap, fromMap;
+  for(size_t i = 0; i < d_symbols.size(); ++i) {
+    fromMap[i] = expr::pickle::Pickler::variableKey(d_symbols[i].toExpr());
+  }
+  expr::pickle::MapPickler pickler(d_exprManager, toMap, fromMap);
+  std::vector<Node> result;
+  for(uint32_t i = 0; i < n; ++i) {
+    expr::pickle::Pickle p;
+    if(!p.readFrom(in)) {
+      Trace("pp-cache") << "PreprocessingCache: truncated entry" << endl;
+      return false;
+    }
+    result.push_back(Node::fromExpr(pickler.fromPickle(p)));
+  }
+  if(end > result.size()) {
+    return false;
+  }
+
+  assertions.swap(result);
+  realAssertionsEnd = end;
+  noConflict = conflictFree != 0;
+  return true;
+}
+
+bool PreprocessingCache::store(const std::vector<Node>& assertions,
+                               size_t realAssertionsEnd,
+                               bool noConflict) const {
+  VarMap toMap, fromMap;
+  for(size_t i = 0; i < d_symbols.size(); ++i) {
+    toMap[expr::pickle::Pickler::variableKey(d_symbols[i].toExpr())] = i;
+  }
+  expr::pickle::MapPickler pickler(d_exprManager, toMap, fromMap);
+
+  std::ostringstream data;
+  data.write(MAGIC, sizeof(MAGIC));
+  writeRaw(data, d_key);
+  writeRaw(data, uint64_t(d_signature.size()));
+  data.write(d_signature.data(), d_signature.size());
+  writeRaw(data, uint64_t(realAssertionsEnd));
+  writeRaw(data, uint8_t(noConflict ? 1 : 0));
+  writeRaw(data, uint32_t(assertions.size()));
+  for(size_t i = 0; i < assertions.size(); ++i) {
+    expr::pickle::Pickle p;
+    try {
+      pickler.toPickle(assertions[i].toExpr(), p);
+    } catch(expr::pickle::PicklingException& e) {
+      Trace("pp-cache") << "PreprocessingCache: can't store "
+                        << assertions[i] << endl;
+      return false;
+    }
+    p.writeTo(data);
+  }
+
+  // write to a private file first, so that concurrent runs never see
+  // a partial entry
+  std::string path = getPath();
+  std::ostringstream tmp;
+  tmp << path << ".tmp." << getpid();
+  {
+    std::ofstream out(tmp.str().c_str(), std::ios::binary);
+    std::string bytes = data.str();
+    if(!out.write(bytes.data(), bytes.size()) || !out.flush()) {
+      remove(tmp.str().c_str());
+      return false;
+    }
+  }
+  if(rename(tmp.str().c_str(), path.c_str()) != 0) {
+    remove(tmp.str().c_str());
+    return false;
+  }
+  return true;
+}
+
+}/* CVC4::smt namespace */
+}/* CVC4 namespace */
@@ -0,0 +1,95 @@
+/*********************                                                        */
+/*! \file preprocessing_cache.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief An on-disk cache of preprocessed assertions
+ **
+ ** An on-disk cache of preprocessed assertions, enabled with
+ ** --preprocess-cache-dir.  The simplified assertion list of a run is
+ ** pickled into a file named after a hash of the input assertions and
+ ** the options in effect, so that a later run on the same problem can
+ ** load it instead of simplifying again.  Symbols are stored as their
+ ** position among the free symbols of the input, so only results that
+ ** mention nothing but input symbols can be stored.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__SMT__PREPROCESSING_CACHE_H
+#define __CVC4__SMT__PREPROCESSING_CACHE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "expr/expr_manager.h"
+#include "expr/node.h"
+#include "theory/logic_info.h"
+
+namespace CVC4 {
+namespace smt {
+
+class PreprocessingCache {
+ public:
+  /** Construct a cache for nodes of em, keeping its files in dir. */
+  PreprocessingCache(ExprManager* em, const std::string& dir);
+
+  /**
+   * Set the input assertions (after definition expansion) to look up
+   * and store results for.  This computes the cache key from the
+   * assertions, the logic they are solved in and the current options.
+   */
+  void setInput(const std::vector<Node>& assertions, const LogicInfo& logic);
+
+  /**
+   * Look up the preprocessed form of the input.  On a hit, assertions,
+   * realAssertionsEnd and noConflict are set to what store() was given
+   * and true is returned; on a miss they are left alone.
+   */
+  bool load(std::vector<Node>& assertions,
+            size_t& realAssertionsEnd,
+            bool& noConflict) const;
+
+  /**
+   * Store the preprocessed form of the input.  Returns false (storing
+   * nothing) if assertions mention symbols that aren't in the input,
+   * or constants the pickler can't represent, or if the cache file
+   * can't be written.
+   */
+  bool store(const std::vector<Node>& assertions,
+             size_t realAssertionsEnd,
+             bool noConflict) const;
+
+ private:
+  /** The path of the cache file for the current input. */
+  std::string getPath() const;
+
+  ExprManager* d_exprManager;
+
+  /** Directory holding the cache files. */
+  std::string d_dir;
+
+  /** The free symbols of the input, in order of first occurrence. */
+  std::vector<Node> d_symbols;
+
+  /**
+   * The names and types of d_symbols, stored alongside the cache
+   * entry to rule out collisions of the key.
+   */
+  std::string d_signature;
+
+  /** Hash of the input and options, naming the cache file. */
+  uint64_t d_key;
+};/* class PreprocessingCache */
+
+}/* CVC4::smt namespace */
+}/* CVC4 namespace */
+
+#endif /* __CVC4__SMT__PREPROCESSING_CACHE_H */
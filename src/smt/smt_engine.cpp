@@ -95,6 +95,7 @@
 #include "smt/command_list.h"
 #include "smt/logic_request.h"
 #include "smt/managed_ostreams.h"
+#include "smt/preprocessing_cache.h"
 #include "smt/smt_engine_scope.h"
 #include "smt/term_formula_removal.h"
 #include "smt/update_ostream.h"
@@ -223,6 +224,11 @@ struct SmtEngineStatistics {
   /** time spent in processAssertions() */
   TimerStat d_processAssertionsTime;
 
+  /** Number of inputs whose simplified form was loaded from the cache */
+  IntStat d_preprocessCacheHits;
+  /** Number of inputs simplified while the cache was in use */
+  IntStat d_preprocessCacheMisses;
+
   /** Has something simplified to false? */
   IntStat d_simplifiedToFalse;
   /** Number of resource units spent. */
@@ -249,6 +255,8 @@ struct SmtEngineStatistics {
     d_solveTime("smt::SmtEngine::solveTime"),
     d_pushPopTime("smt::SmtEngine::pushPopTime"),
     d_processAssertionsTime("smt::SmtEngine::processAssertionsTime"),
+    d_preprocessCacheHits("smt::SmtEngine::preprocessCacheHits", 0),
+    d_preprocessCacheMisses("smt::SmtEngine::preprocessCacheMisses", 0),
     d_simplifiedToFalse("smt::SmtEngine::simplifiedToFalse", 0),
     d_resourceUnitsUsed("smt::SmtEngine::resourceUnitsUsed")
  {
@@ -273,6 +281,8 @@ struct SmtEngineStatistics {
     smtStatisticsRegistry()->registerStat(&d_solveTime);
     smtStatisticsRegistry()->registerStat(&d_pushPopTime);
     smtStatisticsRegistry()->registerStat(&d_processAssertionsTime);
+    smtStatisticsRegistry()->registerStat(&d_preprocessCacheHits);
+    smtStatisticsRegistry()->registerStat(&d_preprocessCacheMisses);
     smtStatisticsRegistry()->registerStat(&d_simplifiedToFalse);
     smtStatisticsRegistry()->registerStat(&d_resourceUnitsUsed);
   }
@@ -298,6 +308,8 @@ struct SmtEngineStatistics {
     smtStatisticsRegistry()->unregisterStat(&d_solveTime);
     smtStatisticsRegistry()->unregisterStat(&d_pushPopTime);
     smtStatisticsRegistry()->unregisterStat(&d_processAssertionsTime);
+    smtStatisticsRegistry()->unregisterStat(&d_preprocessCacheHits);
+    smtStatisticsRegistry()->unregisterStat(&d_preprocessCacheMisses);
     smtStatisticsRegistry()->unregisterStat(&d_simplifiedToFalse);
     smtStatisticsRegistry()->unregisterStat(&d_resourceUnitsUsed);
   }
@@ -647,6 +659,15 @@ public:
    */
   bool simplifyAssertions();
 
+  /**
+   * Run the preprocessing passes between definition expansion and term
+   * ITE removal, i.e. those whose result the preprocessing cache
+   * stores.
+   *
+   * Returns false if the formula simplifies to "false"
+   */
+  bool simplifyAndLearn();
+
  public:
   SmtEnginePrivate(SmtEngine& smt)
       : d_smt(smt),
@@ -1455,6 +1476,22 @@ void SmtEngine::setDefaults() {
   // error if enabled explicitly
   if (options::unsatCores() || options::proof())
   {
+    if (options::satCadical())
+    {
+      throw OptionException(
+          "--sat-cadical not supported with unsat cores/proofs");
+    }
+
+    if (options::bvEagerThreads() > 1)
+    {
+      if (options::bvEagerThreads.wasSetByUser())
+      {
+        throw OptionException(
+            "--bv-eager-threads not supported with unsat cores/proofs");
+      }
+      options::bvEagerThreads.set(1);
+    }
+
     if (options::simplificationMode() != SIMPLIFICATION_MODE_NONE)
     {
       if (options::simplificationMode.wasSetByUser())
@@ -2318,6 +2355,39 @@ void SmtEngine::setDefaults() {
       options::bitvectorInequalitySolver.set(false);
     }
   }
+
+  if (!options::preprocessCacheDir().empty())
+  {
+    // a cached result stands in for preprocessing only where nothing
+    // but the simplified assertions is needed afterwards
+    std::string reason;
+    if (options::incrementalSolving())
+    {
+      reason = "incremental solving";
+    }
+    else if (options::unsatCores() || options::proof())
+    {
+      reason = "unsat cores/proofs";
+    }
+    else if (options::produceModels() || options::produceAssignments())
+    {
+      reason = "model generation";
+    }
+    else if (d_logic.isQuantified() || options::ceGuidedInst())
+    {
+      reason = "quantifiers";
+    }
+    else if (options::sortInference() || options::ufssFairnessMonotone())
+    {
+      reason = "sort inference";
+    }
+    if (!reason.empty())
+    {
+      Warning() << "SmtEngine: turning off the preprocessing cache because "
+                << "unsupported for " << reason << endl;
+      options::preprocessCacheDir.set("");
+    }
+  }
 }
 
 void SmtEngine::setProblemExtended(bool value)
@@ -4022,73 +4092,9 @@ bool SmtEnginePrivate::checkForBadSkolems(TNode n, TNode skolem, unordered_map<N
   return false;
 }
 
-void SmtEnginePrivate::processAssertions() {
-  TimerStat::CodeTimer paTimer(d_smt.d_stats->d_processAssertionsTime);
-  spendResource(options::preprocessStep());
-  Assert(d_smt.d_fullyInited);
-  Assert(d_smt.d_pendingPops == 0);
-  SubstitutionMap& top_level_substs = d_assertions.getTopLevelSubstitutions();
-
-  // Dump the assertions
-  dumpAssertions("pre-everything", d_assertions);
-
-  Trace("smt-proc") << "SmtEnginePrivate::processAssertions() begin" << endl;
-  Trace("smt") << "SmtEnginePrivate::processAssertions()" << endl;
-
-  Debug("smt") << " d_assertions     : " << d_assertions.size() << endl;
-
-  if (d_assertions.size() == 0) {
-    // nothing to do
-    return;
-  }
-
-  if (options::bvGaussElim())
-  {
-    TimerStat::CodeTimer gaussElimTimer(d_smt.d_stats->d_gaussElimTime);
-    d_preprocessingPassRegistry.getPass("bv-gauss")->apply(&d_assertions);
-  }
-
-  if (d_assertionsProcessed && options::incrementalSolving()) {
-    // TODO(b/1255): Substitutions in incremental mode should be managed with a
-    // proper data structure.
-
-    // Placeholder for storing substitutions
-    d_assertions.getSubstitutionsIndex() = d_assertions.size();
-    d_assertions.push_back(NodeManager::currentNM()->mkConst<bool>(true));
-  }
-
-  // Add dummy assertion in last position - to be used as a
-  // placeholder for any new assertions to get added
-  d_assertions.push_back(NodeManager::currentNM()->mkConst<bool>(true));
-  // any assertions added beyond realAssertionsEnd must NOT affect the
-  // equisatisfiability
-  d_realAssertionsEnd = d_assertions.size();
-
-  // Assertions are NOT guaranteed to be rewritten by this point
-
-  Trace("smt-proc") << "SmtEnginePrivate::processAssertions() : pre-definition-expansion" << endl;
-  dumpAssertions("pre-definition-expansion", d_assertions);
-  {
-    Chat() << "expanding definitions..." << endl;
-    Trace("simplify") << "SmtEnginePrivate::simplify(): expanding definitions" << endl;
-    TimerStat::CodeTimer codeTimer(d_smt.d_stats->d_definitionExpansionTime);
-    unordered_map<Node, Node, NodeHashFunction> cache;
-    for(unsigned i = 0; i < d_assertions.size(); ++ i) {
-      d_assertions.replace(i, expandDefinitions(d_assertions[i], cache));
-    }
-  }
-  Trace("smt-proc") << "SmtEnginePrivate::processAssertions() : post-definition-expansion" << endl;
-  dumpAssertions("post-definition-expansion", d_assertions);
-
-  // save the assertions now
-  THEORY_PROOF
-    (
-     for (unsigned i = 0; i < d_assertions.size(); ++i) {
-       ProofManager::currentPM()->addAssertion(d_assertions[i].toExpr());
-     }
-     );
-
-  Debug("smt") << " d_assertions     : " << d_assertions.size() << endl;
+bool SmtEnginePrivate::simplifyAndLearn()
+{
+  bool noConflict = true;
 
   if (options::globalNegate())
   {
@@ -4152,8 +4158,6 @@ void SmtEnginePrivate::processAssertions() {
 
   Debug("smt") << " d_assertions     : " << d_assertions.size() << endl;
 
-  bool noConflict = true;
-
   if (options::extRewPrep())
   {
     theory::quantifiers::ExtendedRewriter extr(options::extRewPrepAgg());
@@ -4345,6 +4349,103 @@ void SmtEnginePrivate::processAssertions() {
     d_preprocessingPassRegistry.getPass("static-learning")
         ->apply(&d_assertions);
   }
+  return noConflict;
+}
+
+void SmtEnginePrivate::processAssertions() {
+  TimerStat::CodeTimer paTimer(d_smt.d_stats->d_processAssertionsTime);
+  spendResource(options::preprocessStep());
+  Assert(d_smt.d_fullyInited);
+  Assert(d_smt.d_pendingPops == 0);
+  SubstitutionMap& top_level_substs = d_assertions.getTopLevelSubstitutions();
+
+  // Dump the assertions
+  dumpAssertions("pre-everything", d_assertions);
+
+  Trace("smt-proc") << "SmtEnginePrivate::processAssertions() begin" << endl;
+  Trace("smt") << "SmtEnginePrivate::processAssertions()" << endl;
+
+  Debug("smt") << " d_assertions     : " << d_assertions.size() << endl;
+
+  if (d_assertions.size() == 0) {
+    // nothing to do
+    return;
+  }
+
+  if (options::bvGaussElim())
+  {
+    TimerStat::CodeTimer gaussElimTimer(d_smt.d_stats->d_gaussElimTime);
+    d_preprocessingPassRegistry.getPass("bv-gauss")->apply(&d_assertions);
+  }
+
+  if (d_assertionsProcessed && options::incrementalSolving()) {
+    // TODO(b/1255): Substitutions in incremental mode should be managed with a
+    // proper data structure.
+
+    // Placeholder for storing substitutions
+    d_assertions.getSubstitutionsIndex() = d_assertions.size();
+    d_assertions.push_back(NodeManager::currentNM()->mkConst<bool>(true));
+  }
+
+  // Add dummy assertion in last position - to be used as a
+  // placeholder for any new assertions to get added
+  d_assertions.push_back(NodeManager::currentNM()->mkConst<bool>(true));
+  // any assertions added beyond realAssertionsEnd must NOT affect the
+  // equisatisfiability
+  d_realAssertionsEnd = d_assertions.size();
+
+  // Assertions are NOT guaranteed to be rewritten by this point
+
+  Trace("smt-proc") << "SmtEnginePrivate::processAssertions() : pre-definition-expansion" << endl;
+  dumpAssertions("pre-definition-expansion", d_assertions);
+  {
+    Chat() << "expanding definitions..." << endl;
+    Trace("simplify") << "SmtEnginePrivate::simplify(): expanding definitions" << endl;
+    TimerStat::CodeTimer codeTimer(d_smt.d_stats->d_definitionExpansionTime);
+    unordered_map<Node, Node, NodeHashFunction> cache;
+    for(unsigned i = 0; i < d_assertions.size(); ++ i) {
+      d_assertions.replace(i, expandDefinitions(d_assertions[i], cache));
+    }
+  }
+  Trace("smt-proc") << "SmtEnginePrivate::processAssertions() : post-definition-expansion" << endl;
+  dumpAssertions("post-definition-expansion", d_assertions);
+
+  // save the assertions now
+  THEORY_PROOF
+    (
+     for (unsigned i = 0; i < d_assertions.size(); ++i) {
+       ProofManager::currentPM()->addAssertion(d_assertions[i].toExpr());
+     }
+     );
+
+  Debug("smt") << " d_assertions     : " << d_assertions.size() << endl;
+
+  bool noConflict = true;
+  std::unique_ptr<PreprocessingCache> ppCache;
+  if (!options::preprocessCacheDir().empty())
+  {
+    ppCache.reset(new PreprocessingCache(d_smt.d_exprManager,
+                                         options::preprocessCacheDir()));
+    ppCache->setInput(d_assertions.ref(), d_smt.d_logic);
+  }
+  size_t realAssertionsEnd;
+  if (ppCache
+      && ppCache->load(d_assertions.ref(), realAssertionsEnd, noConflict))
+  {
+    d_realAssertionsEnd = realAssertionsEnd;
+    ++(d_smt.d_stats->d_preprocessCacheHits);
+    Trace("smt-proc") << "SmtEnginePrivate::processAssertions() : "
+                      << "loaded simplified assertions from cache" << endl;
+  }
+  else
+  {
+    noConflict = simplifyAndLearn();
+    if (ppCache)
+    {
+      ++(d_smt.d_stats->d_preprocessCacheMisses);
+      ppCache->store(d_assertions.ref(), d_realAssertionsEnd, noConflict);
+    }
+  }
   Debug("smt") << " d_assertions     : " << d_assertions.size() << endl;
 
   Trace("smt-proc") << "SmtEnginePrivate::processAssertions() : pre-ite-removal" << endl;
@@ -4507,8 +4608,8 @@ void SmtEnginePrivate::processAssertions() {
     TimerStat::CodeTimer codeTimer(d_smt.d_stats->d_cnfConversionTime);
     for (unsigned i = 0; i < d_assertions.size(); ++ i) {
       Chat() << "+ " << d_assertions[i] << std::endl;
-      d_smt.d_propEngine->assertFormula(d_assertions[i]);
     }
+    d_smt.d_propEngine->assertFormulas(d_assertions.ref());
   }
 
   d_assertionsProcessed = true;
@@ -4604,6 +4705,9 @@ Result SmtEngine::checkSatisfiability(const vector<Expr>& assumptions,
     SmtScope smts(this);
     finalOptionsAreSet();
     doPendingPops();
+    // command boundaries are safe points to collect garbage left over
+    // from previous commands, in steps of bounded length
+    d_nodeManager->reclaimZombiesIncrementally();
 
     Trace("smt") << "SmtEngine::" << (isQuery ? "query" : "checkSat") << "("
                  << assumptions << ")" << endl;
@@ -4942,6 +5046,7 @@ Result SmtEngine::assertFormula(const Expr& ex, bool inUnsatCore)
   SmtScope smts(this);
   finalOptionsAreSet();
   doPendingPops();
+  d_nodeManager->reclaimZombiesIncrementally();
 
   Trace("smt") << "SmtEngine::assertFormula(" << ex << ")" << endl;
 
@@ -5066,7 +5171,7 @@ Expr SmtEngine::getValue(const Expr& ex) const
   }
 
   Trace("smt") << "--- getting value of " << n << endl;
-  TheoryModel* m = d_theoryEngine->getModel();
+  TheoryModel* m = d_theoryEngine->getBuiltModel(n);
   Node resultNode;
   if(m != NULL) {
     resultNode = m->getValue(n);
@@ -5153,7 +5258,7 @@ vector<pair<Expr, Expr>> SmtEngine::getAssignment()
   if (d_assignments != nullptr)
   {
     TypeNode boolType = d_nodeManager->booleanType();
-    TheoryModel* m = d_theoryEngine->getModel();
+    TheoryModel* m = d_theoryEngine->getBuiltModel();
     for (AssignmentSet::key_iterator i = d_assignments->key_begin(),
                                      iend = d_assignments->key_end();
          i != iend;
@@ -5251,7 +5356,7 @@ Model* SmtEngine::getModel() {
       "Cannot get model when produce-models options is off.";
     throw ModalException(msg);
   }
-  TheoryModel* m = d_theoryEngine->getModel();
+  TheoryModel* m = d_theoryEngine->getBuiltModel();
   m->d_inputName = d_filename;
   return m;
 }
@@ -5310,7 +5415,7 @@ void SmtEngine::checkModel(bool hardFailure) {
   // and if Notice() is on, the user gave --verbose (or equivalent).
 
   Notice() << "SmtEngine::checkModel(): generating model" << endl;
-  TheoryModel* m = d_theoryEngine->getModel();
+  TheoryModel* m = d_theoryEngine->getBuiltModel();
 
   // check-model is not guaranteed to succeed if approximate values were used
   if (m->hasApproximations())
@@ -5820,6 +5925,7 @@ void SmtEngine::push()
   SmtScope smts(this);
   finalOptionsAreSet();
   doPendingPops();
+  d_nodeManager->reclaimZombiesIncrementally();
   Trace("smt") << "SMT push()" << endl;
   d_private->notifyPush();
   d_private->processAssertions();
@@ -5850,6 +5956,7 @@ void SmtEngine::push()
 void SmtEngine::pop() {
   SmtScope smts(this);
   finalOptionsAreSet();
+  d_nodeManager->reclaimZombiesIncrementally();
   Trace("smt") << "SMT pop()" << endl;
   if(Dump.isOn("benchmark")) {
     Dump("benchmark") << PopCommand();
@@ -0,0 +1,106 @@
+/*********************                                                        */
+/*! \file lemma_hub.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Lock-free exchange of lemmas between portfolio threads.
+ **
+ ** A pickle is shared as the words of its binary form, which is a 32-bit
+ ** block count followed by 64-bit blocks, so always a whole number of
+ ** words.
+ **/
+
+#include "smt_util/lemma_hub.h"
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "base/cvc4_assert.h"
+#include "prop/clause_exchange.h"
+
+namespace CVC4 {
+
+LemmaHub::LemmaHub(unsigned threads,
+                   bool filterDuplicates,
+                   unsigned maxWords,
+                   size_t capacity)
+    : d_exchange(new prop::ClauseExchange(threads, maxWords, capacity)),
+      d_filterDuplicates(filterDuplicates),
+      d_capacity(capacity),
+      d_threads(threads)
+{
+}
+
+LemmaHub::~LemmaHub() {}
+
+size_t LemmaHub::WordsHashFunction::operator()(
+    const std::vector<uint32_t>& words) const
+{
+  // FNV-1a
+  uint64_t h = 14695981039346656037ULL;
+  for(uint32_t w : words) {
+    h = (h ^ w) * 1099511628211ULL;
+  }
+  return h;
+}
+
+bool LemmaHub::remember(ThreadState& state)
+{
+  // equal hashes are compared word by word by the set
+  if(state.d_seen.count(state.d_words) > 0) {
+    return false;
+  }
+  if(state.d_seenWords + state.d_words.size() > d_capacity) {
+    state.d_seen.clear();
+    state.d_seenWords = 0;
+  }
+  state.d_seen.insert(state.d_words);
+  state.d_seenWords += state.d_words.size();
+  return true;
+}
+
+bool LemmaHub::publish(unsigned thread, const expr::pickle::Pickle& lemma)
+{
+  std::ostringstream out;
+  lemma.writeTo(out);
+  std::string bytes = out.str();
+  Assert(bytes.size() % sizeof(uint32_t) == 0);
+  size_t size = bytes.size() / sizeof(uint32_t);
+  if(size > d_exchange->getMaxSize()) {
+    return false;
+  }
+  ThreadState& state = d_threads[thread];
+  state.d_words.resize(size);
+  std::memcpy(state.d_words.data(), bytes.data(), bytes.size());
+  if(d_filterDuplicates) {
+    remember(state);
+  }
+  return d_exchange->publish(thread, state.d_words.data(), size);
+}
+
+bool LemmaHub::fetch(unsigned thread, expr::pickle::Pickle& lemma)
+{
+  ThreadState& state = d_threads[thread];
+  while(d_exchange->fetch(thread, state.d_words)) {
+    if(d_filterDuplicates && !remember(state)) {
+      ++state.d_duplicates;
+      continue;
+    }
+    std::string bytes(state.d_words.size() * sizeof(uint32_t), '\0');
+    std::memcpy(&bytes[0], state.d_words.data(), bytes.size());
+    std::istringstream in(bytes);
+    bool ok = lemma.readFrom(in);
+    Assert(ok);
+    return ok;
+  }
+  return false;
+}
+
+}/* CVC4 namespace */
@@ -0,0 +1,111 @@
+/*********************                                                        */
+/*! \file lemma_hub.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Lock-free exchange of lemmas between portfolio threads.
+ **
+ ** Each thread publishes the pickles of its lemmas into its own ring,
+ ** which the other threads read directly, without a thread in between
+ ** that forwards them.  A thread that falls behind skips the lemmas it
+ ** missed.  The portfolio makes a new hub for every query, so lemmas
+ ** never outlive the assertion level they were derived at.
+ **/
+
+#include "cvc4_public.h"
+
+#ifndef __CVC4__SMT_UTIL__LEMMA_HUB_H
+#define __CVC4__SMT_UTIL__LEMMA_HUB_H
+
+#include <stdint.h>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "expr/pickler.h"
+
+namespace CVC4 {
+
+namespace prop {
+class ClauseExchange;
+}/* CVC4::prop namespace */
+
+class CVC4_PUBLIC LemmaHub {
+public:
+  /**
+   * Create a hub between the given number of threads, for pickles of at
+   * most maxWords 32-bit words; each thread keeps the last capacity words
+   * it published.  If filterDuplicates is set, a thread doesn't fetch
+   * lemmas it has published or fetched before; it remembers up to
+   * capacity words of them, and forgets them all when that is exceeded.
+   */
+  LemmaHub(unsigned threads,
+           bool filterDuplicates = true,
+           unsigned maxWords = 1 << 10,
+           size_t capacity = 1 << 18);
+  ~LemmaHub();
+
+  /**
+   * Publish a lemma of the given thread.  Never blocks.  Returns false if
+   * the pickle is too large to be shared.
+   */
+  bool publish(unsigned thread, const expr::pickle::Pickle& lemma);
+
+  /**
+   * Fetch the next lemma published by another thread for the given
+   * thread.  Never blocks.  Returns false if there is none.
+   */
+  bool fetch(unsigned thread, expr::pickle::Pickle& lemma);
+
+  /** The number of duplicate lemmas the given thread didn't fetch. */
+  uint64_t getDuplicates(unsigned thread) const {
+    return d_threads[thread].d_duplicates;
+  }
+
+private:
+  LemmaHub(const LemmaHub&) CVC4_UNDEFINED;
+  LemmaHub& operator=(const LemmaHub&) CVC4_UNDEFINED;
+
+  /** Hash of the words of a pickle, equal for structurally equal lemmas. */
+  struct WordsHashFunction {
+    size_t operator()(const std::vector<uint32_t>& words) const;
+  };/* struct LemmaHub::WordsHashFunction */
+
+  /** The state of a thread, only accessed by that thread. */
+  struct ThreadState {
+    /** The encoding buffer. */
+    std::vector<uint32_t> d_words;
+    /** The words of the lemmas published or fetched. */
+    std::unordered_set<std::vector<uint32_t>, WordsHashFunction> d_seen;
+    /** The total number of words in d_seen. */
+    size_t d_seenWords;
+    uint64_t d_duplicates;
+
+    ThreadState() : d_seenWords(0), d_duplicates(0) {}
+  };/* struct LemmaHub::ThreadState */
+
+  /**
+   * Remember the lemma in the encoding buffer of the given thread.
+   * Returns false if it was already remembered.
+   */
+  bool remember(ThreadState& state);
+
+  std::unique_ptr<prop::ClauseExchange> d_exchange;
+
+  bool d_filterDuplicates;
+
+  /** The number of words of lemmas each thread remembers. */
+  size_t d_capacity;
+
+  std::vector<ThreadState> d_threads;
+};/* class LemmaHub */
+
+}/* CVC4 namespace */
+
+#endif /* __CVC4__SMT_UTIL__LEMMA_HUB_H */
@@ -0,0 +1,498 @@
+/*********************                                                        */
+/*! \file approx_double.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A built-in floating-point simplex for the real relaxation.
+ **
+ ** A built-in floating-point simplex for the real relaxation.
+ **/
+
+#include "theory/arith/approx_double.h"
+
+#include <cmath>
+#include <unordered_set>
+
+#include "base/output.h"
+#include "theory/arith/partial_model.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+namespace {
+
+/** Coefficients smaller than this are dropped. */
+const double DROP_TOLERANCE = 1e-12;
+/** Coefficients smaller than this are not pivoted on. */
+const double PIVOT_TOLERANCE = 1e-9;
+/** The number of pivots after which the basic values are recomputed. */
+const int REFRESH_INTERVAL = 100;
+/** The number of updates after which the basis is factored again. */
+const size_t REFACTOR_INTERVAL = 100;
+
+/** The amount by which a value may exceed the bound b. */
+double boundTolerance(double b)
+{
+  return ApproximateSimplex::SMALL_FIXED_DELTA * std::max(1.0, std::fabs(b));
+}
+
+}  // namespace
+
+const size_t ApproxDouble::NO_SLOT = size_t(-1);
+
+ApproxDouble::ApproxDouble(const ArithVariables& v,
+                           const Tableau& tableau,
+                           bool factored,
+                           TreeLog& l,
+                           ApproximateStatistics& s)
+    : ApproximateSimplex(v, l, s),
+      d_factored(factored),
+      d_pivots(0),
+      d_refactorizations(0)
+{
+  size_t n = d_vars.getNumberOfVariables();
+  d_slotOf.assign(n, NO_SLOT);
+  d_value.assign(n, 0.0);
+  d_lower.assign(n, -HUGE_VAL);
+  d_upper.assign(n, HUGE_VAL);
+  d_leftAt.assign(n, 0);
+  if (d_factored)
+  {
+    d_matrixColumns.resize(n);
+  }
+  else
+  {
+    d_column.resize(n);
+  }
+
+  for (ArithVariables::var_iterator i = d_vars.var_begin(),
+                                    i_end = d_vars.var_end();
+       i != i_end;
+       ++i)
+  {
+    ArithVar x = *i;
+    d_value[x] = d_vars.getAssignment(x).approx(SMALL_FIXED_DELTA);
+    if (d_vars.hasLowerBound(x))
+    {
+      d_lower[x] = d_vars.getLowerBound(x).approx(SMALL_FIXED_DELTA);
+    }
+    if (d_vars.hasUpperBound(x))
+    {
+      d_upper[x] = d_vars.getUpperBound(x).approx(SMALL_FIXED_DELTA);
+    }
+  }
+
+  for (Tableau::BasicIterator i = tableau.beginBasic(),
+                              i_end = tableau.endBasic();
+       i != i_end;
+       ++i)
+  {
+    ArithVar basic = *i;
+    size_t slot = d_basic.size();
+    d_basic.push_back(basic);
+    d_slotOf[basic] = slot;
+    if (d_factored)
+    {
+      d_matrixRows.push_back(std::vector<std::pair<ArithVar, double> >());
+    }
+    else
+    {
+      d_rows.push_back(std::unordered_map<ArithVar, double>());
+    }
+    for (Tableau::RowIterator ri = tableau.basicRowIterator(basic);
+         !ri.atEnd();
+         ++ri)
+    {
+      const Tableau::Entry& entry = *ri;
+      ArithVar x = entry.getColVar();
+      double c = entry.getCoefficient().getDouble();
+      if (d_factored)
+      {
+        // the row with its basic variable, which is 0
+        d_matrixRows[slot].push_back(std::make_pair(x, c));
+        d_matrixColumns[x].push_back(std::make_pair(slot, c));
+      }
+      else if (x != basic)
+      {
+        d_rows[slot][x] = c;
+        d_column[x].push_back(slot);
+      }
+    }
+  }
+  if (d_factored)
+  {
+    refactor();
+  }
+}
+
+double ApproxDouble::violation(ArithVar x) const
+{
+  double v = d_value[x];
+  if (v < d_lower[x] - boundTolerance(d_lower[x]))
+  {
+    return v - d_lower[x];
+  }
+  if (v > d_upper[x] + boundTolerance(d_upper[x]))
+  {
+    return v - d_upper[x];
+  }
+  return 0.0;
+}
+
+void ApproxDouble::computeRow(size_t slot)
+{
+  d_rowBuffer.clear();
+  if (!d_factored)
+  {
+    d_rowBuffer.assign(d_rows[slot].begin(), d_rows[slot].end());
+    return;
+  }
+
+  // The basic variables are -B^{-1} N times the non-basic ones, so the row
+  // is -(e_slot^T B^{-1}) N.
+  std::vector<double> rho(d_basic.size(), 0.0);
+  rho[slot] = 1.0;
+  d_factors.btran(rho);
+  std::vector<double> alpha(d_value.size(), 0.0);
+  std::vector<ArithVar> touched;
+  for (size_t i = 0; i < rho.size(); ++i)
+  {
+    if (rho[i] == 0.0)
+    {
+      continue;
+    }
+    for (const std::pair<ArithVar, double>& entry : d_matrixRows[i])
+    {
+      ArithVar x = entry.first;
+      if (d_slotOf[x] != NO_SLOT)
+      {
+        continue;
+      }
+      if (alpha[x] == 0.0)
+      {
+        touched.push_back(x);
+      }
+      alpha[x] -= rho[i] * entry.second;
+    }
+  }
+  for (ArithVar x : touched)
+  {
+    if (std::fabs(alpha[x]) >= DROP_TOLERANCE)
+    {
+      d_rowBuffer.push_back(std::make_pair(x, alpha[x]));
+    }
+  }
+}
+
+void ApproxDouble::computeColumn(ArithVar entering)
+{
+  d_columnBuffer.clear();
+  if (!d_factored)
+  {
+    std::unordered_set<size_t> seen;
+    for (size_t slot : d_column[entering])
+    {
+      std::unordered_map<ArithVar, double>::const_iterator it =
+          d_rows[slot].find(entering);
+      if (it != d_rows[slot].end() && seen.insert(slot).second)
+      {
+        d_columnBuffer.push_back(std::make_pair(slot, it->second));
+      }
+    }
+    return;
+  }
+
+  std::vector<double> d(d_basic.size(), 0.0);
+  for (const std::pair<size_t, double>& entry : d_matrixColumns[entering])
+  {
+    d[entry.first] = entry.second;
+  }
+  d_factors.ftran(d, true);
+  for (size_t slot = 0; slot < d.size(); ++slot)
+  {
+    if (std::fabs(d[slot]) >= DROP_TOLERANCE)
+    {
+      d_columnBuffer.push_back(std::make_pair(slot, -d[slot]));
+    }
+  }
+}
+
+size_t ApproxDouble::selectEntering(bool increase) const
+{
+  size_t best = d_rowBuffer.size();
+  for (size_t i = 0; i < d_rowBuffer.size(); ++i)
+  {
+    ArithVar x = d_rowBuffer[i].first;
+    double a = d_rowBuffer[i].second;
+    if (std::fabs(a) < PIVOT_TOLERANCE
+        || (best < d_rowBuffer.size() && x > d_rowBuffer[best].first))
+    {
+      continue;
+    }
+    // increasing the basic variable increases x iff a > 0
+    bool up = (a > 0) == increase;
+    if (up ? d_value[x] < d_upper[x] : d_value[x] > d_lower[x])
+    {
+      best = i;
+    }
+  }
+  return best;
+}
+
+bool ApproxDouble::pivot(size_t slot, ArithVar entering)
+{
+  ArithVar leaving = d_basic[slot];
+  if (!d_factored)
+  {
+    pivotRows(slot, entering);
+  }
+  d_basic[slot] = entering;
+  d_slotOf[leaving] = NO_SLOT;
+  d_slotOf[entering] = slot;
+  ++d_pivots;
+
+  if (d_factored
+      && (d_factors.getNumUpdates() >= REFACTOR_INTERVAL
+          || !d_factors.update(slot)))
+  {
+    ++d_refactorizations;
+    return refactor();
+  }
+  return true;
+}
+
+void ApproxDouble::pivotRows(size_t slot, ArithVar entering)
+{
+  std::unordered_map<ArithVar, double>& row = d_rows[slot];
+  ArithVar leaving = d_basic[slot];
+  double a = row[entering];
+
+  // solve the row for the entering variable
+  row.erase(entering);
+  for (std::pair<const ArithVar, double>& entry : row)
+  {
+    entry.second = -entry.second / a;
+  }
+  row[leaving] = 1.0 / a;
+  d_column[leaving].push_back(slot);
+
+  // and substitute it into the other rows
+  std::vector<size_t> column;
+  column.swap(d_column[entering]);
+  for (size_t other : column)
+  {
+    if (other == slot)
+    {
+      continue;
+    }
+    std::unordered_map<ArithVar, double>& entries = d_rows[other];
+    std::unordered_map<ArithVar, double>::iterator it = entries.find(entering);
+    if (it == entries.end())
+    {
+      continue;
+    }
+    double c = it->second;
+    entries.erase(it);
+    for (const std::pair<const ArithVar, double>& entry : row)
+    {
+      std::unordered_map<ArithVar, double>::iterator jt =
+          entries.find(entry.first);
+      if (jt == entries.end())
+      {
+        entries[entry.first] = c * entry.second;
+        d_column[entry.first].push_back(other);
+      }
+      else
+      {
+        jt->second += c * entry.second;
+        if (std::fabs(jt->second) < DROP_TOLERANCE)
+        {
+          entries.erase(jt);
+        }
+      }
+    }
+  }
+}
+
+bool ApproxDouble::refactor()
+{
+  std::vector<BasisFactorization::SparseVector> columns;
+  for (ArithVar basic : d_basic)
+  {
+    columns.push_back(d_matrixColumns[basic]);
+  }
+  return d_factors.factor(columns);
+}
+
+void ApproxDouble::recomputeBasicValues()
+{
+  if (!d_factored)
+  {
+    for (size_t slot = 0; slot < d_rows.size(); ++slot)
+    {
+      double sum = 0.0;
+      for (const std::pair<const ArithVar, double>& entry : d_rows[slot])
+      {
+        sum += entry.second * d_value[entry.first];
+      }
+      d_value[d_basic[slot]] = sum;
+    }
+    return;
+  }
+
+  // B x_B = -N x_N
+  std::vector<double> rhs(d_basic.size(), 0.0);
+  for (size_t i = 0; i < d_matrixRows.size(); ++i)
+  {
+    for (const std::pair<ArithVar, double>& entry : d_matrixRows[i])
+    {
+      if (d_slotOf[entry.first] == NO_SLOT)
+      {
+        rhs[i] -= entry.second * d_value[entry.first];
+      }
+    }
+  }
+  d_factors.ftran(rhs, false);
+  for (size_t slot = 0; slot < rhs.size(); ++slot)
+  {
+    d_value[d_basic[slot]] = rhs[slot];
+  }
+}
+
+LinResult ApproxDouble::solveRelaxation()
+{
+  for (;;)
+  {
+    // Bland's rule: the smallest violated basic variable, and the smallest
+    // variable that can move it
+    size_t slot = NO_SLOT;
+    for (size_t i = 0; i < d_basic.size(); ++i)
+    {
+      if (violation(d_basic[i]) != 0.0
+          && (slot == NO_SLOT || d_basic[i] < d_basic[slot]))
+      {
+        slot = i;
+      }
+    }
+    if (slot == NO_SLOT)
+    {
+      recomputeBasicValues();
+      bool feasible = true;
+      for (ArithVar basic : d_basic)
+      {
+        feasible = feasible && violation(basic) == 0.0;
+      }
+      if (feasible)
+      {
+        Debug("arith::approx::double")
+            << "feasible after " << d_pivots << " pivots" << std::endl;
+        return LinFeasible;
+      }
+      continue;
+    }
+    if (d_pivots >= d_pivotLimit)
+    {
+      return LinExhausted;
+    }
+
+    ArithVar leaving = d_basic[slot];
+    bool increase = violation(leaving) < 0;
+    computeRow(slot);
+    size_t e = selectEntering(increase);
+    if (e == d_rowBuffer.size())
+    {
+      Debug("arith::approx::double")
+          << "infeasible row " << leaving << " after " << d_pivots
+          << " pivots" << std::endl;
+      return LinInfeasible;
+    }
+    ArithVar entering = d_rowBuffer[e].first;
+    double target = increase ? d_lower[leaving] : d_upper[leaving];
+    double theta = (target - d_value[leaving]) / d_rowBuffer[e].second;
+
+    computeColumn(entering);
+    d_value[entering] += theta;
+    for (const std::pair<size_t, double>& entry : d_columnBuffer)
+    {
+      d_value[d_basic[entry.first]] += entry.second * theta;
+    }
+    d_value[leaving] = target;
+    d_leftAt[leaving] = increase ? -1 : 1;
+
+    if (!pivot(slot, entering))
+    {
+      Debug("arith::approx::double")
+          << "singular basis after " << d_pivots << " pivots" << std::endl;
+      return LinUnknown;
+    }
+    if (d_pivots % REFRESH_INTERVAL == 0)
+    {
+      recomputeBasicValues();
+    }
+  }
+}
+
+ApproximateSimplex::Solution ApproxDouble::extractRelaxation() const
+{
+  Solution sol;
+  for (ArithVariables::var_iterator i = d_vars.var_begin(),
+                                    i_end = d_vars.var_end();
+       i != i_end;
+       ++i)
+  {
+    ArithVar x = *i;
+    if (d_slotOf[x] != NO_SLOT)
+    {
+      sol.newBasis.add(x);
+      sol.newValues.set(x, d_vars.getAssignment(x));
+    }
+    else if (d_leftAt[x] < 0)
+    {
+      sol.newValues.set(x, d_vars.getLowerBound(x));
+    }
+    else if (d_leftAt[x] > 0)
+    {
+      sol.newValues.set(x, d_vars.getUpperBound(x));
+    }
+    else
+    {
+      sol.newValues.set(x, d_vars.getAssignment(x));
+    }
+  }
+  return sol;
+}
+
+double ApproxDouble::sumInfeasibilities(bool mip) const
+{
+  double sum = 0.0;
+  for (ArithVar basic : d_basic)
+  {
+    sum += std::fabs(violation(basic));
+  }
+  return sum;
+}
+
+size_t ApproxDouble::getNumNonzeros() const
+{
+  size_t nonzeros = 0;
+  for (const std::unordered_map<ArithVar, double>& row : d_rows)
+  {
+    nonzeros += row.size();
+  }
+  for (const std::vector<std::pair<ArithVar, double> >& row : d_matrixRows)
+  {
+    nonzeros += row.size();
+  }
+  return d_factored ? nonzeros + d_factors.getNumNonzeros() : nonzeros;
+}
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
@@ -0,0 +1,189 @@
+/*********************                                                        */
+/*! \file approx_double.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A built-in floating-point simplex for the real relaxation.
+ **
+ ** ApproxDouble copies the current tableau and bounds into doubles and
+ ** searches for a feasible basis there, with the same Bland-style rule
+ ** that the exact simplex falls back to.  The basis it ends in is imported
+ ** by AttemptSolutionSDP, which pivots the exact tableau to it and checks
+ ** the result in rational arithmetic.  It needs no external library, unlike
+ ** ApproxGLPK, and only solves the relaxation.
+ **
+ ** The basis is either kept as a copy of the tableau in row form, which is
+ ** pivoted like the exact tableau, or as the rows of the tableau at the
+ ** start and a BasisFactorization of the basis columns, as in a revised
+ ** simplex.  The latter doesn't fill in the rows, only the factors.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "theory/arith/approx_simplex.h"
+#include "theory/arith/basis_factorization.h"
+#include "theory/arith/tableau.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+class ApproxDouble : public ApproximateSimplex {
+ public:
+  /**
+   * Copies the tableau, and the bounds and assignment of its variables.
+   * The search starts from the basis of the tableau, which is factored if
+   * factored is set.
+   */
+  ApproxDouble(const ArithVariables& v,
+               const Tableau& tableau,
+               bool factored,
+               TreeLog& l,
+               ApproximateStatistics& s);
+  ~ApproxDouble() {}
+
+  /**
+   * Pivots until the basic variables are within their bounds, up to
+   * rounding, or a row shows that this is impossible, or the pivot limit
+   * is reached.
+   */
+  LinResult solveRelaxation() override;
+
+  /**
+   * The basis the search ended in.  The non-basic variables keep their
+   * exact values, which are either their assignment before the search or
+   * the bound they left the basis at.
+   */
+  Solution extractRelaxation() const override;
+
+  /** The number of pivots done by solveRelaxation(). */
+  int getPivots() const { return d_pivots; }
+
+  /** The number of times the basis was factored again. */
+  int getRefactorizations() const { return d_refactorizations; }
+
+  /**
+   * The number of nonzeros kept to represent the basis, which are those of
+   * the rows, and of the factors if the basis is factored.
+   */
+  size_t getNumNonzeros() const;
+
+  ArithRatPairVec heuristicOptCoeffs() const override
+  {
+    return ArithRatPairVec();
+  }
+
+  MipResult solveMIP(bool al) override { return MipUnknown; }
+  Solution extractMIP() const override { return Solution(); }
+
+  void setOptCoeffs(const ArithRatPairVec& ref) override {}
+
+  void tryCut(int nid, CutInfo& cut) override {}
+
+  std::vector<const CutInfo*> getValidCuts(const NodeLog& node) override
+  {
+    return std::vector<const CutInfo*>();
+  }
+
+  ArithVar getBranchVar(const NodeLog& nl) const override
+  {
+    return ARITHVAR_SENTINEL;
+  }
+
+  double sumInfeasibilities(bool mip) const override;
+
+ private:
+  /** How far x is below its lower bound (< 0) or above its upper (> 0). */
+  double violation(ArithVar x) const;
+
+  /**
+   * Sets d_rowBuffer to the coefficients of the non-basic variables in the
+   * row of the basic variable of the slot.
+   */
+  void computeRow(size_t slot);
+
+  /**
+   * Sets d_columnBuffer to the rate at which the basic variable of each
+   * slot changes with the non-basic variable.
+   */
+  void computeColumn(ArithVar entering);
+
+  /**
+   * Selects the entry of d_rowBuffer whose variable moves the basic
+   * variable towards its bound, increasing it if increase is set.  Returns
+   * its index, or the size of the buffer if there is none.
+   */
+  size_t selectEntering(bool increase) const;
+
+  /**
+   * Swaps the basic variable of the slot with the entering variable, whose
+   * column was the last computed.  Returns false if the basis can't be
+   * factored any more.
+   */
+  bool pivot(size_t slot, ArithVar entering);
+
+  /** Substitutes the entering variable through the rows. */
+  void pivotRows(size_t slot, ArithVar entering);
+
+  /** Factors the current basis again. */
+  bool refactor();
+
+  /** Recomputes the values of the basic variables. */
+  void recomputeBasicValues();
+
+  static const size_t NO_SLOT;
+
+  /** For each slot, its basic variable. */
+  std::vector<ArithVar> d_basic;
+  /** For each variable, its slot if basic, and NO_SLOT otherwise. */
+  std::vector<size_t> d_slotOf;
+
+  std::vector<double> d_value;
+  std::vector<double> d_lower;
+  std::vector<double> d_upper;
+  /**
+   * For each non-basic variable, whether it is at its original
+   * assignment (0), or was left at its lower (-1) or upper (1) bound.
+   */
+  std::vector<int> d_leftAt;
+
+  bool d_factored;
+
+  /**
+   * In row form, the row of each slot without its basic variable, which is
+   * the sum of the entries.  For each variable, the slots whose rows it
+   * occurs in, which may list a slot more than once, or slots it was
+   * dropped from.
+   */
+  std::vector<std::unordered_map<ArithVar, double> > d_rows;
+  std::vector<std::vector<size_t> > d_column;
+
+  /**
+   * If factored, the rows at the start, by rows and columns, each with its
+   * basic variable at the time, and the factors of the current basis.
+   */
+  std::vector<std::vector<std::pair<ArithVar, double> > > d_matrixRows;
+  std::vector<BasisFactorization::SparseVector> d_matrixColumns;
+  BasisFactorization d_factors;
+
+  std::vector<std::pair<ArithVar, double> > d_rowBuffer;
+  std::vector<std::pair<size_t, double> > d_columnBuffer;
+
+  int d_pivots;
+  int d_refactorizations;
+};/* class ApproxDouble */
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
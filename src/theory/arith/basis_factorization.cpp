@@ -0,0 +1,433 @@
+/*********************                                                        */
+/*! \file basis_factorization.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A sparse LU factorization of a simplex basis.
+ **
+ ** A sparse LU factorization of a simplex basis.
+ **/
+
+#include "theory/arith/basis_factorization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_set>
+
+#include "base/cvc4_assert.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+namespace {
+
+/** Entries smaller than this are dropped. */
+const double DROP_TOLERANCE = 1e-12;
+/**
+ * An entry is only a pivot candidate if it is at least this fraction of
+ * the largest entry of its column.
+ */
+const double PIVOT_THRESHOLD = 0.1;
+/** Pivots smaller than this, relative to their column, are singular. */
+const double SINGULAR_TOLERANCE = 1e-9;
+
+}  // namespace
+
+BasisFactorization::BasisFactorization(size_t m)
+    : d_uRows(m), d_uCols(m), d_pivotRow(m), d_rank(m), d_nextRank(0),
+      d_updates(0)
+{
+  for (size_t s = 0; s < m; ++s)
+  {
+    setU(s, s, 1.0);
+    appendPivot(s, s);
+  }
+}
+
+void BasisFactorization::clear()
+{
+  size_t m = getDimension();
+  d_etas.clear();
+  d_uRows.assign(m, std::unordered_map<size_t, double>());
+  d_uCols.assign(m, std::unordered_map<size_t, double>());
+  d_order.clear();
+  d_nextRank = 0;
+  d_spike.clear();
+  d_updates = 0;
+}
+
+void BasisFactorization::appendPivot(size_t slot, size_t row)
+{
+  d_order.push_back(slot);
+  d_pivotRow[slot] = row;
+  d_rank[slot] = d_nextRank++;
+}
+
+void BasisFactorization::setU(size_t row, size_t slot, double value)
+{
+  if (std::fabs(value) < DROP_TOLERANCE)
+  {
+    d_uRows[row].erase(slot);
+    d_uCols[slot].erase(row);
+  }
+  else
+  {
+    d_uRows[row][slot] = value;
+    d_uCols[slot][row] = value;
+  }
+}
+
+bool BasisFactorization::factor(const std::vector<SparseVector>& columns)
+{
+  size_t m = columns.size();
+  d_pivotRow.resize(m);
+  d_rank.resize(m);
+  clear();
+
+  // the active submatrix, by rows with values and by columns
+  std::vector<std::unordered_map<size_t, double> > rows(m);
+  std::vector<std::unordered_set<size_t> > cols(m);
+  std::vector<size_t> activeCols;
+  for (size_t s = 0; s < m; ++s)
+  {
+    for (const std::pair<size_t, double>& entry : columns[s])
+    {
+      if (std::fabs(entry.second) >= DROP_TOLERANCE)
+      {
+        rows[entry.first][s] = entry.second;
+        cols[s].insert(entry.first);
+      }
+    }
+    activeCols.push_back(s);
+  }
+
+  while (!activeCols.empty())
+  {
+    // Markowitz: the entry with the fewest other entries in its row and
+    // column among those that are not too small for their column
+    size_t bestCost = std::numeric_limits<size_t>::max();
+    size_t p = 0, j = 0, jIndex = 0;
+    for (size_t c = 0; c < activeCols.size() && bestCost > 0; ++c)
+    {
+      size_t col = activeCols[c];
+      double colMax = 0.0;
+      for (size_t i : cols[col])
+      {
+        colMax = std::max(colMax, std::fabs(rows[i][col]));
+      }
+      if (colMax < SINGULAR_TOLERANCE)
+      {
+        return false;
+      }
+      for (size_t i : cols[col])
+      {
+        size_t cost = (rows[i].size() - 1) * (cols[col].size() - 1);
+        if (cost < bestCost && std::fabs(rows[i][col]) >= PIVOT_THRESHOLD * colMax)
+        {
+          bestCost = cost;
+          p = i;
+          j = col;
+          jIndex = c;
+        }
+      }
+    }
+
+    // eliminate the column below the pivot
+    double a = rows[p][j];
+    Eta eta;
+    eta.d_pivot = p;
+    eta.d_row = false;
+    for (size_t i : cols[j])
+    {
+      if (i == p)
+      {
+        continue;
+      }
+      std::unordered_map<size_t, double>& row = rows[i];
+      double mult = row[j] / a;
+      row.erase(j);
+      for (const std::pair<const size_t, double>& entry : rows[p])
+      {
+        size_t k = entry.first;
+        if (k == j)
+        {
+          continue;
+        }
+        std::unordered_map<size_t, double>::iterator it = row.find(k);
+        if (it == row.end())
+        {
+          row[k] = -mult * entry.second;
+          cols[k].insert(i);
+        }
+        else
+        {
+          it->second -= mult * entry.second;
+          if (std::fabs(it->second) < DROP_TOLERANCE)
+          {
+            row.erase(it);
+            cols[k].erase(i);
+          }
+        }
+      }
+      eta.d_entries.push_back(std::make_pair(i, mult));
+    }
+    if (!eta.d_entries.empty())
+    {
+      d_etas.push_back(eta);
+    }
+
+    // the pivot row is a row of U
+    for (const std::pair<const size_t, double>& entry : rows[p])
+    {
+      setU(p, entry.first, entry.second);
+      cols[entry.first].erase(p);
+    }
+    rows[p].clear();
+    cols[j].clear();
+    appendPivot(j, p);
+    activeCols[jIndex] = activeCols.back();
+    activeCols.pop_back();
+  }
+  return true;
+}
+
+void BasisFactorization::ftran(std::vector<double>& v, bool saveSpike)
+{
+  size_t m = getDimension();
+  Assert(v.size() == m);
+  for (const Eta& eta : d_etas)
+  {
+    if (eta.d_row)
+    {
+      double sum = 0.0;
+      for (const std::pair<size_t, double>& entry : eta.d_entries)
+      {
+        sum += entry.second * v[entry.first];
+      }
+      v[eta.d_pivot] -= sum;
+    }
+    else if (v[eta.d_pivot] != 0.0)
+    {
+      double vp = v[eta.d_pivot];
+      for (const std::pair<size_t, double>& entry : eta.d_entries)
+      {
+        v[entry.first] -= entry.second * vp;
+      }
+    }
+  }
+
+  if (saveSpike)
+  {
+    d_spike.clear();
+    for (size_t i = 0; i < m; ++i)
+    {
+      if (std::fabs(v[i]) >= DROP_TOLERANCE)
+      {
+        d_spike.push_back(std::make_pair(i, v[i]));
+      }
+    }
+  }
+
+  // back substitution through U, from the last pivot
+  std::vector<double> x(m, 0.0);
+  for (std::vector<size_t>::const_reverse_iterator k = d_order.rbegin(),
+                                                   k_end = d_order.rend();
+       k != k_end;
+       ++k)
+  {
+    size_t j = *k;
+    size_t i = d_pivotRow[j];
+    if (v[i] == 0.0)
+    {
+      continue;
+    }
+    const std::unordered_map<size_t, double>& col = d_uCols[j];
+    double xj = v[i] / col.find(i)->second;
+    x[j] = xj;
+    for (const std::pair<const size_t, double>& entry : col)
+    {
+      if (entry.first != i)
+      {
+        v[entry.first] -= entry.second * xj;
+      }
+    }
+  }
+  v.swap(x);
+}
+
+void BasisFactorization::btran(std::vector<double>& v) const
+{
+  size_t m = getDimension();
+  Assert(v.size() == m);
+
+  // forward substitution through U^T, from the first pivot
+  std::vector<double> z(m, 0.0);
+  for (size_t j : d_order)
+  {
+    if (v[j] == 0.0)
+    {
+      continue;
+    }
+    size_t i = d_pivotRow[j];
+    const std::unordered_map<size_t, double>& row = d_uRows[i];
+    double zi = v[j] / row.find(j)->second;
+    z[i] = zi;
+    for (const std::pair<const size_t, double>& entry : row)
+    {
+      if (entry.first != j)
+      {
+        v[entry.first] -= entry.second * zi;
+      }
+    }
+  }
+
+  // then through L^{-1}, transposed
+  for (std::vector<Eta>::const_reverse_iterator e = d_etas.rbegin(),
+                                                e_end = d_etas.rend();
+       e != e_end;
+       ++e)
+  {
+    if (e->d_row)
+    {
+      double zp = z[e->d_pivot];
+      if (zp != 0.0)
+      {
+        for (const std::pair<size_t, double>& entry : e->d_entries)
+        {
+          z[entry.first] -= entry.second * zp;
+        }
+      }
+    }
+    else
+    {
+      double sum = 0.0;
+      for (const std::pair<size_t, double>& entry : e->d_entries)
+      {
+        sum += entry.second * z[entry.first];
+      }
+      z[e->d_pivot] -= sum;
+    }
+  }
+  v.swap(z);
+}
+
+bool BasisFactorization::update(size_t slot)
+{
+  size_t r = d_pivotRow[slot];
+
+  // replace the column of U by the spike
+  double spikeMax = 0.0;
+  for (const std::pair<const size_t, double>& entry : d_uCols[slot])
+  {
+    d_uRows[entry.first].erase(slot);
+  }
+  d_uCols[slot].clear();
+  for (const std::pair<size_t, double>& entry : d_spike)
+  {
+    setU(entry.first, slot, entry.second);
+    spikeMax = std::max(spikeMax, std::fabs(entry.second));
+  }
+  d_spike.clear();
+
+  // The spike has entries below the diagonal, so the slot is moved to the
+  // end of the order.  Then the row of its pivot has entries in the slots
+  // that now come before it, which are eliminated in order with the rows of
+  // their pivots.
+  d_order.erase(std::find(d_order.begin(), d_order.end(), slot));
+  d_order.push_back(slot);
+  d_rank[slot] = d_nextRank++;
+
+  typedef std::pair<size_t, size_t> RankedSlot;
+  std::priority_queue<RankedSlot,
+                      std::vector<RankedSlot>,
+                      std::greater<RankedSlot> >
+      toEliminate;
+  for (const std::pair<const size_t, double>& entry : d_uRows[r])
+  {
+    if (entry.first != slot)
+    {
+      toEliminate.push(RankedSlot(d_rank[entry.first], entry.first));
+    }
+  }
+
+  Eta eta;
+  eta.d_pivot = r;
+  eta.d_row = true;
+  while (!toEliminate.empty())
+  {
+    size_t j = toEliminate.top().second;
+    toEliminate.pop();
+    std::unordered_map<size_t, double>::const_iterator it = d_uRows[r].find(j);
+    if (it == d_uRows[r].end())
+    {
+      continue;
+    }
+    size_t i = d_pivotRow[j];
+    const std::unordered_map<size_t, double>& pivotRow = d_uRows[i];
+    double mult = it->second / pivotRow.find(j)->second;
+    eta.d_entries.push_back(std::make_pair(i, mult));
+    for (const std::pair<const size_t, double>& entry : pivotRow)
+    {
+      size_t k = entry.first;
+      if (k == j)
+      {
+        d_uRows[r].erase(j);
+        d_uCols[j].erase(r);
+        continue;
+      }
+      std::unordered_map<size_t, double>::const_iterator rk =
+          d_uRows[r].find(k);
+      if (rk == d_uRows[r].end())
+      {
+        setU(r, k, -mult * entry.second);
+        if (k != slot)
+        {
+          toEliminate.push(RankedSlot(d_rank[k], k));
+        }
+      }
+      else
+      {
+        setU(r, k, rk->second - mult * entry.second);
+      }
+    }
+  }
+  if (!eta.d_entries.empty())
+  {
+    d_etas.push_back(eta);
+  }
+  ++d_updates;
+
+  std::unordered_map<size_t, double>::const_iterator diag =
+      d_uRows[r].find(slot);
+  return diag != d_uRows[r].end()
+         && std::fabs(diag->second)
+                >= SINGULAR_TOLERANCE * std::max(1.0, spikeMax);
+}
+
+size_t BasisFactorization::getNumNonzeros() const
+{
+  size_t nonzeros = 0;
+  for (const Eta& eta : d_etas)
+  {
+    nonzeros += eta.d_entries.size();
+  }
+  for (const std::unordered_map<size_t, double>& row : d_uRows)
+  {
+    nonzeros += row.size();
+  }
+  return nonzeros;
+}
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
@@ -0,0 +1,130 @@
+/*********************                                                        */
+/*! \file basis_factorization.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief A sparse LU factorization of a simplex basis.
+ **
+ ** The tableau keeps every row eliminated, so a pivot rewrites all rows
+ ** of the entering variable, and rows fill in.  A revised simplex only
+ ** keeps the original rows and a factorization B = LU of the basis
+ ** columns, from which it computes the one row and column a pivot needs.
+ ** The factorization is computed with Markowitz pivoting, and a change of
+ ** basis column is a Forrest-Tomlin update, which replaces the column of
+ ** U and restores triangularity with one row transformation.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+/**
+ * A factorization of an m by m basis in doubles.  The rows of the basis are
+ * numbered 0..m-1, and so are its columns, called slots.
+ */
+class BasisFactorization
+{
+ public:
+  /** A sparse vector of (index, value) pairs. */
+  typedef std::vector<std::pair<size_t, double> > SparseVector;
+
+  /** The factorization of the m by m identity matrix. */
+  BasisFactorization(size_t m = 0);
+
+  size_t getDimension() const { return d_pivotRow.size(); }
+
+  /**
+   * Factors the basis whose column in slot s is columns[s], which may
+   * change its dimension.  Returns false if the basis is singular, up to
+   * rounding.
+   */
+  bool factor(const std::vector<SparseVector>& columns);
+
+  /**
+   * Solves B x = a.  The argument is a, indexed by rows, and x, indexed by
+   * slots, is returned in it.  If saveSpike is set, the next update() may
+   * put a in the basis.
+   */
+  void ftran(std::vector<double>& v, bool saveSpike);
+
+  /**
+   * Solves y^T B = c^T.  The argument is c, indexed by slots, and y,
+   * indexed by rows, is returned in it.
+   */
+  void btran(std::vector<double>& v) const;
+
+  /**
+   * Replaces the column of the slot by the column last given to ftran()
+   * with saveSpike set.  Returns false if the new basis is singular, up to
+   * rounding, in which case the basis has to be factored again.
+   */
+  bool update(size_t slot);
+
+  /** The number of updates since the basis was factored. */
+  size_t getNumUpdates() const { return d_updates; }
+
+  /** The number of nonzeros in the factors. */
+  size_t getNumNonzeros() const;
+
+ private:
+  /**
+   * An elementary transformation in L^{-1}.  A column transformation
+   * subtracts v[pivot] * m from v[i] for each entry (i, m), and a row
+   * transformation subtracts the sum of m * v[i] from v[pivot].
+   */
+  struct Eta
+  {
+    size_t d_pivot;
+    bool d_row;
+    SparseVector d_entries;
+  };
+
+  void clear();
+
+  /** Appends the slot to the pivot order of U. */
+  void appendPivot(size_t slot, size_t row);
+
+  /** Sets or adds to U[row][slot], dropping it if it becomes tiny. */
+  void setU(size_t row, size_t slot, double value);
+
+  /** L^{-1}, in the order in which it is applied. */
+  std::vector<Eta> d_etas;
+
+  /** U, by rows (slot to value) and by columns (row to value). */
+  std::vector<std::unordered_map<size_t, double> > d_uRows;
+  std::vector<std::unordered_map<size_t, double> > d_uCols;
+
+  /**
+   * The slots in the order of their pivots, U being upper triangular in
+   * this order.  A slot is pivoted on the row d_pivotRow[slot], and a
+   * slot that comes later in the order has a larger rank.
+   */
+  std::vector<size_t> d_order;
+  std::vector<size_t> d_pivotRow;
+  std::vector<size_t> d_rank;
+  size_t d_nextRank;
+
+  /** The last vector given to ftran() with saveSpike set, after L^{-1}. */
+  SparseVector d_spike;
+
+  size_t d_updates;
+};/* class BasisFactorization */
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
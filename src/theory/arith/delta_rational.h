@@ -129,8 +129,9 @@ public:
 
 
   DeltaRational operator-(const DeltaRational& a) const{
-    CVC4::Rational negOne(CVC4::Integer(-1));
-    return *(this) + (a * negOne);
+    CVC4::Rational tmpC = c-a.c;
+    CVC4::Rational tmpK = k-a.k;
+    return DeltaRational(tmpC, tmpK);
   }
 
   DeltaRational operator-() const{
@@ -168,7 +169,7 @@ public:
     if(sgn() >= 0){
       return *this;
     }else{
-      return (*this) * Rational(-1);
+      return -(*this);
     }
   }
 
@@ -0,0 +1,210 @@
+/*********************                                                        */
+/*! \file integer_cuts.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Cuts for integer problems from the rows of the exact tableau.
+ **
+ ** Cuts for integer problems from the rows of the exact tableau.
+ **/
+
+#include "theory/arith/integer_cuts.h"
+
+#include <vector>
+
+#include "base/output.h"
+#include "theory/arith/partial_model.h"
+#include "theory/arith/tableau.h"
+
+using namespace std;
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+void IntegerCut::clear(){
+  d_lhs.purge();
+  d_kind = kind::GEQ;
+  d_rhs = Rational(0);
+  d_explanation.clear();
+}
+
+IntegerCutGenerator::IntegerCutGenerator(const ArithVariables& vars,
+                                         const Tableau& tableau)
+  : d_variables(vars)
+  , d_tableau(tableau)
+{}
+
+bool IntegerCutGenerator::isCandidate(ArithVar basic) const{
+  const DeltaRational& beta = d_variables.getAssignment(basic);
+  return d_tableau.isBasic(basic) && d_variables.isInteger(basic) &&
+    beta.infinitesimalIsZero() && !beta.isIntegral();
+}
+
+bool IntegerCutGenerator::gomory(ArithVar basic, IntegerCut& cut) const{
+  Assert(isCandidate(basic));
+
+  // The row is basic = sum c_j x_j.  Each nonbasic x_j is at a bound, so
+  // t_j = x_j - l_j or t_j = u_j - x_j is 0 now and >= 0 in any solution,
+  // and basic + sum a_j t_j = beta with a_j = -c_j or c_j.  With f0 the
+  // fractional part of beta, and f_j that of a_j, the cut is
+  //   sum_{j int, f_j <= f0} f_j/f0 t_j + sum_{j int, f_j > f0} (1-f_j)/(1-f0) t_j
+  //   + sum_{j real, a_j > 0} a_j/f0 t_j + sum_{j real, a_j < 0} -a_j/(1-f0) t_j >= 1
+  // where t_j counts as an integer if x_j and its bound are.
+  const Rational& beta = d_variables.getAssignment(basic).getNoninfinitesimalPart();
+  Rational f0 = beta - Rational(beta.floor());
+  Rational oneMinusF0 = Rational(1) - f0;
+
+  cut.clear();
+  cut.d_kind = kind::GEQ;
+  cut.d_rhs = Rational(1);
+  for(Tableau::RowIterator i = d_tableau.basicRowIterator(basic); !i.atEnd(); ++i){
+    const Tableau::Entry& entry = *i;
+    ArithVar v = entry.getColVar();
+    if(v == basic){ continue; }
+
+    const DeltaRational& assignment = d_variables.getAssignment(v);
+    bool atLower = d_variables.hasLowerBound(v) &&
+      assignment == d_variables.getLowerBound(v);
+    bool atUpper = !atLower && d_variables.hasUpperBound(v) &&
+      assignment == d_variables.getUpperBound(v);
+    if(!(atLower || atUpper) || !assignment.infinitesimalIsZero()){
+      return false;
+    }
+
+    const Rational& bound = assignment.getNoninfinitesimalPart();
+    Rational a = atLower ? -entry.getCoefficient() : entry.getCoefficient();
+    Rational g;
+    if(d_variables.isInteger(v) && bound.isIntegral()){
+      Rational fj = a - Rational(a.floor());
+      g = (fj <= f0) ? fj / f0 : (Rational(1) - fj) / oneMinusF0;
+    }else{
+      g = (a.sgn() > 0) ? a / f0 : -a / oneMinusF0;
+    }
+    if(g.isZero()){ continue; }
+
+    // g t_j is g x_j - g l_j or g u_j - g x_j
+    if(atLower){
+      cut.d_lhs.set(v, g);
+      cut.d_rhs += g * bound;
+      cut.d_explanation.push_back(d_variables.getLowerBoundConstraint(v));
+    }else{
+      cut.d_lhs.set(v, -g);
+      cut.d_rhs -= g * bound;
+      cut.d_explanation.push_back(d_variables.getUpperBoundConstraint(v));
+    }
+  }
+
+  // If every g is 0, basic is beta plus a sum of integers whatever the
+  // bounds, and there is nothing to explain.
+  Debug("arith::cuts") << "gomory " << basic << " " << cut.d_lhs.size()
+                       << " " << cut.d_rhs << endl;
+  return !cut.d_explanation.empty();
+}
+
+bool IntegerCutGenerator::gcdTest(ArithVar basic, IntegerCut& cut) const{
+  Assert(d_tableau.isBasic(basic));
+
+  // The row is sum c_j x_j = 0, including basic.  The fixed variables sum
+  // to k, and scaled by the lcm d of the denominators, the rest have to
+  // sum to -d k.
+  cut.clear();
+  Rational k;
+  Integer d(1);
+  vector<Rational> unfixed;
+  for(Tableau::RowIterator i = d_tableau.basicRowIterator(basic); !i.atEnd(); ++i){
+    const Tableau::Entry& entry = *i;
+    ArithVar v = entry.getColVar();
+    const Rational& c = entry.getCoefficient();
+    if(!d_variables.isInteger(v)){
+      return false;
+    }
+    d = d.lcm(c.getDenominator());
+    if(d_variables.boundsAreEqual(v)){
+      const DeltaRational& value = d_variables.getLowerBound(v);
+      if(!value.infinitesimalIsZero() || !value.isIntegral()){
+        return false;
+      }
+      k += c * value.getNoninfinitesimalPart();
+      ConstraintP lb = d_variables.getLowerBoundConstraint(v);
+      ConstraintP ub = d_variables.getUpperBoundConstraint(v);
+      cut.d_explanation.push_back(lb);
+      if(ub != lb){
+        cut.d_explanation.push_back(ub);
+      }
+    }else{
+      unfixed.push_back(c);
+    }
+  }
+  if(unfixed.empty() || cut.d_explanation.empty()){
+    return false;
+  }
+
+  Integer g(0);
+  for(vector<Rational>::const_iterator i = unfixed.begin(), iend = unfixed.end(); i != iend; ++i){
+    Rational scaled = (*i) * Rational(d);
+    Assert(scaled.isIntegral());
+    g = g.gcd(scaled.getNumerator());
+  }
+  Rational dk = k * Rational(d);
+  Assert(dk.isIntegral());
+  if(g.divides(dk.getNumerator())){
+    return false;
+  }
+  Debug("arith::cuts") << "gcd " << basic << " " << g << " " << dk << endl;
+  return true;
+}
+
+bool IntegerCutGenerator::boundedRow(ArithVar basic, IntegerCut& cut) const{
+  Assert(isCandidate(basic));
+  return boundedRow(basic, true, cut) || boundedRow(basic, false, cut);
+}
+
+bool IntegerCutGenerator::boundedRow(ArithVar basic, bool upperBound, IntegerCut& cut) const{
+  // basic = sum c_j x_j is at most (least) the sum of c_j times the upper
+  // (lower) bound of x_j if c_j > 0, and the other bound otherwise
+  cut.clear();
+  DeltaRational sum(0);
+  for(Tableau::RowIterator i = d_tableau.basicRowIterator(basic); !i.atEnd(); ++i){
+    const Tableau::Entry& entry = *i;
+    ArithVar v = entry.getColVar();
+    if(v == basic){ continue; }
+
+    const Rational& c = entry.getCoefficient();
+    bool vUb = (upperBound == (c.sgn() > 0));
+    if(vUb ? !d_variables.hasUpperBound(v) : !d_variables.hasLowerBound(v)){
+      return false;
+    }
+    const DeltaRational& bound = vUb ?
+      d_variables.getUpperBound(v) : d_variables.getLowerBound(v);
+    sum = sum + bound * c;
+    cut.d_explanation.push_back(vUb ?
+                                d_variables.getUpperBoundConstraint(v) :
+                                d_variables.getLowerBoundConstraint(v));
+  }
+  if(cut.d_explanation.empty()){
+    return false;
+  }
+
+  const DeltaRational& beta = d_variables.getAssignment(basic);
+  Rational rounded(upperBound ? sum.floor() : sum.ceiling());
+  if(upperBound ? beta <= DeltaRational(rounded) : beta >= DeltaRational(rounded)){
+    return false;
+  }
+  cut.d_lhs.set(basic, Rational(1));
+  cut.d_kind = upperBound ? kind::LEQ : kind::GEQ;
+  cut.d_rhs = rounded;
+  Debug("arith::cuts") << "boundedRow " << basic << " " << cut.d_kind
+                       << " " << rounded << endl;
+  return true;
+}
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
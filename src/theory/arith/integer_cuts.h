@@ -0,0 +1,103 @@
+/*********************                                                        */
+/*! \file integer_cuts.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Cuts for integer problems from the rows of the exact tableau.
+ **
+ ** The cuts of ApproxGLPK come from the tableaux of GLPK's branch and bound
+ ** search, and have to be reconstructed in exact arithmetic afterwards.
+ ** These are read directly off the tableau, in exact arithmetic, when the
+ ** assignment of an integer basic variable is fractional:
+ **  - a Gomory mixed-integer cut, if every nonbasic variable of the row is
+ **    at a bound,
+ **  - a conflict, if the row over the integers is not solvable with its
+ **    fixed variables at their values, because of the gcd of the
+ **    coefficients of the rest,
+ **  - a bound on the basic variable, if the bounds of the nonbasic
+ **    variables imply one, rounded to an integer.
+ ** Each holds given the bounds of the variables it was derived from.
+ **/
+
+#include "cvc4_private.h"
+
+#pragma once
+
+#include "expr/kind.h"
+#include "theory/arith/arithvar.h"
+#include "theory/arith/constraint_forward.h"
+#include "util/dense_map.h"
+#include "util/rational.h"
+
+namespace CVC4 {
+namespace theory {
+namespace arith {
+
+class ArithVariables;
+class Tableau;
+
+/**
+ * The bounds in d_explanation imply that the sum of d_lhs[v] * v is
+ * related by d_kind (LEQ or GEQ) to d_rhs.  If d_lhs is empty, the bounds
+ * are a conflict.
+ */
+struct IntegerCut {
+  DenseMap<Rational> d_lhs;
+  Kind d_kind;
+  Rational d_rhs;
+  ConstraintCPVec d_explanation;
+
+  bool isConflict() const { return d_lhs.empty(); }
+  void clear();
+};/* struct IntegerCut */
+
+class IntegerCutGenerator {
+public:
+  IntegerCutGenerator(const ArithVariables& vars, const Tableau& tableau);
+
+  /**
+   * Whether basic is an integer variable whose assignment is fractional
+   * and has no infinitesimal part, which each of the cuts requires.
+   */
+  bool isCandidate(ArithVar basic) const;
+
+  /**
+   * The Gomory mixed-integer cut of the row of basic.  Fails unless every
+   * nonbasic variable of the row is assigned a bound without an
+   * infinitesimal part.  The cut is violated by the current assignment.
+   */
+  bool gomory(ArithVar basic, IntegerCut& cut) const;
+
+  /**
+   * Tests whether the row of basic has an integer solution when its fixed
+   * variables are at their values: scaled to coefficients in Z, the gcd of
+   * the coefficients of the other variables has to divide the sum of the
+   * fixed ones.  If it does not, the result is a conflict.  Fails if some
+   * variable of the row is not an integer.
+   */
+  bool gcdTest(ArithVar basic, IntegerCut& cut) const;
+
+  /**
+   * The bound on basic implied by the bounds of the other variables of
+   * its row, rounded to an integer.  Fails unless the row implies such a
+   * bound, and the rounded bound is violated by the current assignment.
+   */
+  bool boundedRow(ArithVar basic, IntegerCut& cut) const;
+
+private:
+  /** Whether the row implies an upper (or lower) bound on basic. */
+  bool boundedRow(ArithVar basic, bool upperBound, IntegerCut& cut) const;
+
+  const ArithVariables& d_variables;
+  const Tableau& d_tableau;
+};/* class IntegerCutGenerator */
+
+}/* CVC4::theory::arith namespace */
+}/* CVC4::theory namespace */
+}/* CVC4 namespace */
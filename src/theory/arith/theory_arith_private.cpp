@@ -40,6 +40,7 @@
 #include "smt/logic_request.h"
 #include "smt/smt_statistics_registry.h"
 #include "smt_util/boolean_simplification.h"
+#include "theory/arith/approx_double.h"
 #include "theory/arith/approx_simplex.h"
 #include "theory/arith/arith_ite_utils.h"
 #include "theory/arith/arith_rewriter.h"
@@ -51,6 +52,7 @@
 #include "theory/arith/cut_log.h"
 #include "theory/arith/delta_rational.h"
 #include "theory/arith/dio_solver.h"
+#include "theory/arith/integer_cuts.h"
 #include "theory/arith/linear_equality.h"
 #include "theory/arith/matrix.h"
 #include "theory/arith/nonlinear_extension.h"
@@ -138,6 +140,7 @@ TheoryArithPrivate::TheoryArithPrivate(TheoryArith& containing,
       d_lastContextIntegerAttempted(c, -1),
 
       d_DELTA_ZERO(0),
+      d_propagationRowVisits(0),
       d_approxCuts(c),
       d_fullCheckCounter(0),
       d_cutCount(c, 0),
@@ -152,6 +155,7 @@ TheoryArithPrivate::TheoryArithPrivate(TheoryArith& containing,
       d_approxStats(NULL),
       d_attemptSolveIntTurnedOff(u, 0),
       d_dioSolveResources(0),
+      d_tableauCutResources(0),
       d_solveIntMaybeHelp(0u),
       d_solveIntAttempts(0u),
       d_statistics(),
@@ -351,6 +355,10 @@ TheoryArithPrivate::Statistics::Statistics()
   , d_boundComputationTime("theory::arith::bound::time")
   , d_boundComputations("theory::arith::bound::boundComputations",0)
   , d_boundPropagations("theory::arith::bound::boundPropagations",0)
+  , d_boundRowVisits("theory::arith::bound::rowVisits",0)
+  , d_boundRowsUnwatched("theory::arith::bound::rowsUnwatched",0)
+  , d_boundBudgetExhausted("theory::arith::bound::budgetExhausted",0)
+  , d_boundPropagationsPerRowVisit("theory::arith::bound::propagationsPerRowVisit")
   , d_unknownChecks("theory::arith::status::unknowns", 0)
   , d_maxUnknownsInARow("theory::arith::status::maxUnknownsInARow", 0)
   , d_avgUnknownsInARow("theory::arith::status::avgUnknownsInARow")
@@ -385,6 +393,15 @@ TheoryArithPrivate::Statistics::Statistics()
   , d_relaxLinInfeasFailures("theory::arith::z::arith::relax::infeasible::failures",0)
   , d_relaxLinExhausted("theory::arith::z::arith::relax::exhausted",0)
   , d_relaxOthers("theory::arith::z::arith::relax::other",0)
+  , d_fpSimplexCalls("theory::arith::fpSimplex::calls",0)
+  , d_fpSimplexFeasible("theory::arith::fpSimplex::feasible",0)
+  , d_fpSimplexInfeasible("theory::arith::fpSimplex::infeasible",0)
+  , d_fpSimplexExhausted("theory::arith::fpSimplex::exhausted",0)
+  , d_fpSimplexRepaired("theory::arith::fpSimplex::repaired",0)
+  , d_fpSimplexPivots("theory::arith::fpSimplex::pivots",0)
+  , d_fpSimplexRefactorizations("theory::arith::fpSimplex::refactorizations",0)
+  , d_fpSimplexMaxNonzeros("theory::arith::fpSimplex::maxNonzeros",0)
+  , d_fpSimplexTimer("theory::arith::fpSimplex::timer")
   , d_applyRowsDeleted("theory::arith::z::arith::cuts::applyRowsDeleted",0)
   , d_replaySimplexTimer("theory::arith::z::approx::replay::simplex::timer")
   , d_replayLogTimer("theory::arith::z::approx::replay::log::timer")
@@ -396,6 +413,11 @@ TheoryArithPrivate::Statistics::Statistics()
   , d_replayAttemptFailed("theory::arith::z::replayAttemptFailed",0)
   , d_cutsRejectedDuringReplay("theory::arith::z::approx::replay::cuts::rejected", 0)
   , d_cutsRejectedDuringLemmas("theory::arith::z::approx::external::cuts::rejected", 0)
+  , d_tableauGomoryCuts("theory::arith::cuts::gomory", 0)
+  , d_tableauGcdConflicts("theory::arith::cuts::gcd", 0)
+  , d_tableauBoundedRowCuts("theory::arith::cuts::boundedRow", 0)
+  , d_tableauCutsRejected("theory::arith::cuts::rejected", 0)
+  , d_tableauCutTimer("theory::arith::cuts::time")
   , d_satPivots("theory::arith::pivots::sat")
   , d_unsatPivots("theory::arith::pivots::unsat")
   , d_unknownPivots("theory::arith::pivots::unknown")
@@ -430,6 +452,10 @@ TheoryArithPrivate::Statistics::Statistics()
   smtStatisticsRegistry()->registerStat(&d_boundComputationTime);
   smtStatisticsRegistry()->registerStat(&d_boundComputations);
   smtStatisticsRegistry()->registerStat(&d_boundPropagations);
+  smtStatisticsRegistry()->registerStat(&d_boundRowVisits);
+  smtStatisticsRegistry()->registerStat(&d_boundRowsUnwatched);
+  smtStatisticsRegistry()->registerStat(&d_boundBudgetExhausted);
+  smtStatisticsRegistry()->registerStat(&d_boundPropagationsPerRowVisit);
 
   smtStatisticsRegistry()->registerStat(&d_unknownChecks);
   smtStatisticsRegistry()->registerStat(&d_maxUnknownsInARow);
@@ -472,6 +498,15 @@ TheoryArithPrivate::Statistics::Statistics()
   smtStatisticsRegistry()->registerStat(&d_relaxLinInfeasFailures);
   smtStatisticsRegistry()->registerStat(&d_relaxLinExhausted);
   smtStatisticsRegistry()->registerStat(&d_relaxOthers);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexCalls);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexFeasible);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexInfeasible);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexExhausted);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexRepaired);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexPivots);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexRefactorizations);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexMaxNonzeros);
+  smtStatisticsRegistry()->registerStat(&d_fpSimplexTimer);
 
   smtStatisticsRegistry()->registerStat(&d_applyRowsDeleted);
 
@@ -490,6 +525,12 @@ TheoryArithPrivate::Statistics::Statistics()
   smtStatisticsRegistry()->registerStat(&d_cutsRejectedDuringReplay);
   smtStatisticsRegistry()->registerStat(&d_cutsRejectedDuringLemmas);
 
+  smtStatisticsRegistry()->registerStat(&d_tableauGomoryCuts);
+  smtStatisticsRegistry()->registerStat(&d_tableauGcdConflicts);
+  smtStatisticsRegistry()->registerStat(&d_tableauBoundedRowCuts);
+  smtStatisticsRegistry()->registerStat(&d_tableauCutsRejected);
+  smtStatisticsRegistry()->registerStat(&d_tableauCutTimer);
+
   smtStatisticsRegistry()->registerStat(&d_solveIntModelsAttempts);
   smtStatisticsRegistry()->registerStat(&d_solveIntModelsSuccessful);
   smtStatisticsRegistry()->registerStat(&d_mipTimer);
@@ -523,6 +564,10 @@ TheoryArithPrivate::Statistics::~Statistics(){
   smtStatisticsRegistry()->unregisterStat(&d_boundComputationTime);
   smtStatisticsRegistry()->unregisterStat(&d_boundComputations);
   smtStatisticsRegistry()->unregisterStat(&d_boundPropagations);
+  smtStatisticsRegistry()->unregisterStat(&d_boundRowVisits);
+  smtStatisticsRegistry()->unregisterStat(&d_boundRowsUnwatched);
+  smtStatisticsRegistry()->unregisterStat(&d_boundBudgetExhausted);
+  smtStatisticsRegistry()->unregisterStat(&d_boundPropagationsPerRowVisit);
 
   smtStatisticsRegistry()->unregisterStat(&d_unknownChecks);
   smtStatisticsRegistry()->unregisterStat(&d_maxUnknownsInARow);
@@ -565,6 +610,15 @@ TheoryArithPrivate::Statistics::~Statistics(){
   smtStatisticsRegistry()->unregisterStat(&d_relaxLinInfeasFailures);
   smtStatisticsRegistry()->unregisterStat(&d_relaxLinExhausted);
   smtStatisticsRegistry()->unregisterStat(&d_relaxOthers);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexCalls);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexFeasible);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexInfeasible);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexExhausted);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexRepaired);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexPivots);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexRefactorizations);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexMaxNonzeros);
+  smtStatisticsRegistry()->unregisterStat(&d_fpSimplexTimer);
 
   smtStatisticsRegistry()->unregisterStat(&d_applyRowsDeleted);
 
@@ -583,6 +637,12 @@ TheoryArithPrivate::Statistics::~Statistics(){
   smtStatisticsRegistry()->unregisterStat(&d_cutsRejectedDuringReplay);
   smtStatisticsRegistry()->unregisterStat(&d_cutsRejectedDuringLemmas);
 
+  smtStatisticsRegistry()->unregisterStat(&d_tableauGomoryCuts);
+  smtStatisticsRegistry()->unregisterStat(&d_tableauGcdConflicts);
+  smtStatisticsRegistry()->unregisterStat(&d_tableauBoundedRowCuts);
+  smtStatisticsRegistry()->unregisterStat(&d_tableauCutsRejected);
+  smtStatisticsRegistry()->unregisterStat(&d_tableauCutTimer);
+
 
   smtStatisticsRegistry()->unregisterStat(&d_solveIntModelsAttempts);
   smtStatisticsRegistry()->unregisterStat(&d_solveIntModelsSuccessful);
@@ -685,6 +745,22 @@ bool TheoryArithPrivate::getDioCuttingResource(){
   }
 }
 
+bool TheoryArithPrivate::getTableauCuttingResource(){
+  if(d_tableauCutResources > 0){
+    d_tableauCutResources--;
+    if(d_tableauCutResources == 0){
+      d_tableauCutResources = -options::rrTurns();
+    }
+    return true;
+  }else{
+    d_tableauCutResources++;
+    if(d_tableauCutResources >= 0){
+      d_tableauCutResources = options::tableauCutTurns();
+    }
+    return false;
+  }
+}
+
 /* procedure AssertLower( x_i >= c_i ) */
 bool TheoryArithPrivate::AssertLower(ConstraintP constraint){
   Assert(constraint != NullConstraint);
@@ -1874,6 +1950,59 @@ Node TheoryArithPrivate::dioCutting(){
   }
 }
 
+static Node integerCutToLemma(const ArithVariables& vars, const IntegerCut& cut){
+  Node explanation = Constraint::externalExplainByAssertions(cut.d_explanation);
+  if(cut.isConflict()){
+    return explanation.negate();
+  }
+  Node sum = toSumNode(vars, cut.d_lhs);
+  if(sum.isNull()){
+    return Node::null();
+  }
+  NodeManager* nm = NodeManager::currentNM();
+  Node ineq = nm->mkNode(cut.d_kind, sum, mkRationalNode(cut.d_rhs));
+  return explanation.impNode(Rewriter::rewrite(ineq));
+}
+
+bool TheoryArithPrivate::tableauCutting(){
+  TimerStat::CodeTimer codeTimer(d_statistics.d_tableauCutTimer);
+  Assert(d_qflraStatus == Result::SAT);
+
+  IntegerCutGenerator generator(d_partialModel, d_tableau);
+  IntegerCut cut;
+  unsigned cuts = 0;
+  for(var_iterator vi = var_begin(), vend = var_end();
+      vi != vend && cuts < options::arithTableauCutsPerRound(); ++vi){
+    ArithVar v = *vi;
+    if(!generator.isCandidate(v)){ continue; }
+
+    IntStat* kind;
+    if(generator.gcdTest(v, cut)){
+      kind = &d_statistics.d_tableauGcdConflicts;
+    }else if(generator.boundedRow(v, cut)){
+      kind = &d_statistics.d_tableauBoundedRowCuts;
+    }else if(generator.gomory(v, cut)){
+      kind = &d_statistics.d_tableauGomoryCuts;
+    }else{
+      continue;
+    }
+
+    Node lemma = Node::null();
+    if(complexityBelow(cut.d_lhs, options::lemmaRejectCutSize())){
+      lemma = integerCutToLemma(d_partialModel, cut);
+    }
+    if(lemma.isNull()){
+      ++(d_statistics.d_tableauCutsRejected);
+    }else{
+      ++(*kind);
+      ++cuts;
+      Debug("arith::lemma") << "tableau cut " << lemma << endl;
+      outputLemma(lemma);
+    }
+  }
+  return cuts > 0;
+}
+
 Node TheoryArithPrivate::callDioSolver(){
   while(!d_constantIntegerVariables.empty()){
     ArithVar v = d_constantIntegerVariables.front();
@@ -3223,6 +3352,57 @@ void TheoryArithPrivate::importSolution(const ApproximateSimplex::Solution& solu
   }
 }
 
+void TheoryArithPrivate::solveFloatingPointRelaxation(){
+  ++d_statistics.d_fpSimplexCalls;
+  d_qflraStatus = Result::SAT_UNKNOWN;
+
+  ApproxDouble approx(d_partialModel,
+                      d_tableau,
+                      options::fpSimplexFactoredBasis(),
+                      getTreeLog(),
+                      getApproxStats());
+  approx.setPivotLimit(options::fpSimplexPivotLimit());
+  LinResult res;
+  {
+    TimerStat::CodeTimer codeTimer(d_statistics.d_fpSimplexTimer);
+    res = approx.solveRelaxation();
+  }
+  d_statistics.d_fpSimplexPivots += approx.getPivots();
+  d_statistics.d_fpSimplexRefactorizations += approx.getRefactorizations();
+  d_statistics.d_fpSimplexMaxNonzeros.maxAssign(approx.getNumNonzeros());
+
+  switch(res){
+  case LinFeasible:
+    ++d_statistics.d_fpSimplexFeasible;
+    break;
+  case LinInfeasible:
+    ++d_statistics.d_fpSimplexInfeasible;
+    break;
+  default:
+    ++d_statistics.d_fpSimplexExhausted;
+    return;
+  }
+
+  // The exact tableau is pivoted to the basis, which either checks the
+  // result or leaves the exact simplex a better place to start from.
+  d_qflraStatus = d_attemptSolSimplex.attempt(approx.extractRelaxation());
+  Debug("arith::fpSimplex") << "fp simplex " << res << " after "
+                            << approx.getPivots() << " pivots, exactly "
+                            << d_qflraStatus << endl;
+  if(d_qflraStatus != Result::SAT_UNKNOWN){
+    ++d_statistics.d_fpSimplexRepaired;
+  }
+}
+
+bool TheoryArithPrivate::hasIntegerVariables() const{
+  for(var_iterator vi = var_begin(), vi_end = var_end(); vi != vi_end; ++vi){
+    if(isInteger(*vi)){
+      return true;
+    }
+  }
+  return false;
+}
+
 bool TheoryArithPrivate::solveRelaxationOrPanic(Theory::Effort effortLevel){
   // if at this point the linear relaxation is still unknown,
   //  attempt to branch an integer variable as a last ditch effort on full check
@@ -3270,9 +3450,19 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
     << " " << useApprox
     << " " << safeToCallApprox()
     << endl;
-  
+
+  // A check without new facts may leave the status of an earlier check here.
+  d_qflraStatus = Result::SAT_UNKNOWN;
+  if(options::fpSimplex() &&
+     (!d_errorSet.errorEmpty() || d_errorSet.moreSignals()) &&
+     !hasIntegerVariables()){
+    solveFloatingPointRelaxation();
+  }
+
   bool noPivotLimitPass1 = noPivotLimit && !useApprox;
-  d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  if(d_qflraStatus == Result::SAT_UNKNOWN){
+    d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  }
 
   Debug("TheoryArithPrivate::solveRealRelaxation")
     << "solveRealRelaxation()" << " pass1 " << d_qflraStatus << endl;
@@ -3787,6 +3977,14 @@ void TheoryArithPrivate::check(Theory::Effort effortLevel){
       }
     }
 
+    if(!emmittedConflictOrSplit && options::arithTableauCuts()
+       && d_qflraStatus == Result::SAT){
+      if(getTableauCuttingResource() && tableauCutting()){
+        emmittedConflictOrSplit = true;
+        d_cutCount = d_cutCount + 1;
+      }
+    }
+
     if(!emmittedConflictOrSplit && d_hasDoneWorkSinceCut && options::arithDioSolver()){
       if(getDioCuttingResource()){
         Node possibleLemma = dioCutting();
@@ -4535,7 +4733,7 @@ bool TheoryArithPrivate::propagateCandidateBound(ArithVar basic, bool upperBound
   return false;
 }
 
-void TheoryArithPrivate::propagateCandidate(ArithVar basic){
+bool TheoryArithPrivate::propagateCandidate(ArithVar basic){
   bool success = false;
   RowIndex ridx = d_tableau.basicToRowIndex(basic);
 
@@ -4556,6 +4754,7 @@ void TheoryArithPrivate::propagateCandidate(ArithVar basic){
   if(success){
     ++d_statistics.d_boundPropagations;
   }
+  return success;
 }
 
 void TheoryArithPrivate::propagateCandidates(){
@@ -4567,13 +4766,18 @@ void TheoryArithPrivate::propagateCandidates(){
 
   if(d_updatedBounds.empty()){ return; }
 
+  UpdateTrackingCallback utcb(&d_linEq);
+  d_partialModel.processBoundsQueue(utcb);
+
   DenseSet::const_iterator i = d_updatedBounds.begin();
   DenseSet::const_iterator end = d_updatedBounds.end();
   for(; i != end; ++i){
     ArithVar var = *i;
     if(d_tableau.isBasic(var) &&
        d_tableau.basicRowLength(var) <= options::arithPropagateMaxLength()){
-      d_candidateBasics.softAdd(var);
+      if(rowIsWatched(d_tableau.basicToRowIndex(var))){
+        d_candidateBasics.softAdd(var);
+      }
     }else{
       Tableau::ColIterator basicIter = d_tableau.colIterator(var);
       for(; !basicIter.atEnd(); ++basicIter){
@@ -4582,7 +4786,8 @@ void TheoryArithPrivate::propagateCandidates(){
         ArithVar rowVar = d_tableau.rowIndexToBasic(ridx);
         Assert(entry.getColVar() == var);
         Assert(d_tableau.isBasic(rowVar));
-        if(d_tableau.getRowLength(ridx) <= options::arithPropagateMaxLength()){
+        if(d_tableau.getRowLength(ridx) <= options::arithPropagateMaxLength()
+           && rowIsWatched(ridx)){
           d_candidateBasics.softAdd(rowVar);
         }
       }
@@ -4590,11 +4795,16 @@ void TheoryArithPrivate::propagateCandidates(){
   }
   d_updatedBounds.purge();
 
+  d_propagationRowVisits = 0;
   while(!d_candidateBasics.empty()){
+    if(propagationBudgetExhausted()){
+      d_candidateBasics.purge();
+      break;
+    }
     ArithVar candidate = d_candidateBasics.back();
     d_candidateBasics.pop_back();
     Assert(d_tableau.isBasic(candidate));
-    propagateCandidate(candidate);
+    countRowVisit(propagateCandidate(candidate));
   }
   Debug("arith::prop") << "propagateCandidates end" << endl << endl << endl;
 }
@@ -4619,18 +4829,25 @@ void TheoryArithPrivate::propagateCandidatesNew(){
 
   Assert(d_qflraStatus == Result::SAT);
   if(d_updatedBounds.empty()){ return; }
+  UpdateTrackingCallback utcb(&d_linEq);
+  d_partialModel.processBoundsQueue(utcb);
+
   dumpUpdatedBoundsToRows();
   Assert(d_updatedBounds.empty());
 
-  if(!d_candidateRows.empty()){
-    UpdateTrackingCallback utcb(&d_linEq);
-    d_partialModel.processBoundsQueue(utcb);
-  }
-
+  d_propagationRowVisits = 0;
   while(!d_candidateRows.empty()){
+    if(propagationBudgetExhausted()){
+      d_candidateRows.purge();
+      break;
+    }
     RowIndex candidate = d_candidateRows.back();
     d_candidateRows.pop_back();
-    propagateCandidateRow(candidate);
+    bool success = propagateCandidateRow(candidate);
+    if(success){
+      ++d_statistics.d_boundPropagations;
+    }
+    countRowVisit(success);
   }
   Debug("arith::prop") << "propagateCandidatesNew end" << endl << endl << endl;
 }
@@ -4859,19 +5076,52 @@ void TheoryArithPrivate::dumpUpdatedBoundsToRows(){
     ArithVar var = *i;
     if(d_tableau.isBasic(var)){
       RowIndex ridx = d_tableau.basicToRowIndex(var);
-      d_candidateRows.softAdd(ridx);
+      if(rowIsWatched(ridx)){
+        d_candidateRows.softAdd(ridx);
+      }
     }else{
       Tableau::ColIterator basicIter = d_tableau.colIterator(var);
       for(; !basicIter.atEnd(); ++basicIter){
         const Tableau::Entry& entry = *basicIter;
         RowIndex ridx = entry.getRowIndex();
-        d_candidateRows.softAdd(ridx);
+        if(rowIsWatched(ridx)){
+          d_candidateRows.softAdd(ridx);
+        }
       }
     }
   }
   d_updatedBounds.purge();
 }
 
+bool TheoryArithPrivate::rowIsWatched(RowIndex ridx){
+  uint32_t rowLength = d_tableau.getRowLength(ridx);
+  unsigned limit = options::arithPropagateRowLimit();
+  if(limit == 0 || rowLength <= limit){
+    BoundCounts hasCount = d_linEq.hasBoundCount(ridx);
+    if(hasCount.lowerBoundCount() + 1 >= rowLength ||
+       hasCount.upperBoundCount() + 1 >= rowLength){
+      return true;
+    }
+  }
+  ++d_statistics.d_boundRowsUnwatched;
+  return false;
+}
+
+void TheoryArithPrivate::countRowVisit(bool propagated){
+  ++d_statistics.d_boundRowVisits;
+  d_statistics.d_boundPropagationsPerRowVisit.addEntry(propagated ? 1 : 0);
+  ++d_propagationRowVisits;
+}
+
+bool TheoryArithPrivate::propagationBudgetExhausted(){
+  unsigned budget = options::arithPropagateBudget();
+  if(budget != 0 && d_propagationRowVisits >= budget){
+    ++d_statistics.d_boundBudgetExhausted;
+    return true;
+  }
+  return false;
+}
+
 const BoundsInfo& TheoryArithPrivate::boundsInfo(ArithVar basic) const{
   RowIndex ridx = d_tableau.basicToRowIndex(basic);
   return d_rowTracking[ridx];
@@ -239,6 +239,13 @@ private:
   Node callDioSolver();
   Node dioCutting();
 
+  /**
+   * Outputs as lemmas the cuts from the rows of integer basic variables
+   * with fractional assignments, at most --tableau-cuts-per-round of them.
+   * Returns true if it output any.
+   */
+  bool tableauCutting();
+
   Comparison mkIntegerEqualityFromAssignment(ArithVar v);
 
   /**
@@ -391,6 +398,18 @@ private:
   SimplexDecisionProcedure* d_otherSDP;
   /* Sets d_qflraStatus */
   void importSolution(const ApproximateSimplex::Solution& solution);
+  /**
+   * Searches for a feasible basis with ApproxDouble and imports it.  Sets
+   * d_qflraStatus to SAT or UNSAT if the basis settles the relaxation
+   * exactly, and leaves it SAT_UNKNOWN otherwise.
+   */
+  void solveFloatingPointRelaxation();
+  /**
+   * Returns true if some variable is integral.  The floating-point pass is
+   * skipped for these: it jumps to a new vertex of the relaxation on every
+   * check, and branch and bound can then chase fractional vertices forever.
+   */
+  bool hasIntegerVariables() const;
   bool solveRelaxationOrPanic(Theory::Effort effortLevel);
   context::CDO<int> d_lastContextIntegerAttempted;
   bool replayLog(ApproximateSimplex* approx);
@@ -577,6 +596,22 @@ private:
   void propagateCandidatesNew();
   void dumpUpdatedBoundsToRows();
   bool propagateCandidateRow(RowIndex rid);
+
+  /**
+   * A row can only imply a bound once at most one of its variables lacks
+   * the bound on the side of the row that would be used, so until then it
+   * is not revisited when the bounds of its variables change.  Rows over
+   * --prop-row-limit are never revisited.  The bound counts must be up to
+   * date.
+   */
+  bool rowIsWatched(RowIndex ridx);
+
+  /** Counts a row visited by bound propagation, and whether it propagated. */
+  void countRowVisit(bool propagated);
+  /** Whether this round of propagation has visited --prop-row-budget rows. */
+  bool propagationBudgetExhausted();
+  /** The rows visited by bound propagation in the current round. */
+  uint32_t d_propagationRowVisits;
   bool propagateMightSucceed(ArithVar v, bool ub) const;
   /** Attempt to perform a row propagation where there is at most 1 possible variable.*/
   bool attemptSingleton(RowIndex ridx, bool rowUp);
@@ -593,7 +628,7 @@ private:
   Node branchToNode(ApproximateSimplex* approx, const NodeLog& cut) const;
 
   void propagateCandidates();
-  void propagateCandidate(ArithVar basic);
+  bool propagateCandidate(ArithVar basic);
   bool propagateCandidateBound(ArithVar basic, bool upperBound);
 
   inline bool propagateCandidateLowerBound(ArithVar basic){
@@ -722,6 +757,9 @@ private:
   int32_t d_dioSolveResources;
   bool getDioCuttingResource();
 
+  int32_t d_tableauCutResources;
+  bool getTableauCuttingResource();
+
   uint32_t d_solveIntMaybeHelp, d_solveIntAttempts;
 
   RationalVector d_farkasBuffer;
@@ -750,6 +788,8 @@ private:
 
     TimerStat d_boundComputationTime;
     IntStat d_boundComputations, d_boundPropagations;
+    IntStat d_boundRowVisits, d_boundRowsUnwatched, d_boundBudgetExhausted;
+    AverageStat d_boundPropagationsPerRowVisit;
 
     IntStat d_unknownChecks;
     IntStat d_maxUnknownsInARow;
@@ -789,6 +829,16 @@ private:
       d_relaxLinExhausted,
       d_relaxOthers;
 
+    IntStat d_fpSimplexCalls,
+      d_fpSimplexFeasible,
+      d_fpSimplexInfeasible,
+      d_fpSimplexExhausted,
+      d_fpSimplexRepaired,
+      d_fpSimplexPivots,
+      d_fpSimplexRefactorizations,
+      d_fpSimplexMaxNonzeros;
+    TimerStat d_fpSimplexTimer;
+
     IntStat d_applyRowsDeleted;
     TimerStat d_replaySimplexTimer;
 
@@ -805,6 +855,10 @@ private:
     IntStat d_cutsRejectedDuringReplay;
     IntStat d_cutsRejectedDuringLemmas;
 
+    IntStat d_tableauGomoryCuts, d_tableauGcdConflicts, d_tableauBoundedRowCuts;
+    IntStat d_tableauCutsRejected;
+    TimerStat d_tableauCutTimer;
+
     HistogramStat<uint32_t> d_satPivots;
     HistogramStat<uint32_t> d_unsatPivots;
     HistogramStat<uint32_t> d_unknownPivots;
@@ -46,6 +46,15 @@ EagerBitblaster::EagerBitblaster(TheoryBV* theory_bv)
   {
     case SAT_SOLVER_MINISAT:
     {
+      if (options::bvEagerThreads() > 1)
+      {
+        solver = prop::SatSolverFactory::createMinisatPortfolio(
+            d_nullContext.get(),
+            smtStatisticsRegistry(),
+            options::bvEagerThreads(),
+            "EagerBitblaster");
+        break;
+      }
       prop::BVSatSolverInterface* minisat =
           prop::SatSolverFactory::createMinisat(
               d_nullContext.get(), smtStatisticsRegistry(), "EagerBitblaster");
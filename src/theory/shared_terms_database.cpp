@@ -61,10 +61,10 @@ void SharedTermsDatabase::addSharedTerm(TNode atom, TNode term, Theory::Set theo
     d_atomsToTerms[atom].push_back(term);
     d_addedSharedTerms.push_back(atom);
     d_addedSharedTermsSize = d_addedSharedTermsSize + 1;
-    d_termsToTheories[search_pair] = theories;
+    d_termsToTheories.insert(search_pair, theories);
   } else {
     Assert(theories != (*find).second);
-    d_termsToTheories[search_pair] = Theory::setUnion(theories, (*find).second);
+    d_termsToTheories.insert(search_pair, Theory::setUnion(theories, (*find).second));
   }
 }
 
@@ -160,7 +160,7 @@ void SharedTermsDatabase::markNotified(TNode term, Theory::Set theories) {
   Debug("shared-terms-database") << "SharedTermsDatabase::markNotified(" << term << ")" << endl;
 
   // First update the set of notified theories for this term
-  d_alreadyNotifiedMap[term] = Theory::setUnion(newlyNotified, alreadyNotified);
+  d_alreadyNotifiedMap.insert(term, Theory::setUnion(newlyNotified, alreadyNotified));
 
   // Mark the shared terms in the equality engine
   theory::TheoryId currentTheory;
@@ -27,6 +27,7 @@
 #include "options/options.h"
 #include "options/proof_options.h"
 #include "options/quantifiers_options.h"
+#include "options/smt_options.h"
 #include "proof/cnf_proof.h"
 #include "proof/lemma_proof.h"
 #include "proof/proof_manager.h"
@@ -624,8 +625,16 @@ void TheoryEngine::check(Theory::Effort effort) {
       {
         if (options::produceModels() && !d_curr_model->isBuilt())
         {
-          // must build model at this point
-          d_curr_model_builder->buildModel(d_curr_model);
+          // must build model at this point, a lazy one assigns values on
+          // the queries
+          if (isModelLazy())
+          {
+            d_curr_model_builder->buildModelLazy(d_curr_model);
+          }
+          else
+          {
+            d_curr_model_builder->buildModel(d_curr_model);
+          }
         }
       }
     }
@@ -650,7 +659,7 @@ void TheoryEngine::check(Theory::Effort effort) {
           // is not enabled.
           if (!d_incomplete && options::checkModels())
           {
-            d_curr_model_builder->debugCheckModel(d_curr_model);
+            d_curr_model_builder->debugCheckModel(getBuiltModel());
           }
           // Do post-processing of model from the theories (used for THEORY_SEP
           // to construct heap model)
@@ -913,6 +922,25 @@ TheoryModel* TheoryEngine::getModel() {
   return d_curr_model;
 }
 
+TheoryModel* TheoryEngine::getBuiltModel(TNode n)
+{
+  // the equivalence classes of a lazy model were collected at the end of
+  // the last check, in the model's own context, and are assigned here
+  if (isModelLazy() && d_curr_model->isBuiltSuccess())
+  {
+    d_curr_model_builder->completeModel(d_curr_model, n);
+  }
+  return d_curr_model;
+}
+
+bool TheoryEngine::isModelLazy() const
+{
+  // quantifier instantiation works on the model built during the check,
+  // and separation logic post-processes the whole model
+  return options::modelLazy() && !d_logicInfo.isQuantified()
+         && !d_logicInfo.isTheoryEnabled(THEORY_SEP);
+}
+
 void TheoryEngine::getSynthSolutions(std::map<Node, Node>& sol_map)
 {
   if (d_quantEngine)
@@ -1220,7 +1248,7 @@ bool TheoryEngine::markPropagation(TNode assertion, TNode originalAssertion, the
   Trace("theory::assertToTheory") << "TheoryEngine::markPropagation(): marking [" << d_propagationMapTimestamp << "] " << assertion << ", " << toTheoryId << " from " << originalAssertion << ", " << fromTheoryId << endl;
 
   // Mark the propagation
-  d_propagationMap[toAssert] = toExplain;
+  d_propagationMap.insert(toAssert, toExplain);
   d_propagationMapTimestamp = d_propagationMapTimestamp + 1;
 
   return true;
@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "base/cvc4_assert.h"
+#include "context/cdflat_hashmap.h"
 #include "context/cdhashset.h"
 #include "expr/node.h"
 #include "options/options.h"
@@ -379,9 +380,10 @@ class TheoryEngine {
 
 
   /**
-   * Mapping of propagations from recievers to senders.
+   * Mapping of propagations from recievers to senders.  This map is
+   * looked up and extended on every propagation, so it is a flat map.
    */
-  typedef context::CDHashMap<NodeTheoryPair, NodeTheoryPair, NodeTheoryPairHashFunction> PropagationMap;
+  typedef context::CDFlatHashMap<NodeTheoryPair, NodeTheoryPair, NodeTheoryPairHashFunction> PropagationMap;
   PropagationMap d_propagationMap;
 
   /**
@@ -735,6 +737,20 @@ public:
    */
   theory::TheoryModel* getModel();
 
+  /**
+   * Get the current model for answering model queries.  A lazy model
+   * (--model-lazy) first gets the values of the equivalence classes and
+   * functions that the value of the given term depends on, or of all of
+   * them if it is null.
+   */
+  theory::TheoryModel* getBuiltModel(TNode n = TNode::null());
+
+  /**
+   * Whether the model assigns values on request rather than when it is
+   * built at the end of a check.
+   */
+  bool isModelLazy() const;
+
   /** get synth solutions
    *
    * This function adds entries to sol_map that map functions-to-synthesize with
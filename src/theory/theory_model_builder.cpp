@@ -277,7 +277,38 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
 {
   Trace("model-builder") << "TheoryEngineModelBuilder: buildModel" << std::endl;
   TheoryModel* tm = (TheoryModel*)m;
+  if (!collectEqClasses(tm))
+  {
+    return false;
+  }
+  assignRepresentatives(tm, nullptr);
+
+  // modelBuilder-specific initialization
+  if (!processBuildModel(tm))
+  {
+    return false;
+  }
+  else
+  {
+    tm->d_modelBuiltSuccess = true;
+    return true;
+  }
+}
+
+bool TheoryEngineModelBuilder::buildModelLazy(TheoryModel* tm)
+{
+  Trace("model-builder") << "TheoryEngineModelBuilder: buildModelLazy"
+                         << std::endl;
+  if (!collectEqClasses(tm))
+  {
+    return false;
+  }
+  tm->d_modelBuiltSuccess = true;
+  return true;
+}
 
+bool TheoryEngineModelBuilder::collectEqClasses(TheoryModel* tm)
+{
   // buildModel should only be called once per check
   Assert(!tm->isBuilt());
 
@@ -302,10 +333,12 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
     return false;
   }
 
+  d_state.reset(new BuildState);
+  std::map<TypeNode, unsigned>& eqc_usort_count = d_state->d_eqcUsortCount;
+
   // Loop through all terms and make sure that assignable sub-terms are in the
   // equality engine
   // Also, record #eqc per type (for finite model finding)
-  std::map<TypeNode, unsigned> eqc_usort_count;
   eq::EqClassesIterator eqcs_i = eq::EqClassesIterator(tm->d_equalityEngine);
   {
     NodeSet cache;
@@ -336,9 +369,11 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
 
   // Process all terms in the equality engine, store representatives for each EC
   d_constantReps.clear();
-  std::map<Node, Node> assertedReps;
-  TypeSet typeConstSet, typeRepSet, typeNoRepSet;
-  TypeEnumeratorProperties tep;
+  std::map<Node, Node>& assertedReps = d_state->d_assertedReps;
+  TypeSet& typeConstSet = d_state->d_typeConstSet;
+  TypeSet& typeRepSet = d_state->d_typeRepSet;
+  TypeSet& typeNoRepSet = d_state->d_typeNoRepSet;
+  TypeEnumeratorProperties& tep = d_state->d_tep;
   if (options::finiteModelFind())
   {
     tep.d_fixed_usort_card = true;
@@ -358,7 +393,7 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
   // parametric types instantiated with uninterpreted sorts, but is probably
   // a good idea to do in general since it leads to models with smaller term
   // sizes.
-  std::vector<TypeNode> type_list;
+  std::vector<TypeNode>& type_list = d_state->d_typeList;
   eqcs_i = eq::EqClassesIterator(tm->d_equalityEngine);
   for (; !eqcs_i.isFinished(); ++eqcs_i)
   {
@@ -428,6 +463,36 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
     }
   }
 
+  // the representatives are copied back as their classes are assigned
+  tm->d_reps.clear();
+  return true;
+}
+
+void TheoryEngineModelBuilder::assignRepresentatives(
+    TheoryModel* tm,
+    const std::unordered_set<TypeNode, TypeNodeHashFunction>* baseTypes)
+{
+#ifdef CVC4_ASSERTIONS
+  std::map<TypeNode, unsigned>& eqc_usort_count = d_state->d_eqcUsortCount;
+#endif /* CVC4_ASSERTIONS */
+  std::map<Node, Node>& assertedReps = d_state->d_assertedReps;
+  TypeSet& typeConstSet = d_state->d_typeConstSet;
+  TypeSet& typeRepSet = d_state->d_typeRepSet;
+  TypeSet& typeNoRepSet = d_state->d_typeNoRepSet;
+  // the types to assign now, each with all types of the same base type
+  std::unordered_set<TypeNode, TypeNodeHashFunction> assigning;
+  std::vector<TypeNode> type_list;
+  for (const TypeNode& t : d_state->d_typeList)
+  {
+    TypeNode tb = t.getBaseType();
+    if (d_state->d_assignedTypes.find(tb) == d_state->d_assignedTypes.end()
+        && (baseTypes == nullptr || baseTypes->find(tb) != baseTypes->end()))
+    {
+      type_list.push_back(t);
+      assigning.insert(tb);
+    }
+  }
+
   // Need to ensure that each EC has a constant representative.
 
   Trace("model-builder") << "Processing EC's..." << std::endl;
@@ -767,7 +832,8 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
   for (it = typeRepSet.begin(); it != typeRepSet.end(); ++it)
   {
     set<Node>& repSet = TypeSet::getSet(it);
-    if (!repSet.empty())
+    if (!repSet.empty()
+        && assigning.find(TypeSet::getType(it)) != assigning.end())
     {
       Trace("model-builder") << "***Non-empty repSet, size = " << repSet.size()
                              << ", first = " << *(repSet.begin()) << endl;
@@ -777,23 +843,33 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
 #endif /* CVC4_ASSERTIONS */
 
   Trace("model-builder") << "Copy representatives to model..." << std::endl;
-  tm->d_reps.clear();
   std::map<Node, Node>::iterator itMap;
   for (itMap = d_constantReps.begin(); itMap != d_constantReps.end(); ++itMap)
   {
-    tm->d_reps[itMap->first] = itMap->second;
-    tm->d_rep_set.add(itMap->second.getType(), itMap->second);
+    if (tm->d_reps.find(itMap->first) == tm->d_reps.end())
+    {
+      tm->d_reps[itMap->first] = itMap->second;
+      tm->d_rep_set.add(itMap->second.getType(), itMap->second);
+    }
   }
 
   Trace("model-builder") << "Make sure ECs have reps..." << std::endl;
   // Make sure every EC has a rep
   for (itMap = assertedReps.begin(); itMap != assertedReps.end(); ++itMap)
   {
-    tm->d_reps[itMap->first] = itMap->second;
-    tm->d_rep_set.add(itMap->second.getType(), itMap->second);
+    if (assigning.find(itMap->first.getType().getBaseType())
+        != assigning.end())
+    {
+      tm->d_reps[itMap->first] = itMap->second;
+      tm->d_rep_set.add(itMap->second.getType(), itMap->second);
+    }
   }
   for (it = typeNoRepSet.begin(); it != typeNoRepSet.end(); ++it)
   {
+    if (assigning.find(TypeSet::getType(it).getBaseType()) == assigning.end())
+    {
+      continue;
+    }
     set<Node>& noRepSet = TypeSet::getSet(it);
     set<Node>::iterator i;
     for (i = noRepSet.begin(); i != noRepSet.end(); ++i)
@@ -802,17 +878,7 @@ bool TheoryEngineModelBuilder::buildModel(Model* m)
       tm->d_rep_set.add((*i).getType(), *i);
     }
   }
-
-  // modelBuilder-specific initialization
-  if (!processBuildModel(tm))
-  {
-    return false;
-  }
-  else
-  {
-    tm->d_modelBuiltSuccess = true;
-    return true;
-  }
+  d_state->d_assignedTypes.insert(assigning.begin(), assigning.end());
 }
 
 void TheoryEngineModelBuilder::debugCheckModel(Model* m)
@@ -944,6 +1010,132 @@ bool TheoryEngineModelBuilder::processBuildModel(TheoryModel* m)
   return true;
 }
 
+void TheoryEngineModelBuilder::completeModel(TheoryModel* m, TNode n)
+{
+  Assert(d_state != nullptr);
+  if (n.isNull() || options::ufHo())
+  {
+    // higher-order function values depend on each other
+    assignRepresentatives(m, nullptr);
+    if (m->areFunctionValuesEnabled())
+    {
+      assignFunctions(m);
+    }
+    return;
+  }
+  // The value of n, after the substitutions of the model, depends on the
+  // classes of its subterms, on the classes of the subterms of their
+  // terms, and so on, and on the applications of the functions in it.
+  // The classes are taken by base type, as those of a type are assigned
+  // distinct values together.  Classes with a constant need nothing.
+  Node nn = m->d_substitutions.apply(n);
+  std::unordered_set<TypeNode, TypeNodeHashFunction> types;
+  std::vector<TypeNode> typesToVisit;
+  std::vector<Node> funcs;
+  NodeSet visited;
+  std::vector<TNode> visit;
+  visit.push_back(nn);
+  while (!visit.empty() || !typesToVisit.empty())
+  {
+    if (visit.empty())
+    {
+      // the terms of the classes of the next type
+      TypeNode t = typesToVisit.back();
+      typesToVisit.pop_back();
+      for (const TypeNode& lt : d_state->d_typeList)
+      {
+        if (lt.getBaseType() == t)
+        {
+          addClassTerms(m, d_state->d_typeNoRepSet.getSet(lt), visit);
+          addClassTerms(m, d_state->d_typeRepSet.getSet(lt), visit);
+        }
+      }
+      continue;
+    }
+    TNode cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    TypeNode tn = cur.getType();
+    Node f;
+    if (cur.getKind() == kind::APPLY_UF)
+    {
+      f = cur.getOperator();
+    }
+    else if (tn.isFunction())
+    {
+      f = cur;
+    }
+    // with the argument and range types of f, for the values of f at all
+    // its applications
+    std::vector<TypeNode> curTypes;
+    if (f.isNull())
+    {
+      curTypes.push_back(tn);
+    }
+    else
+    {
+      funcs.push_back(f);
+      TypeNode ft = f.getType();
+      curTypes.insert(curTypes.end(), ft.begin(), ft.end());
+    }
+    for (const TypeNode& ct : curTypes)
+    {
+      TypeNode tb = ct.getBaseType();
+      if (ct.isFirstClass() && types.insert(tb).second
+          && d_state->d_assignedTypes.find(tb)
+                 == d_state->d_assignedTypes.end())
+      {
+        typesToVisit.push_back(tb);
+      }
+    }
+    visit.insert(visit.end(), cur.begin(), cur.end());
+  }
+  Trace("model-builder") << "  Complete model for " << n << ": "
+                         << types.size() << " types, " << funcs.size()
+                         << " functions" << std::endl;
+  assignRepresentatives(m, &types);
+  if (!m->areFunctionValuesEnabled() || !options::assignFunctionValues())
+  {
+    return;
+  }
+  for (const Node& f : funcs)
+  {
+    if (m->d_uf_terms.find(f) != m->d_uf_terms.end()
+        && !m->hasAssignedFunctionDefinition(f))
+    {
+      Trace("model-builder") << "  Assign requested function " << f
+                             << std::endl;
+      assignFunction(m, f);
+    }
+  }
+}
+
+void TheoryEngineModelBuilder::addClassTerms(TheoryModel* m,
+                                             std::set<Node>* eqcs,
+                                             std::vector<TNode>& terms)
+{
+  if (eqcs == NULL)
+  {
+    return;
+  }
+  for (const Node& eqc : *eqcs)
+  {
+    eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, m->d_equalityEngine);
+    for (; !eqc_i.isFinished(); ++eqc_i)
+    {
+      terms.push_back(*eqc_i);
+    }
+    std::map<Node, Node>::iterator it = d_state->d_assertedReps.find(eqc);
+    if (it != d_state->d_assertedReps.end())
+    {
+      terms.push_back(it->second);
+    }
+  }
+}
+
 void TheoryEngineModelBuilder::assignFunction(TheoryModel* m, Node f)
 {
   Assert(!options::ufHo());
@@ -17,6 +17,7 @@
 #ifndef __CVC4__THEORY__THEORY_MODEL_BUILDER_H
 #define __CVC4__THEORY__THEORY_MODEL_BUILDER_H
 
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -75,6 +76,23 @@ class TheoryEngineModelBuilder : public ModelBuilder
    * such that t1^M != t2^M.
    */
   void debugCheckModel(Model* m);
+  /** Build model lazily
+   *
+   * This does steps (1) to (3) of buildModel and leaves the rest to
+   * completeModel.  It is used for --model-lazy in place of buildModel at
+   * the end of a check, and returns false if step (1) or (2) sends a
+   * lemma.
+   */
+  bool buildModelLazy(TheoryModel* m);
+  /** Complete model
+   *
+   * For a model built with buildModelLazy, this does steps (4) and (5)
+   * for what the value of n depends on: the equivalence classes of the
+   * types of the subterms of n, of the subterms of the terms of these
+   * classes, and so on, and the uninterpreted functions in n.  If n is
+   * null, it does them for all the rest of the model.
+   */
+  void completeModel(TheoryModel* m, TNode n);
 
  protected:
   /** pointer to theory engine */
@@ -193,6 +211,48 @@ class TheoryEngineModelBuilder : public ModelBuilder
   void assignFunctions(TheoryModel* m);
 
  private:
+  /** collect equivalence classes
+   *
+   * Steps (1) to (3) of buildModel: this collects the equivalence classes
+   * of m with their constants and asserted representatives, by type, in
+   * d_state.
+   */
+  bool collectEqClasses(TheoryModel* m);
+  /** assign representatives
+   *
+   * Step (4) of buildModel for the equivalence classes of the given base
+   * types, or of all types if baseTypes is null, that are not assigned
+   * yet.  This copies the representatives of these classes to m.
+   */
+  void assignRepresentatives(
+      TheoryModel* m,
+      const std::unordered_set<TypeNode, TypeNodeHashFunction>* baseTypes);
+  /**
+   * Add the terms of the given equivalence classes of m, and their asserted
+   * representatives, to terms.
+   */
+  void addClassTerms(TheoryModel* m,
+                     std::set<Node>* eqcs,
+                     std::vector<TNode>& terms);
+
+  /** The equivalence classes of a model being built, by type. */
+  struct BuildState
+  {
+    /** the number of classes of each uninterpreted sort */
+    std::map<TypeNode, unsigned> d_eqcUsortCount;
+    /** the representatives asserted by the theories, not yet constant */
+    std::map<Node, Node> d_assertedReps;
+    /** the constants, and the classes with and without a representative */
+    TypeSet d_typeConstSet;
+    TypeSet d_typeRepSet;
+    TypeSet d_typeNoRepSet;
+    TypeEnumeratorProperties d_tep;
+    /** the types of the classes, component types first */
+    std::vector<TypeNode> d_typeList;
+    /** the base types whose classes are assigned */
+    std::unordered_set<TypeNode, TypeNodeHashFunction> d_assignedTypes;
+  };
+  std::unique_ptr<BuildState> d_state;
   /** normalized cache
    * A temporary cache mapping terms to their
    * normalized form, used during buildModel.
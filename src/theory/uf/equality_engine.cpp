@@ -17,6 +17,7 @@
 
 #include "theory/uf/equality_engine.h"
 
+#include "options/uf_options.h"
 #include "smt/smt_statistics_registry.h"
 
 namespace CVC4 {
@@ -27,12 +28,18 @@ EqualityEngine::Statistics::Statistics(std::string name)
     : mergesCount(name + "::mergesCount", 0),
       termsCount(name + "::termsCount", 0),
       functionTermsCount(name + "::functionTermsCount", 0),
-      constantTermsCount(name + "::constantTermsCount", 0)
+      constantTermsCount(name + "::constantTermsCount", 0),
+      explanationCacheHits(name + "::explanationCacheHits", 0),
+      explanationCacheMisses(name + "::explanationCacheMisses", 0),
+      explanationLength(name + "::explanationLength")
 {
   smtStatisticsRegistry()->registerStat(&mergesCount);
   smtStatisticsRegistry()->registerStat(&termsCount);
   smtStatisticsRegistry()->registerStat(&functionTermsCount);
   smtStatisticsRegistry()->registerStat(&constantTermsCount);
+  smtStatisticsRegistry()->registerStat(&explanationCacheHits);
+  smtStatisticsRegistry()->registerStat(&explanationCacheMisses);
+  smtStatisticsRegistry()->registerStat(&explanationLength);
 }
 
 EqualityEngine::Statistics::~Statistics() {
@@ -40,6 +47,9 @@ EqualityEngine::Statistics::~Statistics() {
   smtStatisticsRegistry()->unregisterStat(&termsCount);
   smtStatisticsRegistry()->unregisterStat(&functionTermsCount);
   smtStatisticsRegistry()->unregisterStat(&constantTermsCount);
+  smtStatisticsRegistry()->unregisterStat(&explanationCacheHits);
+  smtStatisticsRegistry()->unregisterStat(&explanationCacheMisses);
+  smtStatisticsRegistry()->unregisterStat(&explanationLength);
 }
 
 /**
@@ -116,6 +126,8 @@ EqualityEngine::EqualityEngine(context::Context* context, std::string name, bool
 , d_subtermEvaluatesSize(context, 0)
 , d_stats(name)
 , d_inPropagate(false)
+, d_cacheExplanations(options::eeExplanationCache())
+, d_explanationCacheSize(context, 0)
 , d_constantsAreTriggers(constantsAreTriggers)
 , d_triggerDatabaseSize(context, 0)
 , d_triggerTermSetUpdatesSize(context, 0)
@@ -141,6 +153,8 @@ EqualityEngine::EqualityEngine(EqualityEngineNotify& notify, context::Context* c
 , d_subtermEvaluatesSize(context, 0)
 , d_stats(name)
 , d_inPropagate(false)
+, d_cacheExplanations(options::eeExplanationCache())
+, d_explanationCacheSize(context, 0)
 , d_constantsAreTriggers(constantsAreTriggers)
 , d_triggerDatabaseSize(context, 0)
 , d_triggerTermSetUpdatesSize(context, 0)
@@ -183,16 +197,16 @@ EqualityNodeId EqualityEngine::newApplicationNode(TNode original, EqualityNodeId
   d_applications[funId] = FunctionApplicationPair(funOriginal, funNormalized);
 
   // Add the lookup data, if it's not already there
-  ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
-  if (find == d_applicationLookup.end()) {
+  EqualityNodeId find = d_applicationLookup.find(funNormalized);
+  if (find == null_id) {
     Debug("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): no lookup, setting up" << std::endl;
     // Mark the normalization to the lookup
     storeApplicationLookup(funNormalized, funId);
   } else {
     // If it's there, we need to merge these two
     Debug("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup exists, adding to queue" << std::endl;
-    Debug("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup = " << d_nodes[find->second] << std::endl;
-    enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
+    Debug("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup = " << d_nodes[find] << std::endl;
+    enqueue(MergeCandidate(funId, find, MERGED_THROUGH_CONGRUENCE, TNode::null()));
   }
 
   // Add to the use lists
@@ -215,7 +229,7 @@ EqualityNodeId EqualityEngine::newNode(TNode node) {
 
   // Register the new id of the term
   EqualityNodeId newId = d_nodes.size();
-  d_nodeIds[node] = newId;
+  d_nodeIds.insert(node, newId);
   // Add the node to it's position
   d_nodes.push_back(node);
   // Note if this is an application or not
@@ -371,12 +385,12 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
 }
 
 bool EqualityEngine::hasTerm(TNode t) const {
-  return d_nodeIds.find(t) != d_nodeIds.end();
+  return d_nodeIds.contains(t);
 }
 
 EqualityNodeId EqualityEngine::getNodeId(TNode node) const {
   Assert(hasTerm(node), node.toString().c_str());
-  return (*d_nodeIds.find(node)).second;
+  return d_nodeIds.find(node);
 }
 
 EqualityNode& EqualityEngine::getEqualityNode(TNode t) {
@@ -645,11 +659,11 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
         EqualityNodeId aNormalized = getEqualityNode(fun.a).getFind();
         EqualityNodeId bNormalized = getEqualityNode(fun.b).getFind();
         FunctionApplication funNormalized(fun.type, aNormalized, bNormalized);
-        ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
-        if (find != d_applicationLookup.end()) {
+        EqualityNodeId find = d_applicationLookup.find(funNormalized);
+        if (find != null_id) {
           // Applications fun and the funNormalized can be merged due to congruence
-          if (getEqualityNode(funId).getFind() != getEqualityNode(find->second).getFind()) {
-            enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
+          if (getEqualityNode(funId).getFind() != getEqualityNode(find).getFind()) {
+            enqueue(MergeCandidate(funId, find, MERGED_THROUGH_CONGRUENCE, TNode::null()));
           }
         } else {
           // There is no representative, so we can add one, we remove this when backtracking
@@ -845,6 +859,14 @@ void EqualityEngine::backtrack() {
     d_applicationLookups.resize(d_applicationLookupsCount);
   }
 
+  if (d_explanationCache.size() > d_explanationCacheSize) {
+    for (int i = d_explanationCache.size() - 1, i_end = (int) d_explanationCacheSize; i >= i_end; -- i) {
+      d_explanationLookup.erase(d_explanationCache[i].pair);
+    }
+    d_explanationReasons.resize(d_explanationCache[d_explanationCacheSize].start);
+    d_explanationCache.resize(d_explanationCacheSize);
+  }
+
   if (d_subtermEvaluates.size() > d_subtermEvaluatesSize) {
     for(int i = d_subtermEvaluates.size() - 1, i_end = (int)d_subtermEvaluatesSize; i >= i_end; --i) {
       d_subtermsToEvaluate[d_subtermEvaluates[i]] ++;
@@ -940,6 +962,9 @@ void EqualityEngine::explainEquality(TNode t1, TNode t2, bool polarity,
   EqualityNodeId t1Id = getNodeId(t1);
   EqualityNodeId t2Id = getNodeId(t2);
 
+  EqualityEngine* nonConst = const_cast<EqualityEngine*>(this);
+  size_t size = equalities.size();
+
   if (polarity) {
     // Get the explanation
     getExplanation(t1Id, t2Id, equalities, eqp);
@@ -1015,6 +1040,8 @@ void EqualityEngine::explainEquality(TNode t1, TNode t2, bool polarity,
       eqp->debug_print("pf::ee", 1);
     }
   }
+
+  nonConst->d_stats.explanationLength.addEntry(equalities.size() - size);
 }
 
 void EqualityEngine::explainPredicate(TNode p, bool polarity,
@@ -1024,9 +1051,12 @@ void EqualityEngine::explainPredicate(TNode p, bool polarity,
                     << std::endl;
   // Must have the term
   Assert(hasTerm(p));
+  size_t size = assertions.size();
   // Get the explanation
   getExplanation(getNodeId(p), polarity ? d_trueId : d_falseId, assertions,
                  eqp);
+  EqualityEngine* nonConst = const_cast<EqualityEngine*>(this);
+  nonConst->d_stats.explanationLength.addEntry(assertions.size() - size);
 }
 
 void EqualityEngine::getExplanation(EqualityNodeId t1Id, EqualityNodeId t2Id,
@@ -1060,7 +1090,47 @@ void EqualityEngine::getExplanation(EqualityNodeId t1Id, EqualityNodeId t2Id,
     return;
   }
 
+  if (eqp) {
+    // Proofs are not cached
+    getPathExplanation(t1Id, t2Id, equalities, eqp);
+    return;
+  }
+
+  EqualityEngine* nonConst = const_cast<EqualityEngine*>(this);
+  EqualityPair pair = t1Id < t2Id ? EqualityPair(t1Id, t2Id) : EqualityPair(t2Id, t1Id);
+
+  if (!d_cacheExplanations) {
+    getPathExplanation(t1Id, t2Id, equalities, eqp);
+    return;
+  }
+
+  EqualityNodeId cached = d_explanationLookup.find(pair);
+  if (cached != null_id) {
+    ++ nonConst->d_stats.explanationCacheHits;
+    const CachedExplanation& explanation = d_explanationCache[cached];
+    equalities.insert(equalities.end(),
+                      d_explanationReasons.begin() + explanation.start,
+                      d_explanationReasons.begin() + explanation.end);
+    return;
+  }
+
+  ++ nonConst->d_stats.explanationCacheMisses;
+  size_t start = equalities.size();
+  getPathExplanation(t1Id, t2Id, equalities, eqp);
+
+  // The explanation holds until we backtrack below the current level
+  DefaultSizeType reasonsStart = d_explanationReasons.size();
+  nonConst->d_explanationReasons.insert(d_explanationReasons.end(),
+                                        equalities.begin() + start,
+                                        equalities.end());
+  nonConst->d_explanationLookup.insert(pair, d_explanationCache.size());
+  nonConst->d_explanationCache.push_back(CachedExplanation(pair, reasonsStart, d_explanationReasons.size()));
+  nonConst->d_explanationCacheSize = d_explanationCacheSize + 1;
+}
 
+void EqualityEngine::getPathExplanation(EqualityNodeId t1Id, EqualityNodeId t2Id,
+                                        std::vector<TNode>& equalities,
+                                        EqProof* eqp) const {
   if (Debug.isOn("equality::internal")) {
     debugPrintGraph();
   }
@@ -1538,7 +1608,8 @@ void EqualityEngine::propagate() {
     }
 
     // Vector to collect the triggered events
-    std::vector<TriggerId> triggers;
+    std::vector<TriggerId>& triggers = d_mergeTriggers;
+    triggers.clear();
 
     // Figure out the merge preference
     EqualityNodeId mergeInto = t1classId;
@@ -1695,13 +1766,13 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
 
   // Create the equality
   FunctionApplication eqNormalized(APP_EQUALITY, t1ClassId, t2ClassId);
-  ApplicationIdsMap::const_iterator find = d_applicationLookup.find(eqNormalized);
-  if (find != d_applicationLookup.end()) {
-    if (getEqualityNode(find->second).getFind() == getEqualityNode(d_falseId).getFind()) {
+  EqualityNodeId find = d_applicationLookup.find(eqNormalized);
+  if (find != null_id) {
+    if (getEqualityNode(find).getFind() == getEqualityNode(d_falseId).getFind()) {
       if (ensureProof) {
-        const FunctionApplication original = d_applications[find->second].original;
+        const FunctionApplication original = d_applications[find].original;
         nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t1Id, original.a));
-        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find->second, d_falseId));
+        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find, d_falseId));
         nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t2Id, original.b));
         nonConst->storePropagatedDisequality(THEORY_LAST, t1Id, t2Id);
       }
@@ -1713,12 +1784,12 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
   // Check the symmetric disequality
   std::swap(eqNormalized.a, eqNormalized.b);
   find = d_applicationLookup.find(eqNormalized);
-  if (find != d_applicationLookup.end()) {
-    if (getEqualityNode(find->second).getFind() == getEqualityNode(d_falseId).getFind()) {
+  if (find != null_id) {
+    if (getEqualityNode(find).getFind() == getEqualityNode(d_falseId).getFind()) {
       if (ensureProof) {
-        const FunctionApplication original = d_applications[find->second].original;
+        const FunctionApplication original = d_applications[find].original;
         nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t2Id, original.a));
-        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find->second, d_falseId));
+        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find, d_falseId));
         nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t1Id, original.b));
         nonConst->storePropagatedDisequality(THEORY_LAST, t1Id, t2Id);
       }
@@ -1850,8 +1921,8 @@ TNode EqualityEngine::getTriggerTermRepresentative(TNode t, TheoryId tag) const
 }
 
 void EqualityEngine::storeApplicationLookup(FunctionApplication& funNormalized, EqualityNodeId funId) {
-  Assert(d_applicationLookup.find(funNormalized) == d_applicationLookup.end());
-  d_applicationLookup[funNormalized] = funId;
+  Assert(!d_applicationLookup.contains(funNormalized));
+  d_applicationLookup.insert(funNormalized, funId);
   d_applicationLookups.push_back(funNormalized);
   d_applicationLookupsCount = d_applicationLookupsCount + 1;
   Debug("equality::backtrack") << "d_applicationLookupsCount = " << d_applicationLookupsCount << std::endl;
@@ -33,6 +33,7 @@
 #include "theory/rewriter.h"
 #include "theory/theory.h"
 #include "theory/uf/equality_engine_types.h"
+#include "theory/uf/equality_id_map.h"
 #include "util/statistics_registry.h"
 
 namespace CVC4 {
@@ -218,6 +219,11 @@ public:
     IntStat functionTermsCount;
     /** Number of constant terms managed by the system */
     IntStat constantTermsCount;
+    /** Number of explanations found in, and added to, the cache */
+    IntStat explanationCacheHits;
+    IntStat explanationCacheMisses;
+    /** Number of reasons of the explanations returned */
+    AverageStat explanationLength;
 
     Statistics(std::string name);
 
@@ -251,10 +257,10 @@ private:
   std::map<unsigned, const PathReconstructionNotify*> d_pathReconstructionTriggers;
 
   /** Map from nodes to their ids */
-  std::unordered_map<TNode, EqualityNodeId, TNodeHashFunction> d_nodeIds;
+  EqualityIdMap<TNode, TNodeHashFunction> d_nodeIds;
 
   /** Map from function applications to their ids */
-  typedef std::unordered_map<FunctionApplication, EqualityNodeId, FunctionApplicationHashFunction> ApplicationIdsMap;
+  typedef EqualityIdMap<FunctionApplication, FunctionApplicationHashFunction> ApplicationIdsMap;
 
   /**
    * A map from a pair (a', b') to a function application f(a, b), where a' and b' are the current representatives
@@ -391,6 +397,12 @@ private:
    */
   bool merge(EqualityNode& class1, EqualityNode& class2, std::vector<TriggerId>& triggers);
 
+  /**
+   * The triggers fired by the merge being processed in propagate(), kept
+   * to reuse its memory across merges (propagate() is not reentrant).
+   */
+  std::vector<TriggerId> d_mergeTriggers;
+
   /** Undo the merge of class2 into class1 */
   void undoMerge(EqualityNode& class1, EqualityNode& class2, EqualityNodeId class2Id);
 
@@ -522,6 +534,40 @@ private:
    */
   void getExplanation(EqualityEdgeId t1Id, EqualityNodeId t2Id, std::vector<TNode>& equalities, EqProof* eqp) const;
 
+  /**
+   * Get the explanation of t1 = t2 along the path between them in the
+   * equality graph, the work of getExplanation() for t1 != t2.
+   */
+  void getPathExplanation(EqualityNodeId t1Id, EqualityNodeId t2Id, std::vector<TNode>& equalities, EqProof* eqp) const;
+
+  /** Whether explanations without proofs are cached (--ee-explanation-cache) */
+  bool d_cacheExplanations;
+
+  /**
+   * An explanation in the cache: the explained pair of ids, smaller id
+   * first, and the range of its reasons in d_explanationReasons.
+   */
+  struct CachedExplanation {
+    EqualityPair pair;
+    DefaultSizeType start;
+    DefaultSizeType end;
+    CachedExplanation() : start(0), end(0) {}
+    CachedExplanation(const EqualityPair& pair, DefaultSizeType start, DefaultSizeType end)
+    : pair(pair), start(start), end(end) {}
+  };
+
+  /** The cached explanations, in order, so that we can backtrack */
+  std::vector<CachedExplanation> d_explanationCache;
+
+  /** The reasons of the cached explanations */
+  std::vector<TNode> d_explanationReasons;
+
+  /** Map from explained pairs to their index in d_explanationCache */
+  EqualityIdMap<EqualityPair, EqualityPairHashFunction> d_explanationLookup;
+
+  /** Number of cached explanations, for backtracking */
+  context::CDO<DefaultSizeType> d_explanationCacheSize;
+
   /**
    * Print the equality graph.
    */
@@ -321,10 +321,10 @@ struct FunctionApplication {
 
 struct FunctionApplicationHashFunction {
   size_t operator () (const FunctionApplication& app) const {
-    size_t hash = 0;
-    hash = 0x9e3779b9 + app.a;
-    hash ^= 0x9e3779b9 + app.b + (hash << 6) + (hash >> 2);
-    return hash;
+    // the ids are 32 bits, so that (a, b) pairs don't collide
+    uint64_t hash = (uint64_t(app.a) << 32) | app.b;
+    hash ^= uint64_t(app.type) << 30;
+    return size_t(hash ^ (hash >> 32));
   }
 };
 
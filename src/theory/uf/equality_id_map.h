@@ -0,0 +1,169 @@
+/*********************                                                        */
+/*! \file equality_id_map.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Open-addressing maps to equality engine node ids.
+ **
+ ** The equality engine looks up the id of a term, and the application
+ ** with given representative arguments, on every merge.  EqualityIdMap
+ ** keeps its entries inline in one linearly probed array instead of
+ ** allocating a node per entry, as std::unordered_map does.
+ **/
+
+#include "cvc4_private.h"
+
+#ifndef __CVC4__THEORY__UF__EQUALITY_ID_MAP_H
+#define __CVC4__THEORY__UF__EQUALITY_ID_MAP_H
+
+#include <cstdint>
+#include <vector>
+
+#include "base/cvc4_assert.h"
+#include "expr/node.h"
+#include "theory/uf/equality_engine_types.h"
+
+namespace CVC4 {
+namespace theory {
+namespace eq {
+
+/**
+ * A map from keys to equality node ids, or other 32-bit indices, with
+ * linear probing and backward-shift deletion.  A slot is empty iff its id
+ * is null_id, so null_id can't be stored.
+ */
+template <class Key, class KeyHash>
+class EqualityIdMap
+{
+ public:
+  EqualityIdMap() : d_slots(INITIAL_CAPACITY), d_shift(64 - INITIAL_BITS), d_size(0) {}
+
+  /** The id of the key, or null_id if it isn't in the map. */
+  EqualityNodeId find(const Key& key) const
+  {
+    for (size_t i = home(key);; i = next(i))
+    {
+      const Slot& slot = d_slots[i];
+      if (slot.id == null_id)
+      {
+        return null_id;
+      }
+      if (slot.key == key)
+      {
+        return slot.id;
+      }
+    }
+  }
+
+  bool contains(const Key& key) const { return find(key) != null_id; }
+
+  /** Map the key to the id, replacing its old id if there is one. */
+  void insert(const Key& key, EqualityNodeId id)
+  {
+    Assert(id != null_id);
+    if (2 * (d_size + 1) > d_slots.size())
+    {
+      grow();
+    }
+    for (size_t i = home(key);; i = next(i))
+    {
+      Slot& slot = d_slots[i];
+      if (slot.id == null_id)
+      {
+        slot.key = key;
+        slot.id = id;
+        ++d_size;
+        return;
+      }
+      if (slot.key == key)
+      {
+        slot.id = id;
+        return;
+      }
+    }
+  }
+
+  /** Remove the key, if it is in the map. */
+  void erase(const Key& key)
+  {
+    size_t i = home(key);
+    for (;; i = next(i))
+    {
+      if (d_slots[i].id == null_id)
+      {
+        return;
+      }
+      if (d_slots[i].key == key)
+      {
+        break;
+      }
+    }
+    // shift back the entries after the hole that can't be found past it
+    for (size_t j = next(i); d_slots[j].id != null_id; j = next(j))
+    {
+      size_t h = home(d_slots[j].key);
+      // the entry at j stays if its home is cyclically in (i, j]
+      bool stays = i < j ? (i < h && h <= j) : (i < h || h <= j);
+      if (!stays)
+      {
+        d_slots[i] = d_slots[j];
+        i = j;
+      }
+    }
+    d_slots[i] = Slot();
+    --d_size;
+  }
+
+  size_t size() const { return d_size; }
+
+ private:
+  static const unsigned INITIAL_BITS = 6;
+  static const size_t INITIAL_CAPACITY = size_t(1) << INITIAL_BITS;
+
+  struct Slot
+  {
+    Key key;
+    EqualityNodeId id;
+    Slot() : key(), id(null_id) {}
+  };
+
+  /** The slot where the search for the key starts (Fibonacci hashing). */
+  size_t home(const Key& key) const
+  {
+    return size_t((uint64_t(KeyHash()(key)) * 0x9e3779b97f4a7c15ULL) >> d_shift);
+  }
+
+  size_t next(size_t i) const { return (i + 1) & (d_slots.size() - 1); }
+
+  void grow()
+  {
+    std::vector<Slot> old(d_slots.size() * 2);
+    old.swap(d_slots);
+    --d_shift;
+    d_size = 0;
+    for (const Slot& slot : old)
+    {
+      if (slot.id != null_id)
+      {
+        insert(slot.key, slot.id);
+      }
+    }
+  }
+
+  std::vector<Slot> d_slots;
+  /** 64 minus the log of the capacity. */
+  unsigned d_shift;
+  size_t d_size;
+};/* class EqualityIdMap */
+
+}  // namespace eq
+}  // namespace theory
+}  // namespace CVC4
+
+#endif /* __CVC4__THEORY__UF__EQUALITY_ID_MAP_H */
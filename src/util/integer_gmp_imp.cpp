@@ -35,59 +35,68 @@ using namespace std;
 namespace CVC4 {
 
 Integer::Integer(const char* s, unsigned base)
-  : d_value(s, base)
+  : Integer(new mpz_class(s, base))
 {}
 
 Integer::Integer(const std::string& s, unsigned base)
-  : d_value(s, base)
+  : Integer(new mpz_class(s, base))
 {}
 
 
 bool Integer::fitsSignedInt() const {
-  return d_value.fits_sint_p();
+  if(isSmall()){
+    return d_small >= std::numeric_limits<int>::min()
+           && d_small <= std::numeric_limits<int>::max();
+  }
+  return d_big->fits_sint_p();
 }
 
 bool Integer::fitsUnsignedInt() const {
-  return d_value.fits_uint_p();
+  if(isSmall()){
+    return d_small >= 0
+           && static_cast<unsigned long>(d_small)
+                  <= std::numeric_limits<unsigned int>::max();
+  }
+  return d_big->fits_uint_p();
 }
 
 signed int Integer::getSignedInt() const {
   // ensure there isn't overflow
-  CheckArgument(d_value <= std::numeric_limits<int>::max(), this,
+  CheckArgument(*this <= Integer(std::numeric_limits<int>::max()), this,
                 "Overflow detected in Integer::getSignedInt().");
-  CheckArgument(d_value >= std::numeric_limits<int>::min(), this,
+  CheckArgument(*this >= Integer(std::numeric_limits<int>::min()), this,
                 "Overflow detected in Integer::getSignedInt().");
   CheckArgument(fitsSignedInt(), this,
                 "Overflow detected in Integer::getSignedInt().");
-  return (signed int) d_value.get_si();
+  return (signed int) getLong();
 }
 
 unsigned int Integer::getUnsignedInt() const {
   // ensure there isn't overflow
-  CheckArgument(d_value <= std::numeric_limits<unsigned int>::max(), this,
+  CheckArgument(*this <= Integer(std::numeric_limits<unsigned int>::max()), this,
                 "Overflow detected in Integer::getUnsignedInt()");
-  CheckArgument(d_value >= std::numeric_limits<unsigned int>::min(), this,
+  CheckArgument(*this >= Integer(std::numeric_limits<unsigned int>::min()), this,
                 "Overflow detected in Integer::getUnsignedInt()");
   CheckArgument(fitsSignedInt(), this,
                 "Overflow detected in Integer::getUnsignedInt()");
-  return (unsigned int) d_value.get_ui();
+  return (unsigned int) getUnsignedLong();
 }
 
 bool Integer::fitsSignedLong() const {
-  return d_value.fits_slong_p();
+  return isSmall() || d_big->fits_slong_p();
 }
 
 bool Integer::fitsUnsignedLong() const {
-  return d_value.fits_ulong_p();
+  return isSmall() ? d_small >= 0 : d_big->fits_ulong_p();
 }
 
 Integer Integer::oneExtend(uint32_t size, uint32_t amount) const {
   // check that the size is accurate
   DebugCheckArgument((*this) < Integer(1).multiplyByPow2(size), size);
-  mpz_class res = d_value;
+  mpz_class* res = new mpz_class(getValue());
 
   for (unsigned i = size; i < size + amount; ++i) {
-    mpz_setbit(res.get_mpz_t(), i);
+    mpz_setbit(res->get_mpz_t(), i);
   }
 
   return Integer(res);
@@ -95,24 +104,27 @@ Integer Integer::oneExtend(uint32_t size, uint32_t amount) const {
 
 Integer Integer::exactQuotient(const Integer& y) const {
   DebugCheckArgument(y.divides(*this), y);
-  mpz_class q;
-  mpz_divexact(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  if(isSmall() && y.isSmall()){
+    return Integer(d_small / y.d_small);
+  }
+  mpz_class* q = new mpz_class;
+  mpz_divexact(q->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
   return Integer( q );
 }
 
 Integer Integer::modAdd(const Integer& y, const Integer& m) const
 {
-  mpz_class res;
-  mpz_add(res.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.d_value.get_mpz_t());
+  mpz_class* res = new mpz_class;
+  mpz_add(res->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
+  mpz_mod(res->get_mpz_t(), res->get_mpz_t(), GmpView(m).get());
   return Integer(res);
 }
 
 Integer Integer::modMultiply(const Integer& y, const Integer& m) const
 {
-  mpz_class res;
-  mpz_mul(res.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.d_value.get_mpz_t());
+  mpz_class* res = new mpz_class;
+  mpz_mul(res->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
+  mpz_mod(res->get_mpz_t(), res->get_mpz_t(), GmpView(m).get());
   return Integer(res);
 }
 
@@ -120,7 +132,7 @@ Integer Integer::modInverse(const Integer& m) const
 {
   PrettyCheckArgument(m > 0, m, "m must be greater than zero");
   mpz_class res;
-  if (mpz_invert(res.get_mpz_t(), d_value.get_mpz_t(), m.d_value.get_mpz_t())
+  if (mpz_invert(res.get_mpz_t(), GmpView(*this).get(), GmpView(m).get())
       == 0)
   {
     return Integer(-1);
@@ -13,6 +13,8 @@
  ** integer.
  **
  ** A multiprecision integer constant; wraps a GMP multiprecision integer.
+ ** Values that fit in a machine word are kept inline, and only promoted to
+ ** GMP when an operation overflows.
  **/
 
 #include "cvc4_public.h"
@@ -20,9 +22,11 @@
 #ifndef __CVC4__INTEGER_H
 #define __CVC4__INTEGER_H
 
+#include <climits>
 #include <string>
 #include <iosfwd>
 #include <limits>
+#include <utility>
 
 #include "base/exception.h"
 #include "util/gmp_util.h"
@@ -34,26 +38,118 @@ class Rational;
 class CVC4_PUBLIC Integer {
 private:
   /**
-   * Stores the value of the rational is stored in a C++ GMP integer class.
-   * Using this instead of mpz_t allows for easier destruction.
+   * The value of the integer, if it is small, i.e. if it fits in a long
+   * other than LONG_MIN (so that negating it can't overflow).  Most of the
+   * integers the solver sees are small, and their arithmetic is done
+   * inline with overflow checks, without allocating.
    */
-  mpz_class d_value;
+  long d_small;
 
   /**
-   * Gets a reference to the gmp data that backs up the integer.
-   * Only accessible to friend classes.
+   * The value of the integer, if it isn't small, and null otherwise.  A
+   * value is big iff it doesn't fit, so that the representation of each
+   * value is unique.
    */
-  const mpz_class& get_mpz() const { return d_value; }
+  mpz_class* d_big;
+
+  /**
+   * A read-only view of the value as a GMP integer, for the operations
+   * without a small path.  A big value is not copied.
+   */
+  class GmpView {
+  public:
+    explicit GmpView(const Integer& z) : d_ptr(z.d_big) {
+      if(d_ptr == nullptr){
+        mpz_init_set_si(d_copy, z.d_small);
+      }
+    }
+    ~GmpView() {
+      if(d_ptr == nullptr){
+        mpz_clear(d_copy);
+      }
+    }
+    mpz_srcptr get() const {
+      return d_ptr == nullptr ? d_copy : d_ptr->get_mpz_t();
+    }
+  private:
+    GmpView(const GmpView&) = delete;
+    GmpView& operator=(const GmpView&) = delete;
+    const mpz_class* d_ptr;
+    mpz_t d_copy;
+  };/* class Integer::GmpView */
+
+  bool isSmall() const { return d_big == nullptr; }
+
+  /** Whether the GMP integer is in the range of small values. */
+  static bool fitsSmall(mpz_srcptr z) {
+    return mpz_fits_slong_p(z) && mpz_get_si(z) != LONG_MIN;
+  }
+
+  /**
+   * Sets r to a + b (resp. a - b, a * b), and returns true, if the result
+   * is small.
+   */
+  static bool addSmall(long a, long b, long& r) {
+    return !__builtin_add_overflow(a, b, &r) && r != LONG_MIN;
+  }
+  static bool subSmall(long a, long b, long& r) {
+    return !__builtin_sub_overflow(a, b, &r) && r != LONG_MIN;
+  }
+  static bool mulSmall(long a, long b, long& r) {
+    return !__builtin_mul_overflow(a, b, &r) && r != LONG_MIN;
+  }
+
+  /** The gcd of two small values, which is small as well. */
+  static long gcdSmall(long a, long b) {
+    unsigned long x = a < 0 ? -a : a;
+    unsigned long y = b < 0 ? -b : b;
+    while(y != 0){
+      unsigned long t = x % y;
+      x = y;
+      y = t;
+    }
+    return x;
+  }
+
+  /**
+   * Takes ownership of the GMP integer, which is freed if the value is
+   * small.
+   */
+  explicit Integer(mpz_class* big) : d_small(0), d_big(big) {
+    if(fitsSmall(d_big->get_mpz_t())){
+      d_small = mpz_get_si(d_big->get_mpz_t());
+      delete d_big;
+      d_big = nullptr;
+    }
+  }
 
   /**
    * Constructs an Integer by copying a GMP C++ primitive.
    */
-  Integer(const mpz_class& val) : d_value(val) {}
+  Integer(const mpz_class& val) : Integer(new mpz_class(val)) {}
+
+  /**
+   * Returns -1, 0 or 1 as this integer is less than, equal to, or greater
+   * than y.
+   */
+  int compare(const Integer& y) const {
+    if(isSmall()){
+      if(y.isSmall()){
+        return (d_small > y.d_small) - (d_small < y.d_small);
+      }
+      // a big value is further from zero than any small one
+      return -mpz_sgn(y.d_big->get_mpz_t());
+    }else if(y.isSmall()){
+      return mpz_sgn(d_big->get_mpz_t());
+    }
+    int c = mpz_cmp(d_big->get_mpz_t(), y.d_big->get_mpz_t());
+    return (c > 0) - (c < 0);
+  }
 
 public:
 
   /** Constructs a rational with the value 0. */
-  Integer() : d_value(0){}
+  Integer() : d_small(0), d_big(nullptr) {}
 
   /**
    * Constructs a Integer from a C string.
@@ -64,110 +160,190 @@ public:
   explicit Integer(const char* s, unsigned base = 10);
   explicit Integer(const std::string& s, unsigned base = 10);
 
-  Integer(const Integer& q) : d_value(q.d_value) {}
+  Integer(const Integer& q)
+    : d_small(q.d_small),
+      d_big(q.isSmall() ? nullptr : new mpz_class(*q.d_big))
+  {}
 
-  Integer(  signed int z) : d_value(z) {}
-  Integer(unsigned int z) : d_value(z) {}
-  Integer(  signed long int z) : d_value(z) {}
-  Integer(unsigned long int z) : d_value(z) {}
+  Integer(Integer&& q) : d_small(q.d_small), d_big(q.d_big) {
+    q.d_small = 0;
+    q.d_big = nullptr;
+  }
+
+  Integer(  signed int z) : Integer(static_cast<signed long>(z)) {}
+  Integer(unsigned int z) : Integer(static_cast<unsigned long>(z)) {}
+  Integer(  signed long int z) : d_small(z), d_big(nullptr) {
+    if(z == LONG_MIN){
+      d_big = new mpz_class(z);
+    }
+  }
+  Integer(unsigned long int z) : d_small(0), d_big(nullptr) {
+    if(z <= static_cast<unsigned long>(LONG_MAX)){
+      d_small = z;
+    }else{
+      d_big = new mpz_class(z);
+    }
+  }
 
 #ifdef CVC4_NEED_INT64_T_OVERLOADS
-  Integer( int64_t z) : d_value(static_cast<long>(z)) {}
-  Integer(uint64_t z) : d_value(static_cast<unsigned long>(z)) {}
+  Integer( int64_t z) : Integer(static_cast<long>(z)) {}
+  Integer(uint64_t z) : Integer(static_cast<unsigned long>(z)) {}
 #endif /* CVC4_NEED_INT64_T_OVERLOADS */
 
-  ~Integer() {}
+  ~Integer() { delete d_big; }
 
   /**
-   * Returns a copy of d_value to enable public access of GMP data.
+   * Returns a copy of the value to enable public access of GMP data.
    */
   mpz_class getValue() const
   {
-    return d_value;
+    return isSmall() ? mpz_class(d_small) : *d_big;
   }
 
   Integer& operator=(const Integer& x){
     if(this == &x) return *this;
-    d_value = x.d_value;
+    if(x.isSmall()){
+      delete d_big;
+      d_big = nullptr;
+      d_small = x.d_small;
+    }else if(isSmall()){
+      d_big = new mpz_class(*x.d_big);
+    }else{
+      *d_big = *x.d_big;
+    }
+    return *this;
+  }
+
+  Integer& operator=(Integer&& x){
+    std::swap(d_small, x.d_small);
+    std::swap(d_big, x.d_big);
     return *this;
   }
 
   bool operator==(const Integer& y) const {
-    return d_value == y.d_value;
+    if(isSmall() || y.isSmall()){
+      return d_big == y.d_big && d_small == y.d_small;
+    }
+    return *d_big == *y.d_big;
   }
 
   Integer operator-() const {
-    return Integer(-(d_value));
+    if(isSmall()){
+      return Integer(-d_small);
+    }
+    return Integer(new mpz_class(-*d_big));
   }
 
 
   bool operator!=(const Integer& y) const {
-    return d_value != y.d_value;
+    return !(*this == y);
   }
 
   bool operator< (const Integer& y) const {
-    return d_value < y.d_value;
+    return compare(y) < 0;
   }
 
   bool operator<=(const Integer& y) const {
-    return d_value <= y.d_value;
+    return compare(y) <= 0;
   }
 
   bool operator> (const Integer& y) const {
-    return d_value > y.d_value;
+    return compare(y) > 0;
   }
 
   bool operator>=(const Integer& y) const {
-    return d_value >= y.d_value;
+    return compare(y) >= 0;
   }
 
 
   Integer operator+(const Integer& y) const {
-    return Integer( d_value + y.d_value );
+    long r;
+    if(isSmall() && y.isSmall() && addSmall(d_small, y.d_small, r)){
+      return Integer(r);
+    }
+    mpz_class* result = new mpz_class;
+    mpz_add(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
+    return Integer(result);
   }
   Integer& operator+=(const Integer& y) {
-    d_value += y.d_value;
-    return *this;
+    long r;
+    if(isSmall() && y.isSmall() && addSmall(d_small, y.d_small, r)){
+      d_small = r;
+      return *this;
+    }
+    return *this = *this + y;
   }
 
   Integer operator-(const Integer& y) const {
-    return Integer( d_value - y.d_value );
+    long r;
+    if(isSmall() && y.isSmall() && subSmall(d_small, y.d_small, r)){
+      return Integer(r);
+    }
+    mpz_class* result = new mpz_class;
+    mpz_sub(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
+    return Integer(result);
   }
   Integer& operator-=(const Integer& y) {
-    d_value -= y.d_value;
-    return *this;
+    long r;
+    if(isSmall() && y.isSmall() && subSmall(d_small, y.d_small, r)){
+      d_small = r;
+      return *this;
+    }
+    return *this = *this - y;
   }
 
   Integer operator*(const Integer& y) const {
-    return Integer( d_value * y.d_value );
+    long r;
+    if(isSmall() && y.isSmall() && mulSmall(d_small, y.d_small, r)){
+      return Integer(r);
+    }
+    mpz_class* result = new mpz_class;
+    mpz_mul(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
+    return Integer(result);
   }
   Integer& operator*=(const Integer& y) {
-    d_value *= y.d_value;
-    return *this;
+    long r;
+    if(isSmall() && y.isSmall() && mulSmall(d_small, y.d_small, r)){
+      d_small = r;
+      return *this;
+    }
+    return *this = *this * y;
   }
 
 
   Integer bitwiseOr(const Integer& y) const {
-    mpz_class result;
-    mpz_ior(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      return Integer(d_small | y.d_small);
+    }
+    mpz_class* result = new mpz_class;
+    mpz_ior(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
     return Integer(result);
   }
 
   Integer bitwiseAnd(const Integer& y) const {
-    mpz_class result;
-    mpz_and(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      return Integer(d_small & y.d_small);
+    }
+    mpz_class* result = new mpz_class;
+    mpz_and(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
     return Integer(result);
   }
 
   Integer bitwiseXor(const Integer& y) const {
-    mpz_class result;
-    mpz_xor(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      return Integer(d_small ^ y.d_small);
+    }
+    mpz_class* result = new mpz_class;
+    mpz_xor(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
     return Integer(result);
   }
 
   Integer bitwiseNot() const {
-    mpz_class result;
-    mpz_com(result.get_mpz_t(), d_value.get_mpz_t());
+    if(isSmall()){
+      return Integer(~d_small);
+    }
+    mpz_class* result = new mpz_class;
+    mpz_com(result->get_mpz_t(), d_big->get_mpz_t());
     return Integer(result);
   }
 
@@ -175,9 +351,15 @@ public:
    * Return this*(2^pow).
    */
   Integer multiplyByPow2(uint32_t pow) const{
-    mpz_class result;
-    mpz_mul_2exp(result.get_mpz_t(), d_value.get_mpz_t(), pow);
-    return Integer( result );
+    if(isSmall() && pow < SMALL_BITS){
+      long r = static_cast<unsigned long>(d_small) << pow;
+      if(r >> pow == d_small){
+        return Integer(r);
+      }
+    }
+    mpz_class* result = new mpz_class;
+    mpz_mul_2exp(result->get_mpz_t(), GmpView(*this).get(), pow);
+    return Integer(result);
   }
 
   /**
@@ -185,9 +367,12 @@ public:
    * current Integer to 1.
    */
   Integer setBit(uint32_t i) const {
-    mpz_class res = d_value;
-    mpz_setbit(res.get_mpz_t(), i);
-    return Integer(res);
+    if(isSmall() && i < SMALL_BITS - 1){
+      return Integer(d_small | (1L << i));
+    }
+    mpz_class* result = new mpz_class(getValue());
+    mpz_setbit(result->get_mpz_t(), i);
+    return Integer(result);
   }
 
   bool isBitSet(uint32_t i) const {
@@ -201,17 +386,25 @@ public:
   Integer oneExtend(uint32_t size, uint32_t amount) const;
 
   uint32_t toUnsignedInt() const {
-    return  mpz_get_ui(d_value.get_mpz_t());
+    if(isSmall()){
+      // like mpz_get_ui(), the low bits of the absolute value
+      return static_cast<unsigned long>(d_small < 0 ? -d_small : d_small);
+    }
+    return mpz_get_ui(d_big->get_mpz_t());
   }
 
   /** See GMP Documentation. */
   Integer extractBitRange(uint32_t bitCount, uint32_t low) const {
     // bitCount = high-low+1
     uint32_t high = low + bitCount-1;
+    if(isSmall() && high + 1 < SMALL_BITS - 1){
+      return Integer((d_small & ((1L << (high + 1)) - 1)) >> low);
+    }
     //— Function: void mpz_fdiv_r_2exp (mpz_t r, mpz_t n, mp_bitcnt_t b)
-    mpz_class rem, div;
-    mpz_fdiv_r_2exp(rem.get_mpz_t(), d_value.get_mpz_t(), high+1);
-    mpz_fdiv_q_2exp(div.get_mpz_t(), rem.get_mpz_t(), low);
+    mpz_class rem;
+    mpz_class* div = new mpz_class;
+    mpz_fdiv_r_2exp(rem.get_mpz_t(), GmpView(*this).get(), high+1);
+    mpz_fdiv_q_2exp(div->get_mpz_t(), rem.get_mpz_t(), low);
 
     return Integer(div);
   }
@@ -220,33 +413,55 @@ public:
    * Returns the floor(this / y)
    */
   Integer floorDivideQuotient(const Integer& y) const {
-    mpz_class q;
-    mpz_fdiv_q(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-    return Integer( q );
+    Integer q, r;
+    floorQR(q, r, *this, y);
+    return q;
   }
 
   /**
    * Returns r == this - floor(this/y)*y
    */
   Integer floorDivideRemainder(const Integer& y) const {
-    mpz_class r;
-    mpz_fdiv_r(r.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-    return Integer( r );
+    Integer q, r;
+    floorQR(q, r, *this, y);
+    return r;
   }
 
   /**
    * Computes a floor quotient and remainder for x divided by y.
    */
   static void floorQR(Integer& q, Integer& r, const Integer& x, const Integer& y) {
-    mpz_fdiv_qr(q.d_value.get_mpz_t(), r.d_value.get_mpz_t(), x.d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(x.isSmall() && y.isSmall()){
+      long sq = x.d_small / y.d_small;
+      long sr = x.d_small % y.d_small;
+      if(sr != 0 && (sr < 0) != (y.d_small < 0)){
+        --sq;
+        sr += y.d_small;
+      }
+      q = Integer(sq);
+      r = Integer(sr);
+      return;
+    }
+    mpz_class* bq = new mpz_class;
+    mpz_class* br = new mpz_class;
+    mpz_fdiv_qr(bq->get_mpz_t(), br->get_mpz_t(), GmpView(x).get(), GmpView(y).get());
+    q = Integer(bq);
+    r = Integer(br);
   }
 
   /**
    * Returns the ceil(this / y)
    */
   Integer ceilingDivideQuotient(const Integer& y) const {
-    mpz_class q;
-    mpz_cdiv_q(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      long q = d_small / y.d_small;
+      if(d_small % y.d_small != 0 && (d_small < 0) == (y.d_small < 0)){
+        ++q;
+      }
+      return Integer(q);
+    }
+    mpz_class* q = new mpz_class;
+    mpz_cdiv_q(q->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
     return Integer( q );
   }
 
@@ -254,8 +469,15 @@ public:
    * Returns the ceil(this / y)
    */
   Integer ceilingDivideRemainder(const Integer& y) const {
-    mpz_class r;
-    mpz_cdiv_r(r.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      long r = d_small % y.d_small;
+      if(r != 0 && (r < 0) == (y.d_small < 0)){
+        r -= y.d_small;
+      }
+      return Integer(r);
+    }
+    mpz_class* r = new mpz_class;
+    mpz_cdiv_r(r->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
     return Integer( r );
   }
 
@@ -324,8 +546,11 @@ public:
    * Returns y mod 2^exp
    */
   Integer modByPow2(uint32_t exp) const {
-    mpz_class res;
-    mpz_fdiv_r_2exp(res.get_mpz_t(), d_value.get_mpz_t(), exp);
+    if(isSmall() && exp < SMALL_BITS - 1){
+      return Integer(d_small & ((1L << exp) - 1));
+    }
+    mpz_class* res = new mpz_class;
+    mpz_fdiv_r_2exp(res->get_mpz_t(), GmpView(*this).get(), exp);
     return Integer(res);
   }
 
@@ -333,14 +558,21 @@ public:
    * Returns y / 2^exp
    */
   Integer divByPow2(uint32_t exp) const {
-    mpz_class res;
-    mpz_fdiv_q_2exp(res.get_mpz_t(), d_value.get_mpz_t(), exp);
+    if(isSmall() && exp < SMALL_BITS){
+      // the shift of a negative value is arithmetic, i.e. rounds down
+      return Integer(d_small >> exp);
+    }
+    mpz_class* res = new mpz_class;
+    mpz_fdiv_q_2exp(res->get_mpz_t(), GmpView(*this).get(), exp);
     return Integer(res);
   }
 
 
   int sgn() const {
-    return mpz_sgn(d_value.get_mpz_t());
+    if(isSmall()){
+      return (d_small > 0) - (d_small < 0);
+    }
+    return mpz_sgn(d_big->get_mpz_t());
   }
 
   inline bool strictlyPositive() const {
@@ -356,11 +588,11 @@ public:
   }
 
   bool isOne() const {
-    return mpz_cmp_si(d_value.get_mpz_t(), 1) == 0;
+    return isSmall() && d_small == 1;
   }
 
   bool isNegativeOne() const {
-    return mpz_cmp_si(d_value.get_mpz_t(), -1) == 0;
+    return isSmall() && d_small == -1;
   }
 
   /**
@@ -369,8 +601,8 @@ public:
    * @param exp the exponent
    */
   Integer pow(unsigned long int exp) const {
-    mpz_class result;
-    mpz_pow_ui(result.get_mpz_t(), d_value.get_mpz_t(), exp);
+    mpz_class* result = new mpz_class;
+    mpz_pow_ui(result->get_mpz_t(), GmpView(*this).get(), exp);
     return Integer(result);
   }
 
@@ -378,8 +610,11 @@ public:
    * Return the greatest common divisor of this integer with another.
    */
   Integer gcd(const Integer& y) const {
-    mpz_class result;
-    mpz_gcd(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      return Integer(gcdSmall(d_small, y.d_small));
+    }
+    mpz_class* result = new mpz_class;
+    mpz_gcd(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
     return Integer(result);
   }
 
@@ -387,8 +622,19 @@ public:
    * Return the least common multiple of this integer with another.
    */
   Integer lcm(const Integer& y) const {
-    mpz_class result;
-    mpz_lcm(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      if(d_small == 0 || y.d_small == 0){
+        return Integer();
+      }
+      long r;
+      long a = d_small < 0 ? -d_small : d_small;
+      long b = y.d_small < 0 ? -y.d_small : y.d_small;
+      if(mulSmall(a / gcdSmall(a, b), b, r)){
+        return Integer(r);
+      }
+    }
+    mpz_class* result = new mpz_class;
+    mpz_lcm(result->get_mpz_t(), GmpView(*this).get(), GmpView(y).get());
     return Integer(result);
   }
 
@@ -421,7 +667,10 @@ public:
    * ! zero.divides(zero)
    */
   bool divides(const Integer& y) const {
-    int res = mpz_divisible_p(y.d_value.get_mpz_t(), d_value.get_mpz_t());
+    if(isSmall() && y.isSmall()){
+      return d_small == 0 ? y.d_small == 0 : y.d_small % d_small == 0;
+    }
+    int res = mpz_divisible_p(GmpView(y).get(), GmpView(*this).get());
     return res != 0;
   }
 
@@ -429,11 +678,14 @@ public:
    * Return the absolute value of this integer.
    */
   Integer abs() const {
-    return d_value >= 0 ? *this : -*this;
+    return sgn() >= 0 ? *this : -*this;
   }
 
   std::string toString(int base = 10) const{
-    return d_value.get_str(base);
+    if(isSmall() && base == 10){
+      return std::to_string(d_small);
+    }
+    return getValue().get_str(base);
   }
 
   bool fitsSignedInt() const;
@@ -449,17 +701,22 @@ public:
   bool fitsUnsignedLong() const;
 
   long getLong() const {
-    long si = d_value.get_si();
+    if(isSmall()){
+      return d_small;
+    }
+    long si = d_big->get_si();
     // ensure there wasn't overflow
-    CheckArgument(mpz_cmp_si(d_value.get_mpz_t(), si) == 0, this,
+    CheckArgument(mpz_cmp_si(d_big->get_mpz_t(), si) == 0, this,
                  "Overflow detected in Integer::getLong().");
     return si;
   }
 
   unsigned long getUnsignedLong() const {
-    unsigned long ui = d_value.get_ui();
+    unsigned long ui = isSmall() ? d_small : d_big->get_ui();
     // ensure there wasn't overflow
-    CheckArgument(mpz_cmp_ui(d_value.get_mpz_t(), ui) == 0, this,
+    CheckArgument(isSmall() ? d_small >= 0
+                            : mpz_cmp_ui(d_big->get_mpz_t(), ui) == 0,
+                  this,
                   "Overflow detected in Integer::getUnsignedLong().");
     return ui;
   }
@@ -469,7 +726,11 @@ public:
    * numerator, the denominator.
    */
   size_t hash() const {
-    return gmpz_hash(d_value.get_mpz_t());
+    if(isSmall()){
+      // what gmpz_hash() computes for the single limb of the value
+      return d_small < 0 ? -d_small : d_small;
+    }
+    return gmpz_hash(d_big->get_mpz_t());
   }
 
   /**
@@ -479,7 +740,11 @@ public:
    * @return true if bit n is set in this integer; false otherwise
    */
   bool testBit(unsigned n) const {
-    return mpz_tstbit(d_value.get_mpz_t(), n);
+    if(isSmall()){
+      // bits past the word are copies of the sign bit
+      return n < SMALL_BITS ? (d_small >> n) & 1 : d_small < 0;
+    }
+    return mpz_tstbit(d_big->get_mpz_t(), n);
   }
 
   /**
@@ -487,11 +752,14 @@ public:
    * @return k if the integer is equal to 2^(k-1) and 0 otherwise
    */
   unsigned isPow2() const {
-    if (d_value <= 0) return 0;
+    if (sgn() <= 0) return 0;
+    if (isSmall()) {
+      return (d_small & (d_small - 1)) == 0 ? __builtin_ctzl(d_small) + 1 : 0;
+    }
     // check that the number of ones in the binary representation is 1
-    if (mpz_popcount(d_value.get_mpz_t()) == 1) {
+    if (mpz_popcount(d_big->get_mpz_t()) == 1) {
       // return the index of the first one plus 1
-      return mpz_scan1(d_value.get_mpz_t(), 0) + 1;
+      return mpz_scan1(d_big->get_mpz_t(), 0) + 1;
     }
     return 0; 
   }
@@ -504,15 +772,23 @@ public:
   size_t length() const {
     if(sgn() == 0){
       return 1;
+    }else if(isSmall()){
+      return SMALL_BITS - __builtin_clzl(d_small < 0 ? -d_small : d_small);
     }else{
-      return mpz_sizeinbase(d_value.get_mpz_t(),2);
+      return mpz_sizeinbase(d_big->get_mpz_t(),2);
     }
   }
 
   static void extendedGcd(Integer& g, Integer& s, Integer& t, const Integer& a, const Integer& b){
     //see the documentation for:
     //mpz_gcdext (mpz_t g, mpz_t s, mpz_t t, mpz_t a, mpz_t b);
-    mpz_gcdext (g.d_value.get_mpz_t(), s.d_value.get_mpz_t(), t.d_value.get_mpz_t(), a.d_value.get_mpz_t(), b.d_value.get_mpz_t());
+    mpz_class* bg = new mpz_class;
+    mpz_class* bs = new mpz_class;
+    mpz_class* bt = new mpz_class;
+    mpz_gcdext (bg->get_mpz_t(), bs->get_mpz_t(), bt->get_mpz_t(), GmpView(a).get(), GmpView(b).get());
+    g = Integer(bg);
+    s = Integer(bs);
+    t = Integer(bt);
   }
 
   /** Returns a reference to the minimum of two integers. */
@@ -526,6 +802,10 @@ public:
   }
 
   friend class CVC4::Rational;
+
+private:
+  /** The number of bits of a small value, including the sign bit. */
+  static const unsigned SMALL_BITS = sizeof(long) * CHAR_BIT;
 };/* class Integer */
 
 struct IntegerHashFunction {
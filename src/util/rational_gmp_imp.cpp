@@ -91,9 +91,9 @@ Maybe<Rational> Rational::fromDouble(double d)
 {
   using namespace std;
   if(isfinite(d)){
-    Rational q;
-    mpq_set_d(q.d_value.get_mpq_t(), d);
-    return q;
+    mpq_class* q = new mpq_class;
+    mpq_set_d(q->get_mpq_t(), d);
+    return Rational(q);
   }
   return Maybe<Rational>();
 }
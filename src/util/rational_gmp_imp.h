@@ -13,6 +13,8 @@
  ** rational.
  **
  ** Multiprecision rational constants; wraps a GMP multiprecision rational.
+ ** Rationals whose numerator and denominator fit in a machine word are kept
+ ** inline, and only promoted to GMP when an operation overflows.
  **/
 
 #include "cvc4_public.h"
@@ -28,7 +30,9 @@
 #include <cstddef>
 
 #include <gmp.h>
+#include <climits>
 #include <string>
+#include <utility>
 
 #include "base/exception.h"
 #include "util/integer.h"
@@ -54,10 +58,64 @@ namespace CVC4 {
 class CVC4_PUBLIC Rational {
 private:
   /**
-   * Stores the value of the rational is stored in a C++ GMP rational class.
-   * Using this instead of mpq_t allows for easier destruction.
+   * The numerator and denominator of the rational, if it is small, i.e. if
+   * both fit in a long other than LONG_MIN.  The denominator of a small
+   * rational is positive and coprime to the numerator.  Most tableau
+   * coefficients and bounds are small, and their arithmetic is done inline
+   * with overflow checks, without allocating.
    */
-  mpq_class d_value;
+  long d_num;
+  long d_den;
+
+  /**
+   * The value of the rational in canonical form, if it isn't small, and
+   * null otherwise.  A value is big iff it doesn't fit, so that the
+   * representation of each value is unique.
+   */
+  mpq_class* d_big;
+
+  /**
+   * A read-only view of the value as a GMP rational, for the operations
+   * without a small path.  A big value is not copied.
+   */
+  class GmpView {
+  public:
+    explicit GmpView(const Rational& q) : d_ptr(q.d_big) {
+      if(d_ptr == nullptr){
+        mpq_init(d_copy);
+        mpq_set_si(d_copy, q.d_num, q.d_den);
+      }
+    }
+    ~GmpView() {
+      if(d_ptr == nullptr){
+        mpq_clear(d_copy);
+      }
+    }
+    mpq_srcptr get() const {
+      return d_ptr == nullptr ? d_copy : d_ptr->get_mpq_t();
+    }
+  private:
+    GmpView(const GmpView&) = delete;
+    GmpView& operator=(const GmpView&) = delete;
+    const mpq_class* d_ptr;
+    mpq_t d_copy;
+  };/* class Rational::GmpView */
+
+  bool isSmall() const { return d_big == nullptr; }
+
+  /**
+   * Takes ownership of the GMP rational, which must be in canonical form,
+   * and which is freed if the value is small.
+   */
+  explicit Rational(mpq_class* big) : d_num(0), d_den(1), d_big(big) {
+    if(Integer::fitsSmall(d_big->get_num_mpz_t())
+       && Integer::fitsSmall(d_big->get_den_mpz_t())){
+      d_num = mpz_get_si(d_big->get_num_mpz_t());
+      d_den = mpz_get_si(d_big->get_den_mpz_t());
+      delete d_big;
+      d_big = nullptr;
+    }
+  }
 
   /**
    * Constructs a Rational from a mpq_class object.
@@ -65,7 +123,90 @@ private:
    * Assumes that the value is in canonical form, and thus does not
    * have to call canonicalize() on the value.
    */
-  Rational(const mpq_class& val) : d_value(val) {  }
+  Rational(const mpq_class& val) : Rational(new mpq_class(val)) {  }
+
+  /** Canonicalizes the GMP rational, and returns it. */
+  static mpq_class* canonical(mpq_class* q) {
+    q->canonicalize();
+    return q;
+  }
+
+  /** Sets the value to n/d, for small n and nonzero d, in canonical form. */
+  void setSmall(long n, long d) {
+    long g = Integer::gcdSmall(n, d);
+    if(g != 1){
+      n /= g;
+      d /= g;
+    }
+    // neither is LONG_MIN, so both can be negated
+    d_num = d < 0 ? -n : n;
+    d_den = d < 0 ? -d : d;
+  }
+
+  /** Sets the value to n/d, for any n and d, in canonical form. */
+  void setMpz(mpz_srcptr n, mpz_srcptr d) {
+    mpq_class* big = new mpq_class;
+    mpq_set_num(big->get_mpq_t(), n);
+    mpq_set_den(big->get_mpq_t(), d);
+    big->canonicalize();
+    *this = Rational(big);
+  }
+
+  /**
+   * Sets r to a/b + s * c/d, for small rationals a/b and c/d and s either
+   * 1 or -1, and returns true, if the result is small.  The
+   * computation follows GMP's mpq_add(), which avoids the gcd of the
+   * result where it can.
+   */
+  static bool addSmall(long a, long b, long c, long d, long s, Rational& r) {
+    long t, u;
+    if(b == d){
+      if(!Integer::mulSmall(s, c, c) || !Integer::addSmall(a, c, t)){
+        return false;
+      }
+      long g = b == 1 ? 1 : Integer::gcdSmall(t, b);
+      r.d_num = t / g;
+      r.d_den = b / g;
+      return true;
+    }
+    long g = Integer::gcdSmall(b, d);
+    if(!Integer::mulSmall(a, d / g, t)
+       || !Integer::mulSmall(s * c, b / g, u)
+       || !Integer::addSmall(t, u, t)){
+      return false;
+    }
+    long h = g == 1 ? 1 : Integer::gcdSmall(t, g);
+    if(!Integer::mulSmall(b / g, d / h, u)){
+      return false;
+    }
+    r.d_num = t / h;
+    r.d_den = u;
+    return true;
+  }
+
+  /**
+   * Sets r to the product of the small rationals a/b * c/d, and returns
+   * true, if the result is small.
+   */
+  static bool mulSmall(long a, long b, long c, long d, Rational& r) {
+    long g = Integer::gcdSmall(a, d);
+    long h = Integer::gcdSmall(c, b);
+    if(g > 1){
+      a /= g;
+      d /= g;
+    }
+    if(h > 1){
+      c /= h;
+      b /= h;
+    }
+    long n, e;
+    if(!Integer::mulSmall(a, c, n) || !Integer::mulSmall(b, d, e)){
+      return false;
+    }
+    r.d_num = n;
+    r.d_den = e;
+    return true;
+  }
 
 public:
 
@@ -78,9 +219,7 @@ public:
   static Rational fromDecimal(const std::string& dec);
 
   /** Constructs a rational with the value 0/1. */
-  Rational() : d_value(0){
-    d_value.canonicalize();
-  }
+  Rational() : d_num(0), d_den(1), d_big(nullptr) {}
 
   /**
    * Constructs a Rational from a C string in a given base (defaults to 10).
@@ -89,88 +228,79 @@ public:
    * For more information about what is a valid rational string,
    * see GMP's documentation for mpq_set_str().
    */
-  explicit Rational(const char* s, unsigned base = 10): d_value(s, base) {
-    d_value.canonicalize();
+  explicit Rational(const char* s, unsigned base = 10)
+    : Rational(canonical(new mpq_class(s, base))) {
   }
-  Rational(const std::string& s, unsigned base = 10) : d_value(s, base) {
-    d_value.canonicalize();
+  Rational(const std::string& s, unsigned base = 10)
+    : Rational(canonical(new mpq_class(s, base))) {
   }
 
   /**
    * Creates a Rational from another Rational, q, by performing a deep copy.
    */
-  Rational(const Rational& q) : d_value(q.d_value) {
-    d_value.canonicalize();
+  Rational(const Rational& q)
+    : d_num(q.d_num),
+      d_den(q.d_den),
+      d_big(q.isSmall() ? nullptr : new mpq_class(*q.d_big))
+  {}
+
+  Rational(Rational&& q) : d_num(q.d_num), d_den(q.d_den), d_big(q.d_big) {
+    q.d_num = 0;
+    q.d_den = 1;
+    q.d_big = nullptr;
   }
 
   /**
    * Constructs a canonical Rational from a numerator.
    */
-  Rational(signed int n) : d_value(n,1) {
-    d_value.canonicalize();
-  }
-  Rational(unsigned int n) : d_value(n,1) {
-    d_value.canonicalize();
-  }
-  Rational(signed long int n) : d_value(n,1) {
-    d_value.canonicalize();
-  }
-  Rational(unsigned long int n) : d_value(n,1) {
-    d_value.canonicalize();
-  }
+  Rational(signed int n) : Rational(Integer(n)) {}
+  Rational(unsigned int n) : Rational(Integer(n)) {}
+  Rational(signed long int n) : Rational(Integer(n)) {}
+  Rational(unsigned long int n) : Rational(Integer(n)) {}
 
 #ifdef CVC4_NEED_INT64_T_OVERLOADS
-  Rational(int64_t n) : d_value(static_cast<long>(n), 1) {
-    d_value.canonicalize();
-  }
-  Rational(uint64_t n) : d_value(static_cast<unsigned long>(n), 1) {
-    d_value.canonicalize();
-  }
+  Rational(int64_t n) : Rational(Integer(n)) {}
+  Rational(uint64_t n) : Rational(Integer(n)) {}
 #endif /* CVC4_NEED_INT64_T_OVERLOADS */
 
   /**
    * Constructs a canonical Rational from a numerator and denominator.
    */
-  Rational(signed int n, signed int d) : d_value(n,d) {
-    d_value.canonicalize();
-  }
-  Rational(unsigned int n, unsigned int d) : d_value(n,d) {
-    d_value.canonicalize();
-  }
-  Rational(signed long int n, signed long int d) : d_value(n,d) {
-    d_value.canonicalize();
-  }
-  Rational(unsigned long int n, unsigned long int d) : d_value(n,d) {
-    d_value.canonicalize();
-  }
+  Rational(signed int n, signed int d) : Rational(Integer(n), Integer(d)) {}
+  Rational(unsigned int n, unsigned int d) : Rational(Integer(n), Integer(d)) {}
+  Rational(signed long int n, signed long int d)
+    : Rational(Integer(n), Integer(d)) {}
+  Rational(unsigned long int n, unsigned long int d)
+    : Rational(Integer(n), Integer(d)) {}
 
 #ifdef CVC4_NEED_INT64_T_OVERLOADS
-  Rational(int64_t n, int64_t d) : d_value(static_cast<long>(n), static_cast<long>(d)) {
-    d_value.canonicalize();
-  }
-  Rational(uint64_t n, uint64_t d) : d_value(static_cast<unsigned long>(n), static_cast<unsigned long>(d)) {
-    d_value.canonicalize();
-  }
+  Rational(int64_t n, int64_t d) : Rational(Integer(n), Integer(d)) {}
+  Rational(uint64_t n, uint64_t d) : Rational(Integer(n), Integer(d)) {}
 #endif /* CVC4_NEED_INT64_T_OVERLOADS */
 
   Rational(const Integer& n, const Integer& d) :
-    d_value(n.get_mpz(), d.get_mpz())
+    d_num(0), d_den(1), d_big(nullptr)
   {
-    d_value.canonicalize();
+    // a zero denominator is left to GMP
+    if(n.isSmall() && d.isSmall() && d.d_small != 0){
+      setSmall(n.d_small, d.d_small);
+    }else{
+      setMpz(Integer::GmpView(n).get(), Integer::GmpView(d).get());
+    }
   }
   Rational(const Integer& n) :
-    d_value(n.get_mpz())
-  {
-    d_value.canonicalize();
-  }
-  ~Rational() {}
+    d_num(n.isSmall() ? n.d_small : 0),
+    d_den(1),
+    d_big(n.isSmall() ? nullptr : new mpq_class(*n.d_big))
+  {}
+  ~Rational() { delete d_big; }
 
   /**
-   * Returns a copy of d_value to enable public access of GMP data.
+   * Returns a copy of the value to enable public access of GMP data.
    */
   mpq_class getValue() const
   {
-    return d_value;
+    return mpq_class(GmpView(*this).get());
   }
 
   /**
@@ -178,7 +308,7 @@ public:
    * Note that this makes a deep copy of the numerator.
    */
   Integer getNumerator() const {
-    return Integer(d_value.get_num());
+    return isSmall() ? Integer(d_num) : Integer(d_big->get_num());
   }
 
   /**
@@ -186,7 +316,7 @@ public:
    * Note that this makes a deep copy of the denominator.
    */
   Integer getDenominator() const {
-    return Integer(d_value.get_den());
+    return isSmall() ? Integer(d_den) : Integer(d_big->get_den());
   }
 
   static Maybe<Rational> fromDouble(double d);
@@ -197,21 +327,43 @@ public:
    * infinity, and underflow may result in zero.
    */
   double getDouble() const {
-    return d_value.get_d();
+    if(isSmall()){
+      return d_den == 1 ? double(d_num) : double(d_num) / double(d_den);
+    }
+    return d_big->get_d();
   }
 
   Rational inverse() const {
+    if(isSmall() && d_num != 0){
+      Rational r;
+      r.d_num = d_num > 0 ? d_den : -d_den;
+      r.d_den = d_num > 0 ? d_num : -d_num;
+      return r;
+    }
     return Rational(getDenominator(), getNumerator());
   }
 
   int cmp(const Rational& x) const {
+    if(isSmall() && x.isSmall()){
+      if(d_den == x.d_den){
+        return (d_num > x.d_num) - (d_num < x.d_num);
+      }
+      long l, r;
+      if(Integer::mulSmall(d_num, x.d_den, l)
+         && Integer::mulSmall(x.d_num, d_den, r)){
+        return (l > r) - (l < r);
+      }
+    }
     //Don't use mpq_class's cmp() function.
     //The name ends up conflicting with this function.
-    return mpq_cmp(d_value.get_mpq_t(), x.d_value.get_mpq_t());
+    return mpq_cmp(GmpView(*this).get(), GmpView(x).get());
   }
 
   int sgn() const {
-    return mpq_sgn(d_value.get_mpq_t());
+    if(isSmall()){
+      return (d_num > 0) - (d_num < 0);
+    }
+    return mpq_sgn(d_big->get_mpq_t());
   }
 
   bool isZero() const {
@@ -219,11 +371,11 @@ public:
   }
 
   bool isOne() const {
-    return mpq_cmp_si(d_value.get_mpq_t(), 1, 1) == 0;
+    return isSmall() && d_num == 1 && d_den == 1;
   }
 
   bool isNegativeOne() const {
-    return mpq_cmp_si(d_value.get_mpq_t(), -1, 1) == 0;
+    return isSmall() && d_num == -1 && d_den == 1;
   }
 
   Rational abs() const {
@@ -235,14 +387,20 @@ public:
   }
 
   Integer floor() const {
+    if(isSmall()){
+      return Integer(d_num).floorDivideQuotient(Integer(d_den));
+    }
     mpz_class q;
-    mpz_fdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
+    mpz_fdiv_q(q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
     return Integer(q);
   }
 
   Integer ceiling() const {
+    if(isSmall()){
+      return Integer(d_num).ceilingDivideQuotient(Integer(d_den));
+    }
     mpz_class q;
-    mpz_cdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
+    mpz_cdiv_q(q.get_mpz_t(), d_big->get_num_mpz_t(), d_big->get_den_mpz_t());
     return Integer(q);
   }
 
@@ -252,78 +410,151 @@ public:
 
   Rational& operator=(const Rational& x){
     if(this == &x) return *this;
-    d_value = x.d_value;
+    if(x.isSmall()){
+      delete d_big;
+      d_big = nullptr;
+      d_num = x.d_num;
+      d_den = x.d_den;
+    }else if(isSmall()){
+      d_big = new mpq_class(*x.d_big);
+    }else{
+      *d_big = *x.d_big;
+    }
+    return *this;
+  }
+
+  Rational& operator=(Rational&& x){
+    std::swap(d_num, x.d_num);
+    std::swap(d_den, x.d_den);
+    std::swap(d_big, x.d_big);
     return *this;
   }
 
   Rational operator-() const{
-    return Rational(-(d_value));
+    if(isSmall()){
+      Rational r;
+      r.d_num = -d_num;
+      r.d_den = d_den;
+      return r;
+    }
+    return Rational(new mpq_class(-*d_big));
   }
 
   bool operator==(const Rational& y) const {
-    return d_value == y.d_value;
+    if(isSmall() || y.isSmall()){
+      return d_big == y.d_big && d_num == y.d_num && d_den == y.d_den;
+    }
+    return *d_big == *y.d_big;
   }
 
   bool operator!=(const Rational& y) const {
-    return d_value != y.d_value;
+    return !(*this == y);
   }
 
   bool operator< (const Rational& y) const {
-    return d_value < y.d_value;
+    return cmp(y) < 0;
   }
 
   bool operator<=(const Rational& y) const {
-    return d_value <= y.d_value;
+    return cmp(y) <= 0;
   }
 
   bool operator> (const Rational& y) const {
-    return d_value > y.d_value;
+    return cmp(y) > 0;
   }
 
   bool operator>=(const Rational& y) const {
-    return d_value >= y.d_value;
+    return cmp(y) >= 0;
   }
 
   Rational operator+(const Rational& y) const{
-    return Rational( d_value + y.d_value );
+    Rational r;
+    if(isSmall() && y.isSmall()
+       && addSmall(d_num, d_den, y.d_num, y.d_den, 1, r)){
+      return r;
+    }
+    mpq_class* result = new mpq_class;
+    mpq_add(result->get_mpq_t(), GmpView(*this).get(), GmpView(y).get());
+    return Rational(result);
   }
   Rational operator-(const Rational& y) const {
-    return Rational( d_value - y.d_value );
+    Rational r;
+    if(isSmall() && y.isSmall()
+       && addSmall(d_num, d_den, y.d_num, y.d_den, -1, r)){
+      return r;
+    }
+    mpq_class* result = new mpq_class;
+    mpq_sub(result->get_mpq_t(), GmpView(*this).get(), GmpView(y).get());
+    return Rational(result);
   }
 
   Rational operator*(const Rational& y) const {
-    return Rational( d_value * y.d_value );
+    Rational r;
+    if(isSmall() && y.isSmall()
+       && mulSmall(d_num, d_den, y.d_num, y.d_den, r)){
+      return r;
+    }
+    mpq_class* result = new mpq_class;
+    mpq_mul(result->get_mpq_t(), GmpView(*this).get(), GmpView(y).get());
+    return Rational(result);
   }
   Rational operator/(const Rational& y) const {
-    return Rational( d_value / y.d_value );
+    Rational r;
+    // a zero divisor is left to GMP
+    if(isSmall() && y.isSmall() && y.d_num != 0
+       && mulSmall(d_num, d_den, y.d_den, y.d_num, r)){
+      if(r.d_den < 0){
+        r.d_num = -r.d_num;
+        r.d_den = -r.d_den;
+      }
+      return r;
+    }
+    mpq_class* result = new mpq_class;
+    mpq_div(result->get_mpq_t(), GmpView(*this).get(), GmpView(y).get());
+    return Rational(result);
   }
 
   Rational& operator+=(const Rational& y){
-    d_value += y.d_value;
-    return (*this);
+    if(isSmall() && y.isSmall()
+       && addSmall(d_num, d_den, y.d_num, y.d_den, 1, *this)){
+      return *this;
+    }
+    return *this = *this + y;
   }
   Rational& operator-=(const Rational& y){
-    d_value -= y.d_value;
-    return (*this);
+    if(isSmall() && y.isSmall()
+       && addSmall(d_num, d_den, y.d_num, y.d_den, -1, *this)){
+      return *this;
+    }
+    return *this = *this - y;
   }
 
   Rational& operator*=(const Rational& y){
-    d_value *= y.d_value;
-    return (*this);
+    if(isSmall() && y.isSmall()
+       && mulSmall(d_num, d_den, y.d_num, y.d_den, *this)){
+      return *this;
+    }
+    return *this = *this * y;
   }
 
   Rational& operator/=(const Rational& y){
-    d_value /= y.d_value;
-    return (*this);
+    return *this = *this / y;
   }
 
   bool isIntegral() const{
-    return getDenominator() == 1;
+    if(isSmall()){
+      return d_den == 1;
+    }
+    return mpz_cmp_ui(d_big->get_den_mpz_t(), 1) == 0;
   }
 
   /** Returns a string representing the rational in the given base. */
   std::string toString(int base = 10) const {
-    return d_value.get_str(base);
+    if(isSmall() && base == 10){
+      return d_den == 1 ? std::to_string(d_num)
+                        : std::to_string(d_num) + "/" + std::to_string(d_den);
+    }
+    return getValue().get_str(base);
   }
 
   /**
@@ -331,8 +562,14 @@ public:
    * denominator.
    */
   size_t hash() const {
-    size_t numeratorHash = gmpz_hash(d_value.get_num_mpz_t());
-    size_t denominatorHash = gmpz_hash(d_value.get_den_mpz_t());
+    if(isSmall()){
+      // what gmpz_hash() computes for the single limbs of the values
+      size_t numeratorHash = d_num < 0 ? -d_num : d_num;
+      size_t denominatorHash = d_den;
+      return numeratorHash xor denominatorHash;
+    }
+    size_t numeratorHash = gmpz_hash(d_big->get_num_mpz_t());
+    size_t denominatorHash = gmpz_hash(d_big->get_den_mpz_t());
 
     return numeratorHash xor denominatorHash;
   }
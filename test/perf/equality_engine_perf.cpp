@@ -0,0 +1,129 @@
+/*********************                                                        */
+/*! \file equality_engine_perf.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Dejan Jovanovic, Morgan Deters
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Merge, backtrack and explain throughput of the equality engine
+ **
+ ** Registers the terms f^d(a_i) for i < n, d <= depth in QF_UF, then
+ ** repeatedly merges a_0 = ... = a_n-1 in a push scope and pops it again.
+ ** Each merge of the chain causes depth congruence merges, all of which are
+ ** undone by the pop.  The explain phase adds a disequality between the two
+ ** ends of the deepest row, so that every check ends in a conflict whose
+ ** explanation walks the whole proof forest.
+ **
+ ** Usage: equality_engine_perf [n] [depth] [rounds]
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "smt/smt_engine.h"
+
+using namespace std;
+using namespace CVC4;
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+double seconds(Clock::time_point since)
+{
+  return chrono::duration<double>(Clock::now() - since).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  unsigned n = argc > 1 ? atoi(argv[1]) : 200;
+  unsigned depth = argc > 2 ? atoi(argv[2]) : 20;
+  unsigned rounds = argc > 3 ? atoi(argv[3]) : 200;
+
+  ExprManager em;
+  SmtEngine smt(&em);
+  smt.setOption("incremental", SExpr(true));
+  // keep the equalities away from the preprocessor's substitutions
+  smt.setOption("simplification", SExpr("none"));
+  smt.setLogic("QF_UF");
+
+  Type u = em.mkSort("U");
+  Expr f = em.mkVar("f", em.mkFunctionType(u, u));
+  Expr p = em.mkVar("p", em.mkPredicateType(vector<Type>(1, u)));
+
+  // terms[d][i] is f^d(a_i)
+  vector<vector<Expr> > terms(depth + 1);
+  for (unsigned i = 0; i < n; ++i)
+  {
+    terms[0].push_back(em.mkVar(u));
+  }
+  for (unsigned d = 1; d <= depth; ++d)
+  {
+    for (const Expr& t : terms[d - 1])
+    {
+      terms[d].push_back(em.mkExpr(kind::APPLY_UF, f, t));
+    }
+  }
+  vector<Expr> registered;
+  for (unsigned i = 0; i < n; ++i)
+  {
+    registered.push_back(em.mkExpr(kind::APPLY_UF, p, terms[depth][i]));
+  }
+  smt.assertFormula(em.mkExpr(kind::AND, registered));
+  smt.checkSat();
+
+  vector<Expr> chain;
+  for (unsigned i = 0; i + 1 < n; ++i)
+  {
+    chain.push_back(em.mkExpr(kind::EQUAL, terms[0][i], terms[0][i + 1]));
+  }
+  Expr merges = em.mkExpr(kind::AND, chain);
+  Expr conflict = em.mkExpr(
+      kind::NOT,
+      em.mkExpr(kind::EQUAL, terms[depth][0], terms[depth][n - 1]));
+
+  Clock::time_point t = Clock::now();
+  for (unsigned r = 0; r < rounds; ++r)
+  {
+    smt.push();
+    smt.assertFormula(merges);
+    if (smt.checkSat().isSat() != Result::SAT)
+    {
+      cerr << "equality_engine_perf: expected sat" << endl;
+      return 1;
+    }
+    smt.pop();
+  }
+  double mergeTime = seconds(t);
+
+  t = Clock::now();
+  for (unsigned r = 0; r < rounds; ++r)
+  {
+    smt.push();
+    smt.assertFormula(merges);
+    smt.assertFormula(conflict);
+    if (smt.checkSat().isSat() != Result::UNSAT)
+    {
+      cerr << "equality_engine_perf: expected unsat" << endl;
+      return 1;
+    }
+    smt.pop();
+  }
+  double explainTime = seconds(t);
+
+  double perRound = double(n - 1) * (depth + 1);
+  cout << "merges per round:  " << perRound << endl;
+  cout << "merge/backtrack:   " << perRound * rounds / mergeTime
+       << " merges/s" << endl;
+  cout << "merge/explain:     " << perRound * rounds / explainTime
+       << " merges/s" << endl;
+  return 0;
+}
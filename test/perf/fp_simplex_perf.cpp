@@ -0,0 +1,174 @@
+/*********************                                                        */
+/*! \file fp_simplex_perf.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Pivot throughput and memory of the simplex variants in QF_LRA
+ **
+ ** Solves random sparse systems of m inequalities over n bounded variables
+ ** in one of three modes:
+ **   exact  the exact simplex only (the default configuration)
+ **   fp     --fp-simplex, with the floating-point tableau in row form
+ **   fp-lu  --fp-simplex --fp-simplex-lu, with an LU-factored basis
+ ** Every other instance is made infeasible by requiring the sum of its rows
+ ** to exceed the sum of their bounds, which the exact simplex has to refute.  Run one mode per process so
+ ** that the reported peak memory belongs to that mode.  The floating-point
+ ** representation of the basis, the rows and in LU mode also the factors, is
+ ** reported separately as its largest number of nonzeros.
+ **
+ ** Usage: fp_simplex_perf exact|fp|fp-lu [m] [n] [instances]
+ **/
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "smt/smt_engine.h"
+
+using namespace std;
+using namespace CVC4;
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+/** The number of nonzero coefficients per row. */
+const unsigned s_rowSize = 8;
+
+/** Returns the value of the integer statistic name, or 0 if it is unset. */
+double statistic(SmtEngine& smt, const string& name)
+{
+  SExpr value = smt.getStatistic(name);
+  return value.isAtom() ? atof(value.getValue().c_str()) : 0;
+}
+
+/** Asserts a random system satisfied by a planted point; see above. */
+bool assertSystem(ExprManager& em,
+                  SmtEngine& smt,
+                  unsigned m,
+                  unsigned n,
+                  bool feasible,
+                  mt19937& rng)
+{
+  uniform_int_distribution<int> coeff(-9, 9), point(-50, 50), slack(0, 20);
+  uniform_int_distribution<unsigned> var(0, n - 1);
+  vector<Expr> x;
+  vector<int> planted;
+  for (unsigned j = 0; j < n; ++j)
+  {
+    x.push_back(em.mkVar(em.realType()));
+    planted.push_back(point(rng));
+    smt.assertFormula(em.mkExpr(kind::LEQ, x[j], em.mkConst(Rational(100))));
+    smt.assertFormula(em.mkExpr(kind::GEQ, x[j], em.mkConst(Rational(-100))));
+  }
+  vector<Expr> sumTerms;
+  long sumBound = 0;
+  for (unsigned i = 0; i < m; ++i)
+  {
+    vector<Expr> terms;
+    long value = 0;
+    for (unsigned k = 0; k < s_rowSize; ++k)
+    {
+      int c = coeff(rng);
+      unsigned j = var(rng);
+      if (c == 0)
+      {
+        continue;
+      }
+      terms.push_back(em.mkExpr(kind::MULT, em.mkConst(Rational(c)), x[j]));
+      value += long(c) * planted[j];
+    }
+    if (terms.size() < 2)
+    {
+      continue;
+    }
+    Expr row = em.mkExpr(kind::PLUS, terms);
+    long bound = value + slack(rng);
+    smt.assertFormula(em.mkExpr(kind::LEQ, row, em.mkConst(Rational(bound))));
+    sumTerms.push_back(row);
+    sumBound += bound;
+  }
+  if (!feasible)
+  {
+    Expr sum = em.mkExpr(kind::PLUS, sumTerms);
+    smt.assertFormula(
+        em.mkExpr(kind::GEQ, sum, em.mkConst(Rational(sumBound + 1))));
+  }
+  return feasible;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  string mode = argc > 1 ? argv[1] : "exact";
+  unsigned m = argc > 2 ? atoi(argv[2]) : 60;
+  unsigned n = argc > 3 ? atoi(argv[3]) : 30;
+  unsigned instances = argc > 4 ? atoi(argv[4]) : 10;
+  if (mode != "exact" && mode != "fp" && mode != "fp-lu")
+  {
+    cerr << "usage: fp_simplex_perf exact|fp|fp-lu [m] [n] [instances]"
+         << endl;
+    return 2;
+  }
+
+  mt19937 rng(2018);
+  double time = 0, pivots = 0, fpPivots = 0, refactorizations = 0;
+  double fpFeasible = 0, fpRepaired = 0, nonzeros = 0;
+  for (unsigned k = 0; k < instances; ++k)
+  {
+    ExprManager em;
+    SmtEngine smt(&em);
+    if (mode != "exact")
+    {
+      smt.setOption("fp-simplex", SExpr(true));
+      smt.setOption("fp-simplex-lu", SExpr(mode == "fp-lu"));
+    }
+    smt.setLogic("QF_LRA");
+    bool feasible = assertSystem(em, smt, m, n, k % 2 == 0, rng);
+
+    Clock::time_point t = Clock::now();
+    Result r = smt.checkSat();
+    time += chrono::duration<double>(Clock::now() - t).count();
+    if (r.isSat() != (feasible ? Result::SAT : Result::UNSAT))
+    {
+      cerr << "fp_simplex_perf: wrong result " << r << " on instance " << k
+           << endl;
+      return 1;
+    }
+    pivots += statistic(smt, "theory::arith::pivots");
+    fpPivots += statistic(smt, "theory::arith::fpSimplex::pivots");
+    refactorizations +=
+        statistic(smt, "theory::arith::fpSimplex::refactorizations");
+    fpFeasible += statistic(smt, "theory::arith::fpSimplex::feasible");
+    fpRepaired += statistic(smt, "theory::arith::fpSimplex::repaired");
+    nonzeros = max(nonzeros,
+                   statistic(smt, "theory::arith::fpSimplex::maxNonzeros"));
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  cout << "mode:              " << mode << endl;
+  cout << "solve time:        " << time << " s" << endl;
+  cout << "exact pivots:      " << pivots << endl;
+  cout << "fp pivots:         " << fpPivots << endl;
+  cout << "pivots per second: " << (pivots + fpPivots) / time << endl;
+  cout << "refactorizations:  " << refactorizations << endl;
+  cout << "fp feasible:       " << fpFeasible << endl;
+  cout << "fp repaired:       " << fpRepaired << endl;
+  cout << "fp nonzeros (max): " << nonzeros << endl;
+  cout << "peak memory:       " << usage.ru_maxrss / 1024 << " MB" << endl;
+  return 0;
+}
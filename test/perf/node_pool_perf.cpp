@@ -0,0 +1,100 @@
+/*********************                                                        */
+/*! \file node_pool_perf.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Morgan Deters, Tim King
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Single-threaded throughput of the NodeManager node pool
+ **
+ ** Builds a grid of distinct terms (pool misses), rebuilds the same terms
+ ** (pool hits), and releases them all so that they become zombies and are
+ ** reclaimed.  Each phase is reported in nodes per second.
+ **
+ ** Usage: node_pool_perf [vars] [rounds]
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "expr/expr_manager.h"
+
+using namespace std;
+using namespace CVC4;
+
+namespace {
+
+typedef chrono::steady_clock Clock;
+
+double seconds(Clock::time_point since)
+{
+  return chrono::duration<double>(Clock::now() - since).count();
+}
+
+/** Builds (+ x_i (* x_j c)) for all i, j; c keeps each round distinct. */
+void buildGrid(ExprManager& em,
+               const vector<Expr>& vars,
+               const Expr& c,
+               vector<Expr>& out)
+{
+  for (const Expr& xi : vars)
+  {
+    for (const Expr& xj : vars)
+    {
+      out.push_back(em.mkExpr(kind::PLUS, xi, em.mkExpr(kind::MULT, xj, c)));
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  unsigned numVars = argc > 1 ? atoi(argv[1]) : 300;
+  unsigned rounds = argc > 2 ? atoi(argv[2]) : 10;
+
+  ExprManager em;
+  vector<Expr> vars;
+  for (unsigned i = 0; i < numVars; ++i)
+  {
+    vars.push_back(em.mkVar(em.realType()));
+  }
+
+  // every term in the grid is two nodes, the MULT and the PLUS
+  double nodes = 2.0 * numVars * numVars * rounds;
+  double build = 0, rebuild = 0, drop = 0;
+  for (unsigned r = 0; r < rounds; ++r)
+  {
+    Expr c = em.mkConst(Rational(r + 2));
+    vector<Expr> grid, again;
+    grid.reserve(numVars * numVars);
+    again.reserve(numVars * numVars);
+
+    Clock::time_point t = Clock::now();
+    buildGrid(em, vars, c, grid);
+    build += seconds(t);
+
+    t = Clock::now();
+    buildGrid(em, vars, c, again);
+    rebuild += seconds(t);
+
+    // releasing the last reference makes a zombie; the NodeManager reclaims
+    // them while they are marked, once there are enough of them
+    t = Clock::now();
+    grid.clear();
+    again.clear();
+    drop += seconds(t);
+  }
+
+  cout << "nodes per phase: " << nodes << endl;
+  cout << "build (miss):    " << nodes / build << " nodes/s" << endl;
+  cout << "rebuild (hit):   " << nodes / rebuild << " nodes/s" << endl;
+  cout << "release:         " << nodes / drop << " nodes/s" << endl;
+  return 0;
+}
@@ -0,0 +1,15 @@
+; COMMAND-LINE: --fp-simplex
+; COMMAND-LINE: --fp-simplex --fp-simplex-lu
+; EXPECT: unsat
+(set-logic QF_LRA)
+(set-info :status unsat)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+; x + y + z >= 1 and 3x + 3y + 3z <= 3 - 1/10^12 are infeasible, but only
+; by a margin that is below the tolerance of a double
+(assert (>= (+ x y z) 1))
+(assert (<= (+ (* 3 x) (* 3 y) (* 3 z)) (- 3 (/ 1 1000000000000))))
+(assert (>= (- x y) (/ 1 3)))
+(assert (<= (- z y) (/ 2 3)))
+(check-sat)
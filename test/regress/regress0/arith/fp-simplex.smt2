@@ -0,0 +1,16 @@
+; COMMAND-LINE: --fp-simplex --check-models
+; COMMAND-LINE: --fp-simplex --fp-simplex-lu --check-models
+; EXPECT: sat
+(set-logic QF_LRA)
+(set-info :status sat)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(declare-fun w () Real)
+(assert (>= (+ (* 3 x) (* 2 y) (- z)) (/ 1 3)))
+(assert (<= (+ x y z w) 10))
+(assert (>= (- (* 7 y) (* 5 w)) (/ 2 7)))
+(assert (<= (+ (* 2 x) (- y) (* 3 w)) (- 3)))
+(assert (>= (+ z (* 11 w)) (- (- 8) (/ 1 10000000000))))
+(assert (or (>= (+ x z) 3) (<= (- y w) (- 20))))
+(check-sat)
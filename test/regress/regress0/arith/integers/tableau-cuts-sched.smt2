@@ -0,0 +1,20 @@
+; COMMAND-LINE: --tableau-cuts
+; EXPECT: sat
+(set-logic QF_LIA)
+(set-info :status sat)
+(declare-fun s1 () Int)
+(declare-fun s2 () Int)
+(declare-fun s3 () Int)
+(declare-fun end () Int)
+(assert (>= s1 0))
+(assert (>= s2 0))
+(assert (>= s3 0))
+(assert (>= end (+ s1 3)))
+(assert (>= end (+ s2 5)))
+(assert (>= end (+ s3 2)))
+(assert (or (<= (+ s1 3) s2) (<= (+ s2 5) s1)))
+(assert (or (<= (+ s1 3) s3) (<= (+ s3 2) s1)))
+(assert (or (<= (+ s2 5) s3) (<= (+ s3 2) s2)))
+(assert (<= (+ (* 2 s1) (* 3 s2) s3) 25))
+(assert (<= end 10))
+(check-sat)
@@ -0,0 +1,13 @@
+; COMMAND-LINE: --tableau-cuts
+; COMMAND-LINE: --tableau-cuts --no-dio-solver
+; EXPECT: unsat
+(set-logic QF_LIA)
+(set-info :status unsat)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (<= 0 x 20))
+(assert (<= 0 y 20))
+(assert (<= 0 z 20))
+(assert (= (+ (* 4 x) (* 6 y)) (+ (* 10 z) 3)))
+(check-sat)
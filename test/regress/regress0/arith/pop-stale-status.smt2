@@ -0,0 +1,19 @@
+; COMMAND-LINE: --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: ((x (/ 6 1)))
+(set-logic QF_LRA)
+(set-option :produce-models true)
+(declare-fun x () Real)
+(assert (>= x 6.0))
+(assert (<= x 6.0))
+(check-sat)
+(push 1)
+(assert (< x 0.0))
+(check-sat)
+(pop 1)
+; no new facts reach arithmetic here, and the conflict of the popped scope
+; must not be taken for the status of this check
+(check-sat)
+(get-value (x))
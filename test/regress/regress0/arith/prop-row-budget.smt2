@@ -0,0 +1,15 @@
+; COMMAND-LINE: --prop-row-budget=1 --prop-row-limit=3
+; COMMAND-LINE: --new-prop --prop-row-budget=1 --prop-row-limit=3
+; EXPECT: unsat
+(set-logic QF_LRA)
+(set-info :status unsat)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (>= x 0))
+(assert (>= y 0))
+(assert (>= z 0))
+(assert (<= (+ x y) 2))
+(assert (<= (+ x y z) 3))
+(assert (or (> x 3) (> y 5) (and (> z 4) (< (+ x z) 10))))
+(check-sat)
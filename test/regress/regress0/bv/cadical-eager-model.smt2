@@ -0,0 +1,14 @@
+; REQUIRES: cadical
+; COMMAND-LINE: --bitblast=eager --bv-sat-solver=cadical
+; EXPECT: sat
+; EXPECT: ((x (_ bv6 8)) (y (_ bv9 8)))
+(set-option :produce-models true)
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+; the model values are read back through CaDiCaL's val()
+(assert (= (bvadd x y) #b00001111))
+(assert (= (bvmul x #b00000011) #b00010010))
+(assert (bvult x y))
+(check-sat)
+(get-value (x y))
@@ -0,0 +1,9 @@
+; REQUIRES: cadical
+; COMMAND-LINE: --bitblast=eager --bv-sat-solver=cadical
+; EXPECT: unsat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 16))
+(declare-fun y () (_ BitVec 16))
+(assert (= (bvmul x y) #x0001))
+(assert (= ((_ extract 0 0) x) #b0))
+(check-sat)
@@ -0,0 +1,12 @@
+; COMMAND-LINE: --bitblast=eager --bv-eager-threads=4
+; EXPECT: sat
+; EXPECT: ((x (_ bv11 8)) (y (_ bv49 8)))
+(set-option :produce-models true)
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+; the model comes from whichever solver finished first
+(assert (= (bvmul x #x05) #x37))
+(assert (= (bvxor x y) #x3a))
+(check-sat)
+(get-value (x y))
@@ -0,0 +1,11 @@
+; COMMAND-LINE: --bitblast=eager --bv-eager-threads=4 --bv-eager-share-size=4
+; EXPECT: unsat
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 12))
+(declare-fun y () (_ BitVec 12))
+(declare-fun z () (_ BitVec 12))
+; an even x has no inverse
+(assert (= (bvmul x y) (bvadd z #x001)))
+(assert (= (bvand z #x801) #x000))
+(assert (= ((_ extract 0 0) x) #b0))
+(check-sat)
@@ -0,0 +1,23 @@
+; COMMAND-LINE: --incremental --model-lazy --check-models
+; EXPECT: sat
+; EXPECT: (((f 2) 3) (x 2))
+; EXPECT: sat
+; EXPECT: (((f 3) 4) (x 3))
+(set-info :smt-lib-version 2.0)
+(set-option :produce-models true)
+(set-logic QF_UFLIA)
+
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+; the value of x is only fixed by the decisions of the search
+(assert (or (= x 1) (= x 2) (= x 3)))
+(assert (or (= x 2) (= x 3) (= x 4)))
+(assert (= (f x) (+ x 1)))
+(push)
+(assert (not (= x 3)))
+(check-sat)
+(get-value ((f 2) x))
+(pop)
+(assert (not (= x 2)))
+(check-sat)
+(get-value ((f 3) x))
@@ -0,0 +1,34 @@
+; COMMAND-LINE: --incremental --model-lazy
+; EXPECT: sat
+; EXPECT: (((= a d) false))
+; EXPECT: (((= (g a) q) false) ((= (g c) p) true))
+; EXPECT: sat
+; EXPECT: (((= (g a) q) true) ((= a d) false))
+(set-info :smt-lib-version 2.0)
+(set-option :produce-models true)
+(set-logic QF_UF)
+
+(declare-sort U 0)
+(declare-sort V 0)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(declare-fun d () U)
+(declare-fun g (U) V)
+(declare-fun p () V)
+(declare-fun q () V)
+(assert (distinct a b c))
+(assert (not (= d c)))
+(assert (not (= (g a) (g b))))
+(assert (= (g c) p))
+(assert (not (= p q)))
+(check-sat)
+; the classes of U get their values here, those of V only on the next
+; query, which must not give two classes of V the same value
+(get-value ((= a d)))
+(get-value ((= (g a) q) (= (g c) p)))
+(push)
+(assert (= (g a) q))
+(check-sat)
+(get-value ((= (g a) q) (= a d)))
+(pop)
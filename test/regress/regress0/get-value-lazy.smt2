@@ -0,0 +1,26 @@
+; COMMAND-LINE: --incremental --model-lazy
+; EXPECT: sat
+; EXPECT: (((f 2) 3))
+; EXPECT: sat
+; EXPECT: (((f 1) 4) ((f 0) 1))
+; EXPECT: sat
+; EXPECT: ((x 2))
+(set-info :smt-lib-version 2.0)
+(set-option :produce-models true)
+(set-logic QF_UFLIA)
+
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+(assert (= (f 0) 1))
+(assert (= x 2))
+(assert (= (f x) 3))
+(check-sat)
+; (f 2) is not a term of the problem, its value needs the model of f
+(get-value ((f 2)))
+(push)
+(assert (= (f 1) 4))
+(check-sat)
+(get-value ((f 1) (f 0)))
+(pop)
+(check-sat)
+(get-value (x))
@@ -0,0 +1,27 @@
+; REQUIRES: portfolio
+; COMMAND-LINE: --incremental --threads=2 --cube-and-conquer --cube-depth=2
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun p () Bool)
+(declare-fun q () Bool)
+(declare-fun r () Bool)
+(assert (or p (> x 3)))
+(assert (or q (< y 2)))
+(assert (or (not p) (not q) (= (+ x y) 5)))
+(assert (or r (> (+ x y) 10)))
+(check-sat)
+; the thread that lost the first query was interrupted, which must not
+; make it drop the cubes of this one
+(push 1)
+(assert (not p))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (not r))
+(assert (< x 0))
+(check-sat)
+(pop 1)
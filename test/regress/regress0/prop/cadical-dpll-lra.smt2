@@ -0,0 +1,16 @@
+; REQUIRES: cadical-propagator
+; COMMAND-LINE: --sat-cadical
+; EXPECT: unsat
+(set-logic QF_LRA)
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(assert (or (< x 0.0) (> x 10.0)))
+(assert (or (< y 0.0) (> y 10.0)))
+(assert (or (< z 0.0) (> z 10.0)))
+(assert (= (+ x y z) 5.0))
+(assert (or (and (>= x 0.0) (>= y 0.0)) (and (>= y 0.0) (>= z 0.0)) (and (>= x 0.0) (>= z 0.0))))
+(assert (<= (+ x y) 20.0))
+(assert (<= (+ y z) 20.0))
+(assert (<= (+ x z) 20.0))
+(check-sat)
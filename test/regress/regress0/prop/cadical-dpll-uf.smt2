@@ -0,0 +1,26 @@
+; REQUIRES: cadical-propagator
+; COMMAND-LINE: --sat-cadical --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-fun a () U)
+(declare-fun b () U)
+(declare-fun c () U)
+(declare-fun f (U) U)
+(declare-fun p (U) Bool)
+(assert (or (= a b) (= a c)))
+(assert (or (p (f a)) (p (f c))))
+(check-sat)
+(push 1)
+; each disjunct of the first assertion now conflicts
+(assert (not (p (f b))))
+(assert (not (p (f c))))
+(assert (=> (= a b) (p (f b))))
+(check-sat)
+(pop 1)
+(check-sat)
+(assert (distinct a b c))
+(check-sat)
@@ -0,0 +1,387 @@
+; COMMAND-LINE: --sat-lbd-tiers --sat-ema-restarts --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; learnt clauses from the unsat scopes must not survive their pops
+(set-logic QF_UF)
+(declare-fun p0_0 () Bool)
+(declare-fun p0_1 () Bool)
+(declare-fun p0_2 () Bool)
+(declare-fun p0_3 () Bool)
+(declare-fun p0_4 () Bool)
+(declare-fun p0_5 () Bool)
+(declare-fun p0_6 () Bool)
+(declare-fun p0_7 () Bool)
+(declare-fun p1_0 () Bool)
+(declare-fun p1_1 () Bool)
+(declare-fun p1_2 () Bool)
+(declare-fun p1_3 () Bool)
+(declare-fun p1_4 () Bool)
+(declare-fun p1_5 () Bool)
+(declare-fun p1_6 () Bool)
+(declare-fun p1_7 () Bool)
+(declare-fun p2_0 () Bool)
+(declare-fun p2_1 () Bool)
+(declare-fun p2_2 () Bool)
+(declare-fun p2_3 () Bool)
+(declare-fun p2_4 () Bool)
+(declare-fun p2_5 () Bool)
+(declare-fun p2_6 () Bool)
+(declare-fun p2_7 () Bool)
+(declare-fun p3_0 () Bool)
+(declare-fun p3_1 () Bool)
+(declare-fun p3_2 () Bool)
+(declare-fun p3_3 () Bool)
+(declare-fun p3_4 () Bool)
+(declare-fun p3_5 () Bool)
+(declare-fun p3_6 () Bool)
+(declare-fun p3_7 () Bool)
+(declare-fun p4_0 () Bool)
+(declare-fun p4_1 () Bool)
+(declare-fun p4_2 () Bool)
+(declare-fun p4_3 () Bool)
+(declare-fun p4_4 () Bool)
+(declare-fun p4_5 () Bool)
+(declare-fun p4_6 () Bool)
+(declare-fun p4_7 () Bool)
+(declare-fun p5_0 () Bool)
+(declare-fun p5_1 () Bool)
+(declare-fun p5_2 () Bool)
+(declare-fun p5_3 () Bool)
+(declare-fun p5_4 () Bool)
+(declare-fun p5_5 () Bool)
+(declare-fun p5_6 () Bool)
+(declare-fun p5_7 () Bool)
+(declare-fun p6_0 () Bool)
+(declare-fun p6_1 () Bool)
+(declare-fun p6_2 () Bool)
+(declare-fun p6_3 () Bool)
+(declare-fun p6_4 () Bool)
+(declare-fun p6_5 () Bool)
+(declare-fun p6_6 () Bool)
+(declare-fun p6_7 () Bool)
+(declare-fun p7_0 () Bool)
+(declare-fun p7_1 () Bool)
+(declare-fun p7_2 () Bool)
+(declare-fun p7_3 () Bool)
+(declare-fun p7_4 () Bool)
+(declare-fun p7_5 () Bool)
+(declare-fun p7_6 () Bool)
+(declare-fun p7_7 () Bool)
+(declare-fun p8_0 () Bool)
+(declare-fun p8_1 () Bool)
+(declare-fun p8_2 () Bool)
+(declare-fun p8_3 () Bool)
+(declare-fun p8_4 () Bool)
+(declare-fun p8_5 () Bool)
+(declare-fun p8_6 () Bool)
+(declare-fun p8_7 () Bool)
+(assert (or p0_0 p0_1 p0_2 p0_3 p0_4 p0_5 p0_6 p0_7))
+(assert (or p1_0 p1_1 p1_2 p1_3 p1_4 p1_5 p1_6 p1_7))
+(assert (or p2_0 p2_1 p2_2 p2_3 p2_4 p2_5 p2_6 p2_7))
+(assert (or p3_0 p3_1 p3_2 p3_3 p3_4 p3_5 p3_6 p3_7))
+(assert (or p4_0 p4_1 p4_2 p4_3 p4_4 p4_5 p4_6 p4_7))
+(assert (or p5_0 p5_1 p5_2 p5_3 p5_4 p5_5 p5_6 p5_7))
+(assert (or p6_0 p6_1 p6_2 p6_3 p6_4 p6_5 p6_6 p6_7))
+(assert (or p7_0 p7_1 p7_2 p7_3 p7_4 p7_5 p7_6 p7_7))
+(assert (or (not p0_0) (not p1_0)))
+(assert (or (not p0_0) (not p2_0)))
+(assert (or (not p0_0) (not p3_0)))
+(assert (or (not p0_0) (not p4_0)))
+(assert (or (not p0_0) (not p5_0)))
+(assert (or (not p0_0) (not p6_0)))
+(assert (or (not p0_0) (not p7_0)))
+(assert (or (not p0_0) (not p8_0)))
+(assert (or (not p1_0) (not p2_0)))
+(assert (or (not p1_0) (not p3_0)))
+(assert (or (not p1_0) (not p4_0)))
+(assert (or (not p1_0) (not p5_0)))
+(assert (or (not p1_0) (not p6_0)))
+(assert (or (not p1_0) (not p7_0)))
+(assert (or (not p1_0) (not p8_0)))
+(assert (or (not p2_0) (not p3_0)))
+(assert (or (not p2_0) (not p4_0)))
+(assert (or (not p2_0) (not p5_0)))
+(assert (or (not p2_0) (not p6_0)))
+(assert (or (not p2_0) (not p7_0)))
+(assert (or (not p2_0) (not p8_0)))
+(assert (or (not p3_0) (not p4_0)))
+(assert (or (not p3_0) (not p5_0)))
+(assert (or (not p3_0) (not p6_0)))
+(assert (or (not p3_0) (not p7_0)))
+(assert (or (not p3_0) (not p8_0)))
+(assert (or (not p4_0) (not p5_0)))
+(assert (or (not p4_0) (not p6_0)))
+(assert (or (not p4_0) (not p7_0)))
+(assert (or (not p4_0) (not p8_0)))
+(assert (or (not p5_0) (not p6_0)))
+(assert (or (not p5_0) (not p7_0)))
+(assert (or (not p5_0) (not p8_0)))
+(assert (or (not p6_0) (not p7_0)))
+(assert (or (not p6_0) (not p8_0)))
+(assert (or (not p7_0) (not p8_0)))
+(assert (or (not p0_1) (not p1_1)))
+(assert (or (not p0_1) (not p2_1)))
+(assert (or (not p0_1) (not p3_1)))
+(assert (or (not p0_1) (not p4_1)))
+(assert (or (not p0_1) (not p5_1)))
+(assert (or (not p0_1) (not p6_1)))
+(assert (or (not p0_1) (not p7_1)))
+(assert (or (not p0_1) (not p8_1)))
+(assert (or (not p1_1) (not p2_1)))
+(assert (or (not p1_1) (not p3_1)))
+(assert (or (not p1_1) (not p4_1)))
+(assert (or (not p1_1) (not p5_1)))
+(assert (or (not p1_1) (not p6_1)))
+(assert (or (not p1_1) (not p7_1)))
+(assert (or (not p1_1) (not p8_1)))
+(assert (or (not p2_1) (not p3_1)))
+(assert (or (not p2_1) (not p4_1)))
+(assert (or (not p2_1) (not p5_1)))
+(assert (or (not p2_1) (not p6_1)))
+(assert (or (not p2_1) (not p7_1)))
+(assert (or (not p2_1) (not p8_1)))
+(assert (or (not p3_1) (not p4_1)))
+(assert (or (not p3_1) (not p5_1)))
+(assert (or (not p3_1) (not p6_1)))
+(assert (or (not p3_1) (not p7_1)))
+(assert (or (not p3_1) (not p8_1)))
+(assert (or (not p4_1) (not p5_1)))
+(assert (or (not p4_1) (not p6_1)))
+(assert (or (not p4_1) (not p7_1)))
+(assert (or (not p4_1) (not p8_1)))
+(assert (or (not p5_1) (not p6_1)))
+(assert (or (not p5_1) (not p7_1)))
+(assert (or (not p5_1) (not p8_1)))
+(assert (or (not p6_1) (not p7_1)))
+(assert (or (not p6_1) (not p8_1)))
+(assert (or (not p7_1) (not p8_1)))
+(assert (or (not p0_2) (not p1_2)))
+(assert (or (not p0_2) (not p2_2)))
+(assert (or (not p0_2) (not p3_2)))
+(assert (or (not p0_2) (not p4_2)))
+(assert (or (not p0_2) (not p5_2)))
+(assert (or (not p0_2) (not p6_2)))
+(assert (or (not p0_2) (not p7_2)))
+(assert (or (not p0_2) (not p8_2)))
+(assert (or (not p1_2) (not p2_2)))
+(assert (or (not p1_2) (not p3_2)))
+(assert (or (not p1_2) (not p4_2)))
+(assert (or (not p1_2) (not p5_2)))
+(assert (or (not p1_2) (not p6_2)))
+(assert (or (not p1_2) (not p7_2)))
+(assert (or (not p1_2) (not p8_2)))
+(assert (or (not p2_2) (not p3_2)))
+(assert (or (not p2_2) (not p4_2)))
+(assert (or (not p2_2) (not p5_2)))
+(assert (or (not p2_2) (not p6_2)))
+(assert (or (not p2_2) (not p7_2)))
+(assert (or (not p2_2) (not p8_2)))
+(assert (or (not p3_2) (not p4_2)))
+(assert (or (not p3_2) (not p5_2)))
+(assert (or (not p3_2) (not p6_2)))
+(assert (or (not p3_2) (not p7_2)))
+(assert (or (not p3_2) (not p8_2)))
+(assert (or (not p4_2) (not p5_2)))
+(assert (or (not p4_2) (not p6_2)))
+(assert (or (not p4_2) (not p7_2)))
+(assert (or (not p4_2) (not p8_2)))
+(assert (or (not p5_2) (not p6_2)))
+(assert (or (not p5_2) (not p7_2)))
+(assert (or (not p5_2) (not p8_2)))
+(assert (or (not p6_2) (not p7_2)))
+(assert (or (not p6_2) (not p8_2)))
+(assert (or (not p7_2) (not p8_2)))
+(assert (or (not p0_3) (not p1_3)))
+(assert (or (not p0_3) (not p2_3)))
+(assert (or (not p0_3) (not p3_3)))
+(assert (or (not p0_3) (not p4_3)))
+(assert (or (not p0_3) (not p5_3)))
+(assert (or (not p0_3) (not p6_3)))
+(assert (or (not p0_3) (not p7_3)))
+(assert (or (not p0_3) (not p8_3)))
+(assert (or (not p1_3) (not p2_3)))
+(assert (or (not p1_3) (not p3_3)))
+(assert (or (not p1_3) (not p4_3)))
+(assert (or (not p1_3) (not p5_3)))
+(assert (or (not p1_3) (not p6_3)))
+(assert (or (not p1_3) (not p7_3)))
+(assert (or (not p1_3) (not p8_3)))
+(assert (or (not p2_3) (not p3_3)))
+(assert (or (not p2_3) (not p4_3)))
+(assert (or (not p2_3) (not p5_3)))
+(assert (or (not p2_3) (not p6_3)))
+(assert (or (not p2_3) (not p7_3)))
+(assert (or (not p2_3) (not p8_3)))
+(assert (or (not p3_3) (not p4_3)))
+(assert (or (not p3_3) (not p5_3)))
+(assert (or (not p3_3) (not p6_3)))
+(assert (or (not p3_3) (not p7_3)))
+(assert (or (not p3_3) (not p8_3)))
+(assert (or (not p4_3) (not p5_3)))
+(assert (or (not p4_3) (not p6_3)))
+(assert (or (not p4_3) (not p7_3)))
+(assert (or (not p4_3) (not p8_3)))
+(assert (or (not p5_3) (not p6_3)))
+(assert (or (not p5_3) (not p7_3)))
+(assert (or (not p5_3) (not p8_3)))
+(assert (or (not p6_3) (not p7_3)))
+(assert (or (not p6_3) (not p8_3)))
+(assert (or (not p7_3) (not p8_3)))
+(assert (or (not p0_4) (not p1_4)))
+(assert (or (not p0_4) (not p2_4)))
+(assert (or (not p0_4) (not p3_4)))
+(assert (or (not p0_4) (not p4_4)))
+(assert (or (not p0_4) (not p5_4)))
+(assert (or (not p0_4) (not p6_4)))
+(assert (or (not p0_4) (not p7_4)))
+(assert (or (not p0_4) (not p8_4)))
+(assert (or (not p1_4) (not p2_4)))
+(assert (or (not p1_4) (not p3_4)))
+(assert (or (not p1_4) (not p4_4)))
+(assert (or (not p1_4) (not p5_4)))
+(assert (or (not p1_4) (not p6_4)))
+(assert (or (not p1_4) (not p7_4)))
+(assert (or (not p1_4) (not p8_4)))
+(assert (or (not p2_4) (not p3_4)))
+(assert (or (not p2_4) (not p4_4)))
+(assert (or (not p2_4) (not p5_4)))
+(assert (or (not p2_4) (not p6_4)))
+(assert (or (not p2_4) (not p7_4)))
+(assert (or (not p2_4) (not p8_4)))
+(assert (or (not p3_4) (not p4_4)))
+(assert (or (not p3_4) (not p5_4)))
+(assert (or (not p3_4) (not p6_4)))
+(assert (or (not p3_4) (not p7_4)))
+(assert (or (not p3_4) (not p8_4)))
+(assert (or (not p4_4) (not p5_4)))
+(assert (or (not p4_4) (not p6_4)))
+(assert (or (not p4_4) (not p7_4)))
+(assert (or (not p4_4) (not p8_4)))
+(assert (or (not p5_4) (not p6_4)))
+(assert (or (not p5_4) (not p7_4)))
+(assert (or (not p5_4) (not p8_4)))
+(assert (or (not p6_4) (not p7_4)))
+(assert (or (not p6_4) (not p8_4)))
+(assert (or (not p7_4) (not p8_4)))
+(assert (or (not p0_5) (not p1_5)))
+(assert (or (not p0_5) (not p2_5)))
+(assert (or (not p0_5) (not p3_5)))
+(assert (or (not p0_5) (not p4_5)))
+(assert (or (not p0_5) (not p5_5)))
+(assert (or (not p0_5) (not p6_5)))
+(assert (or (not p0_5) (not p7_5)))
+(assert (or (not p0_5) (not p8_5)))
+(assert (or (not p1_5) (not p2_5)))
+(assert (or (not p1_5) (not p3_5)))
+(assert (or (not p1_5) (not p4_5)))
+(assert (or (not p1_5) (not p5_5)))
+(assert (or (not p1_5) (not p6_5)))
+(assert (or (not p1_5) (not p7_5)))
+(assert (or (not p1_5) (not p8_5)))
+(assert (or (not p2_5) (not p3_5)))
+(assert (or (not p2_5) (not p4_5)))
+(assert (or (not p2_5) (not p5_5)))
+(assert (or (not p2_5) (not p6_5)))
+(assert (or (not p2_5) (not p7_5)))
+(assert (or (not p2_5) (not p8_5)))
+(assert (or (not p3_5) (not p4_5)))
+(assert (or (not p3_5) (not p5_5)))
+(assert (or (not p3_5) (not p6_5)))
+(assert (or (not p3_5) (not p7_5)))
+(assert (or (not p3_5) (not p8_5)))
+(assert (or (not p4_5) (not p5_5)))
+(assert (or (not p4_5) (not p6_5)))
+(assert (or (not p4_5) (not p7_5)))
+(assert (or (not p4_5) (not p8_5)))
+(assert (or (not p5_5) (not p6_5)))
+(assert (or (not p5_5) (not p7_5)))
+(assert (or (not p5_5) (not p8_5)))
+(assert (or (not p6_5) (not p7_5)))
+(assert (or (not p6_5) (not p8_5)))
+(assert (or (not p7_5) (not p8_5)))
+(assert (or (not p0_6) (not p1_6)))
+(assert (or (not p0_6) (not p2_6)))
+(assert (or (not p0_6) (not p3_6)))
+(assert (or (not p0_6) (not p4_6)))
+(assert (or (not p0_6) (not p5_6)))
+(assert (or (not p0_6) (not p6_6)))
+(assert (or (not p0_6) (not p7_6)))
+(assert (or (not p0_6) (not p8_6)))
+(assert (or (not p1_6) (not p2_6)))
+(assert (or (not p1_6) (not p3_6)))
+(assert (or (not p1_6) (not p4_6)))
+(assert (or (not p1_6) (not p5_6)))
+(assert (or (not p1_6) (not p6_6)))
+(assert (or (not p1_6) (not p7_6)))
+(assert (or (not p1_6) (not p8_6)))
+(assert (or (not p2_6) (not p3_6)))
+(assert (or (not p2_6) (not p4_6)))
+(assert (or (not p2_6) (not p5_6)))
+(assert (or (not p2_6) (not p6_6)))
+(assert (or (not p2_6) (not p7_6)))
+(assert (or (not p2_6) (not p8_6)))
+(assert (or (not p3_6) (not p4_6)))
+(assert (or (not p3_6) (not p5_6)))
+(assert (or (not p3_6) (not p6_6)))
+(assert (or (not p3_6) (not p7_6)))
+(assert (or (not p3_6) (not p8_6)))
+(assert (or (not p4_6) (not p5_6)))
+(assert (or (not p4_6) (not p6_6)))
+(assert (or (not p4_6) (not p7_6)))
+(assert (or (not p4_6) (not p8_6)))
+(assert (or (not p5_6) (not p6_6)))
+(assert (or (not p5_6) (not p7_6)))
+(assert (or (not p5_6) (not p8_6)))
+(assert (or (not p6_6) (not p7_6)))
+(assert (or (not p6_6) (not p8_6)))
+(assert (or (not p7_6) (not p8_6)))
+(assert (or (not p0_7) (not p1_7)))
+(assert (or (not p0_7) (not p2_7)))
+(assert (or (not p0_7) (not p3_7)))
+(assert (or (not p0_7) (not p4_7)))
+(assert (or (not p0_7) (not p5_7)))
+(assert (or (not p0_7) (not p6_7)))
+(assert (or (not p0_7) (not p7_7)))
+(assert (or (not p0_7) (not p8_7)))
+(assert (or (not p1_7) (not p2_7)))
+(assert (or (not p1_7) (not p3_7)))
+(assert (or (not p1_7) (not p4_7)))
+(assert (or (not p1_7) (not p5_7)))
+(assert (or (not p1_7) (not p6_7)))
+(assert (or (not p1_7) (not p7_7)))
+(assert (or (not p1_7) (not p8_7)))
+(assert (or (not p2_7) (not p3_7)))
+(assert (or (not p2_7) (not p4_7)))
+(assert (or (not p2_7) (not p5_7)))
+(assert (or (not p2_7) (not p6_7)))
+(assert (or (not p2_7) (not p7_7)))
+(assert (or (not p2_7) (not p8_7)))
+(assert (or (not p3_7) (not p4_7)))
+(assert (or (not p3_7) (not p5_7)))
+(assert (or (not p3_7) (not p6_7)))
+(assert (or (not p3_7) (not p7_7)))
+(assert (or (not p3_7) (not p8_7)))
+(assert (or (not p4_7) (not p5_7)))
+(assert (or (not p4_7) (not p6_7)))
+(assert (or (not p4_7) (not p7_7)))
+(assert (or (not p4_7) (not p8_7)))
+(assert (or (not p5_7) (not p6_7)))
+(assert (or (not p5_7) (not p7_7)))
+(assert (or (not p5_7) (not p8_7)))
+(assert (or (not p6_7) (not p7_7)))
+(assert (or (not p6_7) (not p8_7)))
+(assert (or (not p7_7) (not p8_7)))
+(check-sat)
+(push 1)
+(assert (or p8_0 p8_1 p8_2 p8_3 p8_4 p8_5 p8_6 p8_7))
+(check-sat)
+(pop 1)
+(check-sat)
+(push 1)
+(assert (or p8_0 p8_1 p8_2 p8_3))
+(check-sat)
+(pop 1)
+(check-sat)
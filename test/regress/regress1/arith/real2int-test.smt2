@@ -1,4 +1,5 @@
 ; COMMAND-LINE: --solve-real-as-int
+; COMMAND-LINE: --solve-real-as-int --fp-simplex
 ; EXPECT: sat
 (set-info :smt-lib-version 2.6)
 (set-logic QF_NRA)
@@ -0,0 +1,1695 @@
+; COMMAND-LINE: --sat-inprocessing
+; EXPECT: sat
+; random 3-SAT near the threshold, satisfiable by construction
+(set-logic QF_UF)
+(declare-fun x0 () Bool)
+(declare-fun x1 () Bool)
+(declare-fun x2 () Bool)
+(declare-fun x3 () Bool)
+(declare-fun x4 () Bool)
+(declare-fun x5 () Bool)
+(declare-fun x6 () Bool)
+(declare-fun x7 () Bool)
+(declare-fun x8 () Bool)
+(declare-fun x9 () Bool)
+(declare-fun x10 () Bool)
+(declare-fun x11 () Bool)
+(declare-fun x12 () Bool)
+(declare-fun x13 () Bool)
+(declare-fun x14 () Bool)
+(declare-fun x15 () Bool)
+(declare-fun x16 () Bool)
+(declare-fun x17 () Bool)
+(declare-fun x18 () Bool)
+(declare-fun x19 () Bool)
+(declare-fun x20 () Bool)
+(declare-fun x21 () Bool)
+(declare-fun x22 () Bool)
+(declare-fun x23 () Bool)
+(declare-fun x24 () Bool)
+(declare-fun x25 () Bool)
+(declare-fun x26 () Bool)
+(declare-fun x27 () Bool)
+(declare-fun x28 () Bool)
+(declare-fun x29 () Bool)
+(declare-fun x30 () Bool)
+(declare-fun x31 () Bool)
+(declare-fun x32 () Bool)
+(declare-fun x33 () Bool)
+(declare-fun x34 () Bool)
+(declare-fun x35 () Bool)
+(declare-fun x36 () Bool)
+(declare-fun x37 () Bool)
+(declare-fun x38 () Bool)
+(declare-fun x39 () Bool)
+(declare-fun x40 () Bool)
+(declare-fun x41 () Bool)
+(declare-fun x42 () Bool)
+(declare-fun x43 () Bool)
+(declare-fun x44 () Bool)
+(declare-fun x45 () Bool)
+(declare-fun x46 () Bool)
+(declare-fun x47 () Bool)
+(declare-fun x48 () Bool)
+(declare-fun x49 () Bool)
+(declare-fun x50 () Bool)
+(declare-fun x51 () Bool)
+(declare-fun x52 () Bool)
+(declare-fun x53 () Bool)
+(declare-fun x54 () Bool)
+(declare-fun x55 () Bool)
+(declare-fun x56 () Bool)
+(declare-fun x57 () Bool)
+(declare-fun x58 () Bool)
+(declare-fun x59 () Bool)
+(declare-fun x60 () Bool)
+(declare-fun x61 () Bool)
+(declare-fun x62 () Bool)
+(declare-fun x63 () Bool)
+(declare-fun x64 () Bool)
+(declare-fun x65 () Bool)
+(declare-fun x66 () Bool)
+(declare-fun x67 () Bool)
+(declare-fun x68 () Bool)
+(declare-fun x69 () Bool)
+(declare-fun x70 () Bool)
+(declare-fun x71 () Bool)
+(declare-fun x72 () Bool)
+(declare-fun x73 () Bool)
+(declare-fun x74 () Bool)
+(declare-fun x75 () Bool)
+(declare-fun x76 () Bool)
+(declare-fun x77 () Bool)
+(declare-fun x78 () Bool)
+(declare-fun x79 () Bool)
+(declare-fun x80 () Bool)
+(declare-fun x81 () Bool)
+(declare-fun x82 () Bool)
+(declare-fun x83 () Bool)
+(declare-fun x84 () Bool)
+(declare-fun x85 () Bool)
+(declare-fun x86 () Bool)
+(declare-fun x87 () Bool)
+(declare-fun x88 () Bool)
+(declare-fun x89 () Bool)
+(declare-fun x90 () Bool)
+(declare-fun x91 () Bool)
+(declare-fun x92 () Bool)
+(declare-fun x93 () Bool)
+(declare-fun x94 () Bool)
+(declare-fun x95 () Bool)
+(declare-fun x96 () Bool)
+(declare-fun x97 () Bool)
+(declare-fun x98 () Bool)
+(declare-fun x99 () Bool)
+(declare-fun x100 () Bool)
+(declare-fun x101 () Bool)
+(declare-fun x102 () Bool)
+(declare-fun x103 () Bool)
+(declare-fun x104 () Bool)
+(declare-fun x105 () Bool)
+(declare-fun x106 () Bool)
+(declare-fun x107 () Bool)
+(declare-fun x108 () Bool)
+(declare-fun x109 () Bool)
+(declare-fun x110 () Bool)
+(declare-fun x111 () Bool)
+(declare-fun x112 () Bool)
+(declare-fun x113 () Bool)
+(declare-fun x114 () Bool)
+(declare-fun x115 () Bool)
+(declare-fun x116 () Bool)
+(declare-fun x117 () Bool)
+(declare-fun x118 () Bool)
+(declare-fun x119 () Bool)
+(declare-fun x120 () Bool)
+(declare-fun x121 () Bool)
+(declare-fun x122 () Bool)
+(declare-fun x123 () Bool)
+(declare-fun x124 () Bool)
+(declare-fun x125 () Bool)
+(declare-fun x126 () Bool)
+(declare-fun x127 () Bool)
+(declare-fun x128 () Bool)
+(declare-fun x129 () Bool)
+(declare-fun x130 () Bool)
+(declare-fun x131 () Bool)
+(declare-fun x132 () Bool)
+(declare-fun x133 () Bool)
+(declare-fun x134 () Bool)
+(declare-fun x135 () Bool)
+(declare-fun x136 () Bool)
+(declare-fun x137 () Bool)
+(declare-fun x138 () Bool)
+(declare-fun x139 () Bool)
+(declare-fun x140 () Bool)
+(declare-fun x141 () Bool)
+(declare-fun x142 () Bool)
+(declare-fun x143 () Bool)
+(declare-fun x144 () Bool)
+(declare-fun x145 () Bool)
+(declare-fun x146 () Bool)
+(declare-fun x147 () Bool)
+(declare-fun x148 () Bool)
+(declare-fun x149 () Bool)
+(declare-fun x150 () Bool)
+(declare-fun x151 () Bool)
+(declare-fun x152 () Bool)
+(declare-fun x153 () Bool)
+(declare-fun x154 () Bool)
+(declare-fun x155 () Bool)
+(declare-fun x156 () Bool)
+(declare-fun x157 () Bool)
+(declare-fun x158 () Bool)
+(declare-fun x159 () Bool)
+(declare-fun x160 () Bool)
+(declare-fun x161 () Bool)
+(declare-fun x162 () Bool)
+(declare-fun x163 () Bool)
+(declare-fun x164 () Bool)
+(declare-fun x165 () Bool)
+(declare-fun x166 () Bool)
+(declare-fun x167 () Bool)
+(declare-fun x168 () Bool)
+(declare-fun x169 () Bool)
+(declare-fun x170 () Bool)
+(declare-fun x171 () Bool)
+(declare-fun x172 () Bool)
+(declare-fun x173 () Bool)
+(declare-fun x174 () Bool)
+(declare-fun x175 () Bool)
+(declare-fun x176 () Bool)
+(declare-fun x177 () Bool)
+(declare-fun x178 () Bool)
+(declare-fun x179 () Bool)
+(declare-fun x180 () Bool)
+(declare-fun x181 () Bool)
+(declare-fun x182 () Bool)
+(declare-fun x183 () Bool)
+(declare-fun x184 () Bool)
+(declare-fun x185 () Bool)
+(declare-fun x186 () Bool)
+(declare-fun x187 () Bool)
+(declare-fun x188 () Bool)
+(declare-fun x189 () Bool)
+(declare-fun x190 () Bool)
+(declare-fun x191 () Bool)
+(declare-fun x192 () Bool)
+(declare-fun x193 () Bool)
+(declare-fun x194 () Bool)
+(declare-fun x195 () Bool)
+(declare-fun x196 () Bool)
+(declare-fun x197 () Bool)
+(declare-fun x198 () Bool)
+(declare-fun x199 () Bool)
+(declare-fun x200 () Bool)
+(declare-fun x201 () Bool)
+(declare-fun x202 () Bool)
+(declare-fun x203 () Bool)
+(declare-fun x204 () Bool)
+(declare-fun x205 () Bool)
+(declare-fun x206 () Bool)
+(declare-fun x207 () Bool)
+(declare-fun x208 () Bool)
+(declare-fun x209 () Bool)
+(declare-fun x210 () Bool)
+(declare-fun x211 () Bool)
+(declare-fun x212 () Bool)
+(declare-fun x213 () Bool)
+(declare-fun x214 () Bool)
+(declare-fun x215 () Bool)
+(declare-fun x216 () Bool)
+(declare-fun x217 () Bool)
+(declare-fun x218 () Bool)
+(declare-fun x219 () Bool)
+(declare-fun x220 () Bool)
+(declare-fun x221 () Bool)
+(declare-fun x222 () Bool)
+(declare-fun x223 () Bool)
+(declare-fun x224 () Bool)
+(declare-fun x225 () Bool)
+(declare-fun x226 () Bool)
+(declare-fun x227 () Bool)
+(declare-fun x228 () Bool)
+(declare-fun x229 () Bool)
+(declare-fun x230 () Bool)
+(declare-fun x231 () Bool)
+(declare-fun x232 () Bool)
+(declare-fun x233 () Bool)
+(declare-fun x234 () Bool)
+(declare-fun x235 () Bool)
+(declare-fun x236 () Bool)
+(declare-fun x237 () Bool)
+(declare-fun x238 () Bool)
+(declare-fun x239 () Bool)
+(declare-fun x240 () Bool)
+(declare-fun x241 () Bool)
+(declare-fun x242 () Bool)
+(declare-fun x243 () Bool)
+(declare-fun x244 () Bool)
+(declare-fun x245 () Bool)
+(declare-fun x246 () Bool)
+(declare-fun x247 () Bool)
+(declare-fun x248 () Bool)
+(declare-fun x249 () Bool)
+(declare-fun x250 () Bool)
+(declare-fun x251 () Bool)
+(declare-fun x252 () Bool)
+(declare-fun x253 () Bool)
+(declare-fun x254 () Bool)
+(declare-fun x255 () Bool)
+(declare-fun x256 () Bool)
+(declare-fun x257 () Bool)
+(declare-fun x258 () Bool)
+(declare-fun x259 () Bool)
+(declare-fun x260 () Bool)
+(declare-fun x261 () Bool)
+(declare-fun x262 () Bool)
+(declare-fun x263 () Bool)
+(declare-fun x264 () Bool)
+(declare-fun x265 () Bool)
+(declare-fun x266 () Bool)
+(declare-fun x267 () Bool)
+(declare-fun x268 () Bool)
+(declare-fun x269 () Bool)
+(declare-fun x270 () Bool)
+(declare-fun x271 () Bool)
+(declare-fun x272 () Bool)
+(declare-fun x273 () Bool)
+(declare-fun x274 () Bool)
+(declare-fun x275 () Bool)
+(declare-fun x276 () Bool)
+(declare-fun x277 () Bool)
+(declare-fun x278 () Bool)
+(declare-fun x279 () Bool)
+(declare-fun x280 () Bool)
+(declare-fun x281 () Bool)
+(declare-fun x282 () Bool)
+(declare-fun x283 () Bool)
+(declare-fun x284 () Bool)
+(declare-fun x285 () Bool)
+(declare-fun x286 () Bool)
+(declare-fun x287 () Bool)
+(declare-fun x288 () Bool)
+(declare-fun x289 () Bool)
+(declare-fun x290 () Bool)
+(declare-fun x291 () Bool)
+(declare-fun x292 () Bool)
+(declare-fun x293 () Bool)
+(declare-fun x294 () Bool)
+(declare-fun x295 () Bool)
+(declare-fun x296 () Bool)
+(declare-fun x297 () Bool)
+(declare-fun x298 () Bool)
+(declare-fun x299 () Bool)
+(declare-fun x300 () Bool)
+(declare-fun x301 () Bool)
+(declare-fun x302 () Bool)
+(declare-fun x303 () Bool)
+(declare-fun x304 () Bool)
+(declare-fun x305 () Bool)
+(declare-fun x306 () Bool)
+(declare-fun x307 () Bool)
+(declare-fun x308 () Bool)
+(declare-fun x309 () Bool)
+(declare-fun x310 () Bool)
+(declare-fun x311 () Bool)
+(declare-fun x312 () Bool)
+(declare-fun x313 () Bool)
+(declare-fun x314 () Bool)
+(declare-fun x315 () Bool)
+(declare-fun x316 () Bool)
+(declare-fun x317 () Bool)
+(declare-fun x318 () Bool)
+(declare-fun x319 () Bool)
+(assert (or (not x175) x293 (not x90)))
+(assert (or x222 (not x254) x74))
+(assert (or (not x36) x292 (not x118)))
+(assert (or x27 (not x304) (not x138)))
+(assert (or (not x211) x74 x73))
+(assert (or x49 (not x20) (not x52)))
+(assert (or x213 (not x267) (not x256)))
+(assert (or x113 x64 x12))
+(assert (or (not x224) x138 (not x151)))
+(assert (or x2 x221 x63))
+(assert (or (not x89) (not x191) (not x205)))
+(assert (or x129 (not x175) x14))
+(assert (or (not x210) (not x200) (not x262)))
+(assert (or (not x275) (not x294) x258))
+(assert (or x173 (not x67) (not x107)))
+(assert (or (not x228) (not x165) (not x73)))
+(assert (or x135 x107 x116))
+(assert (or (not x257) (not x311) x235))
+(assert (or x207 x64 x279))
+(assert (or x10 (not x43) x38))
+(assert (or x252 x180 (not x16)))
+(assert (or x209 x28 x239))
+(assert (or (not x49) (not x125) x154))
+(assert (or x253 x26 x278))
+(assert (or (not x135) (not x233) x136))
+(assert (or (not x44) (not x240) (not x305)))
+(assert (or x122 (not x203) x211))
+(assert (or (not x194) x312 x8))
+(assert (or (not x240) (not x115) x77))
+(assert (or (not x115) x79 (not x290)))
+(assert (or (not x33) (not x253) x216))
+(assert (or (not x283) (not x213) (not x146)))
+(assert (or x247 x283 x272))
+(assert (or x94 x22 (not x25)))
+(assert (or x298 (not x10) (not x62)))
+(assert (or (not x280) (not x293) x22))
+(assert (or (not x89) x197 x40))
+(assert (or x186 (not x129) x9))
+(assert (or (not x63) (not x289) (not x52)))
+(assert (or (not x308) (not x102) x217))
+(assert (or x20 (not x209) (not x55)))
+(assert (or x202 x312 x30))
+(assert (or (not x92) (not x288) x209))
+(assert (or x114 x257 x162))
+(assert (or x3 x197 (not x98)))
+(assert (or (not x156) x48 (not x192)))
+(assert (or x59 x65 (not x66)))
+(assert (or x50 x313 x106))
+(assert (or x265 x297 (not x314)))
+(assert (or (not x173) x306 x160))
+(assert (or x77 (not x55) x41))
+(assert (or x174 x161 x293))
+(assert (or x266 x210 (not x93)))
+(assert (or (not x105) x254 x137))
+(assert (or x114 x11 x102))
+(assert (or (not x244) x91 x315))
+(assert (or (not x233) (not x261) x256))
+(assert (or (not x251) x302 x72))
+(assert (or (not x193) (not x163) (not x204)))
+(assert (or x160 (not x294) (not x175)))
+(assert (or x80 (not x47) x272))
+(assert (or x14 x44 x102))
+(assert (or (not x195) x128 (not x58)))
+(assert (or (not x25) x80 (not x195)))
+(assert (or (not x2) x240 (not x207)))
+(assert (or (not x85) x241 (not x155)))
+(assert (or x0 x63 (not x122)))
+(assert (or (not x238) x66 x253))
+(assert (or x32 x231 (not x98)))
+(assert (or x54 x301 (not x230)))
+(assert (or x125 (not x58) (not x230)))
+(assert (or x69 (not x129) x290))
+(assert (or x11 (not x105) x34))
+(assert (or x305 (not x38) x309))
+(assert (or (not x232) x288 (not x290)))
+(assert (or (not x102) (not x128) x197))
+(assert (or (not x106) (not x300) x147))
+(assert (or (not x68) x44 x241))
+(assert (or x236 x15 (not x303)))
+(assert (or (not x139) (not x230) (not x220)))
+(assert (or x241 (not x81) (not x7)))
+(assert (or x76 x134 (not x183)))
+(assert (or (not x24) x148 x138))
+(assert (or (not x273) (not x234) x40))
+(assert (or (not x163) (not x232) (not x260)))
+(assert (or (not x297) x215 x34))
+(assert (or (not x312) (not x241) (not x246)))
+(assert (or x249 x148 x259))
+(assert (or (not x288) (not x247) x141))
+(assert (or x223 (not x6) x105))
+(assert (or (not x299) x38 (not x15)))
+(assert (or (not x252) (not x317) (not x309)))
+(assert (or (not x8) (not x176) x59))
+(assert (or (not x41) x261 x205))
+(assert (or x150 x164 x90))
+(assert (or (not x80) (not x264) x318))
+(assert (or x185 (not x136) x100))
+(assert (or x195 (not x307) x112))
+(assert (or (not x258) (not x215) (not x57)))
+(assert (or x102 x213 (not x154)))
+(assert (or (not x168) x284 x106))
+(assert (or (not x236) (not x165) x157))
+(assert (or x293 x158 x135))
+(assert (or x296 (not x118) x32))
+(assert (or x109 (not x269) (not x264)))
+(assert (or x130 x260 (not x290)))
+(assert (or x135 (not x36) x222))
+(assert (or x39 x148 (not x106)))
+(assert (or x170 x258 (not x53)))
+(assert (or (not x33) x30 x74))
+(assert (or x252 (not x48) (not x107)))
+(assert (or x162 (not x37) x239))
+(assert (or (not x95) x146 x74))
+(assert (or (not x138) x132 (not x125)))
+(assert (or x114 (not x110) x248))
+(assert (or x303 (not x72) (not x184)))
+(assert (or (not x115) (not x19) x46))
+(assert (or x108 (not x60) (not x167)))
+(assert (or (not x187) (not x248) x62))
+(assert (or (not x226) x208 x319))
+(assert (or x136 (not x254) x237))
+(assert (or (not x235) (not x227) (not x259)))
+(assert (or (not x219) (not x238) x79))
+(assert (or x251 x69 x46))
+(assert (or (not x17) x142 x287))
+(assert (or (not x47) (not x29) x253))
+(assert (or x93 x94 (not x200)))
+(assert (or x85 (not x235) x134))
+(assert (or x78 x34 (not x130)))
+(assert (or x202 x80 x215))
+(assert (or (not x309) x243 x81))
+(assert (or x67 (not x108) x283))
+(assert (or (not x114) (not x30) x203))
+(assert (or (not x194) x196 (not x289)))
+(assert (or (not x71) (not x24) x185))
+(assert (or x27 (not x261) (not x169)))
+(assert (or (not x13) x192 x292))
+(assert (or x298 (not x78) (not x319)))
+(assert (or (not x246) x114 x110))
+(assert (or (not x172) (not x209) (not x138)))
+(assert (or (not x43) (not x94) (not x202)))
+(assert (or (not x313) (not x281) (not x228)))
+(assert (or x56 (not x315) x165))
+(assert (or (not x67) (not x48) x231))
+(assert (or x191 (not x134) x251))
+(assert (or (not x36) x137 (not x16)))
+(assert (or x249 (not x172) x163))
+(assert (or (not x213) x44 (not x238)))
+(assert (or x48 x92 x3))
+(assert (or (not x199) x90 x285))
+(assert (or (not x267) x163 x187))
+(assert (or x213 x202 (not x70)))
+(assert (or (not x135) x235 x138))
+(assert (or (not x119) (not x276) (not x64)))
+(assert (or (not x246) x11 (not x138)))
+(assert (or x284 (not x207) (not x160)))
+(assert (or (not x61) x299 x308))
+(assert (or (not x27) x180 (not x70)))
+(assert (or x300 x173 (not x9)))
+(assert (or x106 (not x10) x313))
+(assert (or (not x205) (not x182) x76))
+(assert (or x265 (not x21) x188))
+(assert (or (not x95) x319 (not x78)))
+(assert (or (not x34) (not x194) x309))
+(assert (or (not x98) (not x311) (not x293)))
+(assert (or (not x146) (not x126) x155))
+(assert (or (not x162) (not x122) (not x116)))
+(assert (or (not x170) x152 (not x211)))
+(assert (or x135 x299 x250))
+(assert (or x118 x3 x224))
+(assert (or x260 x239 x215))
+(assert (or x227 x137 x249))
+(assert (or x106 x102 (not x260)))
+(assert (or (not x188) (not x85) (not x58)))
+(assert (or x110 x263 (not x215)))
+(assert (or (not x314) x76 x119))
+(assert (or x32 x242 x262))
+(assert (or x247 (not x43) (not x129)))
+(assert (or (not x147) x127 x58))
+(assert (or x118 x308 (not x174)))
+(assert (or x167 x0 x74))
+(assert (or (not x191) (not x28) x240))
+(assert (or x42 x161 x183))
+(assert (or (not x94) (not x168) (not x84)))
+(assert (or (not x243) x299 (not x117)))
+(assert (or (not x318) x257 x110))
+(assert (or x22 x271 x41))
+(assert (or x157 (not x39) x22))
+(assert (or (not x78) (not x98) (not x255)))
+(assert (or (not x205) (not x104) (not x216)))
+(assert (or x218 (not x20) x92))
+(assert (or (not x289) x32 x160))
+(assert (or (not x28) (not x149) (not x163)))
+(assert (or (not x115) (not x206) x60))
+(assert (or x47 (not x18) x97))
+(assert (or (not x52) (not x264) x31))
+(assert (or x0 x163 x225))
+(assert (or (not x171) (not x50) (not x140)))
+(assert (or x173 x264 x240))
+(assert (or (not x83) x28 x126))
+(assert (or x225 (not x294) x291))
+(assert (or (not x5) (not x271) (not x279)))
+(assert (or (not x143) x147 (not x29)))
+(assert (or (not x76) x56 (not x175)))
+(assert (or (not x97) x10 x135))
+(assert (or x20 (not x254) x198))
+(assert (or x70 (not x273) (not x121)))
+(assert (or x53 x24 (not x282)))
+(assert (or x17 (not x317) x156))
+(assert (or (not x125) x272 x317))
+(assert (or (not x71) (not x133) (not x214)))
+(assert (or (not x183) (not x252) (not x243)))
+(assert (or (not x110) (not x177) (not x159)))
+(assert (or (not x38) (not x195) x100))
+(assert (or (not x44) x227 x127))
+(assert (or x59 x180 (not x48)))
+(assert (or (not x177) x22 x275))
+(assert (or (not x103) x162 x35))
+(assert (or x170 x224 (not x173)))
+(assert (or (not x125) x285 (not x282)))
+(assert (or x227 x251 (not x262)))
+(assert (or (not x200) x184 (not x46)))
+(assert (or x272 (not x231) x306))
+(assert (or (not x117) (not x201) (not x189)))
+(assert (or (not x261) (not x269) (not x158)))
+(assert (or (not x283) x118 x112))
+(assert (or x217 (not x261) x207))
+(assert (or (not x77) x230 x225))
+(assert (or x207 x139 x264))
+(assert (or (not x298) (not x135) (not x107)))
+(assert (or (not x36) (not x314) x298))
+(assert (or x137 (not x236) (not x163)))
+(assert (or x145 (not x279) x46))
+(assert (or x175 x65 x153))
+(assert (or x107 (not x201) x28))
+(assert (or (not x74) (not x299) (not x160)))
+(assert (or (not x216) (not x2) (not x205)))
+(assert (or (not x37) x258 x209))
+(assert (or (not x164) x22 (not x168)))
+(assert (or (not x69) (not x230) x255))
+(assert (or (not x273) x218 x246))
+(assert (or (not x242) (not x233) (not x265)))
+(assert (or (not x182) (not x199) x202))
+(assert (or x206 (not x132) x38))
+(assert (or (not x7) x175 (not x303)))
+(assert (or (not x15) x21 (not x12)))
+(assert (or (not x277) x273 (not x278)))
+(assert (or x163 x62 (not x257)))
+(assert (or x186 (not x33) x289))
+(assert (or (not x215) (not x35) (not x12)))
+(assert (or (not x196) x202 x208))
+(assert (or x113 x39 x198))
+(assert (or x317 (not x56) x65))
+(assert (or x251 x102 (not x104)))
+(assert (or x12 (not x239) (not x95)))
+(assert (or (not x185) x44 (not x150)))
+(assert (or (not x230) (not x313) (not x158)))
+(assert (or x188 x163 x308))
+(assert (or (not x89) x75 x120))
+(assert (or (not x180) (not x219) x104))
+(assert (or (not x5) (not x90) x88))
+(assert (or (not x47) (not x259) (not x54)))
+(assert (or (not x128) x311 (not x163)))
+(assert (or x273 x252 (not x191)))
+(assert (or x129 x217 (not x69)))
+(assert (or (not x4) (not x264) x56))
+(assert (or (not x70) (not x189) (not x48)))
+(assert (or (not x175) (not x212) (not x243)))
+(assert (or x7 x41 x260))
+(assert (or (not x270) x138 (not x187)))
+(assert (or (not x65) (not x44) x171))
+(assert (or x62 (not x237) x33))
+(assert (or x81 (not x111) x238))
+(assert (or x12 x96 x97))
+(assert (or x78 x10 x301))
+(assert (or (not x235) (not x305) (not x28)))
+(assert (or x115 (not x276) (not x104)))
+(assert (or (not x59) (not x158) x170))
+(assert (or x285 (not x53) (not x151)))
+(assert (or (not x206) (not x312) (not x109)))
+(assert (or (not x128) (not x60) (not x13)))
+(assert (or x64 x144 x44))
+(assert (or x150 x279 (not x285)))
+(assert (or (not x215) (not x73) x271))
+(assert (or (not x202) x173 (not x44)))
+(assert (or x46 x51 (not x3)))
+(assert (or x58 (not x108) x149))
+(assert (or (not x294) (not x107) x145))
+(assert (or (not x277) (not x82) x237))
+(assert (or x278 x182 (not x270)))
+(assert (or (not x73) (not x245) (not x112)))
+(assert (or x252 x148 x209))
+(assert (or x269 x219 (not x207)))
+(assert (or (not x174) x32 (not x205)))
+(assert (or (not x63) x189 (not x163)))
+(assert (or (not x233) (not x247) (not x61)))
+(assert (or x234 (not x184) x199))
+(assert (or x221 x17 x311))
+(assert (or (not x60) x251 (not x2)))
+(assert (or (not x296) x285 (not x172)))
+(assert (or x122 x309 (not x242)))
+(assert (or x206 (not x55) x153))
+(assert (or (not x278) x19 (not x234)))
+(assert (or (not x124) (not x104) x106))
+(assert (or (not x10) (not x252) x287))
+(assert (or (not x314) (not x26) (not x216)))
+(assert (or x259 x216 x100))
+(assert (or (not x68) (not x204) x287))
+(assert (or x118 x185 x180))
+(assert (or x136 (not x264) (not x158)))
+(assert (or x112 (not x116) (not x59)))
+(assert (or x227 x119 x295))
+(assert (or (not x129) x80 (not x23)))
+(assert (or x91 x58 x37))
+(assert (or (not x157) x55 x29))
+(assert (or (not x190) x47 (not x95)))
+(assert (or (not x68) (not x315) (not x281)))
+(assert (or x28 x22 x158))
+(assert (or x284 (not x286) (not x161)))
+(assert (or x219 (not x100) (not x10)))
+(assert (or (not x249) x269 x177))
+(assert (or (not x193) (not x216) x194))
+(assert (or (not x283) (not x71) (not x164)))
+(assert (or (not x40) x19 x172))
+(assert (or x266 x118 x6))
+(assert (or x90 x215 x64))
+(assert (or x269 x1 x140))
+(assert (or x221 (not x104) (not x24)))
+(assert (or (not x119) (not x196) (not x294)))
+(assert (or (not x35) (not x29) (not x260)))
+(assert (or x265 x280 x29))
+(assert (or (not x167) (not x19) (not x151)))
+(assert (or x92 (not x249) (not x252)))
+(assert (or x269 (not x79) (not x301)))
+(assert (or (not x177) x42 x230))
+(assert (or (not x56) (not x292) x62))
+(assert (or x135 (not x178) x249))
+(assert (or (not x46) (not x133) x113))
+(assert (or (not x248) x235 x81))
+(assert (or (not x153) x289 (not x254)))
+(assert (or x113 (not x271) x21))
+(assert (or (not x169) (not x192) (not x300)))
+(assert (or x168 (not x319) (not x6)))
+(assert (or x182 x26 x40))
+(assert (or (not x273) (not x286) x116))
+(assert (or x87 x227 x214))
+(assert (or (not x106) x280 x270))
+(assert (or (not x96) x202 x58))
+(assert (or (not x202) x265 x247))
+(assert (or (not x157) x201 x4))
+(assert (or (not x86) x216 x279))
+(assert (or (not x169) (not x72) (not x47)))
+(assert (or x97 x157 (not x36)))
+(assert (or (not x28) (not x226) (not x24)))
+(assert (or (not x308) (not x286) x256))
+(assert (or x109 (not x243) x67))
+(assert (or (not x315) x81 (not x256)))
+(assert (or x207 x112 x102))
+(assert (or x258 (not x66) x128))
+(assert (or x252 x127 (not x124)))
+(assert (or x76 x13 (not x8)))
+(assert (or x164 (not x259) (not x319)))
+(assert (or (not x318) x204 (not x128)))
+(assert (or (not x134) x12 x299))
+(assert (or (not x239) (not x23) x5))
+(assert (or (not x308) (not x159) x244))
+(assert (or (not x265) (not x215) (not x316)))
+(assert (or x280 x1 x29))
+(assert (or x304 (not x81) (not x141)))
+(assert (or x301 x227 x11))
+(assert (or (not x185) x236 x90))
+(assert (or x56 x101 (not x63)))
+(assert (or (not x244) x72 (not x286)))
+(assert (or x201 x234 x188))
+(assert (or x228 x213 x4))
+(assert (or (not x15) (not x44) x202))
+(assert (or (not x56) x263 x166))
+(assert (or (not x163) (not x307) x25))
+(assert (or x295 x233 x159))
+(assert (or x57 x126 x89))
+(assert (or x302 x281 x6))
+(assert (or (not x133) (not x94) x253))
+(assert (or (not x301) x198 (not x180)))
+(assert (or x72 x33 (not x231)))
+(assert (or (not x100) (not x152) x117))
+(assert (or (not x26) x196 (not x133)))
+(assert (or (not x230) (not x274) x31))
+(assert (or (not x312) (not x86) (not x69)))
+(assert (or x105 (not x311) x250))
+(assert (or x232 x127 x142))
+(assert (or (not x267) (not x232) x154))
+(assert (or (not x237) (not x175) (not x193)))
+(assert (or x170 (not x75) (not x99)))
+(assert (or (not x4) (not x208) x210))
+(assert (or (not x302) x73 x40))
+(assert (or (not x309) x35 x86))
+(assert (or (not x213) x144 x295))
+(assert (or (not x299) (not x280) (not x13)))
+(assert (or x92 x291 (not x308)))
+(assert (or (not x40) x72 x201))
+(assert (or (not x311) x96 (not x53)))
+(assert (or (not x243) (not x238) (not x79)))
+(assert (or x189 x239 x294))
+(assert (or x257 (not x6) x255))
+(assert (or (not x248) x53 (not x9)))
+(assert (or (not x253) x37 x212))
+(assert (or (not x290) (not x168) x248))
+(assert (or (not x303) x127 (not x72)))
+(assert (or x211 (not x126) x143))
+(assert (or (not x234) x102 (not x160)))
+(assert (or (not x64) (not x177) x61))
+(assert (or (not x190) x304 (not x45)))
+(assert (or x33 x47 x237))
+(assert (or x222 (not x141) (not x124)))
+(assert (or x87 x258 (not x245)))
+(assert (or x253 (not x293) x110))
+(assert (or (not x91) (not x57) (not x96)))
+(assert (or x173 (not x226) x272))
+(assert (or (not x117) (not x236) (not x193)))
+(assert (or x179 x196 x219))
+(assert (or x123 x50 (not x309)))
+(assert (or x246 (not x193) x269))
+(assert (or (not x279) (not x54) x115))
+(assert (or x226 x234 (not x264)))
+(assert (or x213 (not x319) x244))
+(assert (or x99 x316 x231))
+(assert (or x131 x161 (not x292)))
+(assert (or (not x276) (not x133) (not x190)))
+(assert (or x233 (not x44) (not x195)))
+(assert (or x120 x226 x306))
+(assert (or x116 (not x305) (not x208)))
+(assert (or (not x194) x284 (not x214)))
+(assert (or x18 x76 (not x113)))
+(assert (or (not x177) (not x308) x188))
+(assert (or x129 (not x114) x216))
+(assert (or (not x263) (not x306) x174))
+(assert (or (not x106) (not x124) x232))
+(assert (or (not x303) (not x119) x196))
+(assert (or x154 (not x93) (not x199)))
+(assert (or (not x163) x43 (not x78)))
+(assert (or (not x271) x266 (not x96)))
+(assert (or x153 (not x250) x232))
+(assert (or x86 (not x138) x105))
+(assert (or (not x264) x58 x22))
+(assert (or x26 (not x257) (not x42)))
+(assert (or (not x246) x275 x11))
+(assert (or x26 x14 (not x260)))
+(assert (or (not x213) x101 x32))
+(assert (or x137 x237 x132))
+(assert (or x238 x264 x295))
+(assert (or (not x237) x316 (not x115)))
+(assert (or x34 x206 (not x213)))
+(assert (or (not x176) (not x98) x19))
+(assert (or (not x77) x76 (not x1)))
+(assert (or (not x66) (not x58) (not x299)))
+(assert (or x46 x146 x183))
+(assert (or (not x74) (not x197) (not x187)))
+(assert (or (not x75) (not x260) x245))
+(assert (or x216 x242 x148))
+(assert (or x137 x191 (not x20)))
+(assert (or (not x287) (not x75) (not x193)))
+(assert (or x271 x38 x203))
+(assert (or (not x206) x32 (not x40)))
+(assert (or x217 (not x65) (not x303)))
+(assert (or (not x177) x127 (not x135)))
+(assert (or x103 x179 x1))
+(assert (or (not x182) x2 x255))
+(assert (or x202 x21 (not x142)))
+(assert (or (not x73) x264 x241))
+(assert (or x179 (not x154) (not x141)))
+(assert (or x280 x122 x9))
+(assert (or (not x193) (not x248) x288))
+(assert (or (not x231) (not x105) (not x311)))
+(assert (or x304 x39 x15))
+(assert (or (not x213) x285 x260))
+(assert (or x119 x111 (not x265)))
+(assert (or (not x267) (not x130) (not x162)))
+(assert (or x28 x22 (not x79)))
+(assert (or (not x103) (not x244) x5))
+(assert (or x284 (not x218) (not x43)))
+(assert (or x269 x260 x291))
+(assert (or (not x157) x163 (not x4)))
+(assert (or (not x142) (not x235) x318))
+(assert (or x292 (not x25) (not x207)))
+(assert (or (not x49) x142 (not x127)))
+(assert (or (not x227) (not x228) (not x60)))
+(assert (or x87 x192 (not x59)))
+(assert (or (not x273) (not x173) (not x86)))
+(assert (or x110 (not x278) (not x51)))
+(assert (or (not x304) (not x258) x308))
+(assert (or x17 (not x217) (not x144)))
+(assert (or x38 (not x184) (not x108)))
+(assert (or x82 (not x184) (not x288)))
+(assert (or x221 (not x16) (not x124)))
+(assert (or x91 x150 x90))
+(assert (or x128 x102 (not x271)))
+(assert (or x15 (not x65) x149))
+(assert (or x143 (not x112) (not x263)))
+(assert (or (not x90) x143 x235))
+(assert (or x123 (not x146) x277))
+(assert (or x170 (not x235) x184))
+(assert (or x64 x174 (not x168)))
+(assert (or x91 (not x218) (not x208)))
+(assert (or x68 (not x117) x90))
+(assert (or x7 x47 x227))
+(assert (or (not x211) x207 (not x107)))
+(assert (or (not x246) (not x163) (not x42)))
+(assert (or x40 x77 x10))
+(assert (or x34 (not x84) (not x121)))
+(assert (or x136 x44 x7))
+(assert (or x309 x152 x259))
+(assert (or (not x118) x190 (not x271)))
+(assert (or x120 x314 x276))
+(assert (or (not x186) x315 x133))
+(assert (or x231 (not x230) x92))
+(assert (or (not x155) (not x168) x262))
+(assert (or (not x87) (not x292) (not x319)))
+(assert (or (not x184) x286 (not x319)))
+(assert (or (not x0) (not x122) x209))
+(assert (or (not x209) (not x121) (not x200)))
+(assert (or x282 (not x318) x76))
+(assert (or (not x263) x146 x113))
+(assert (or (not x152) (not x5) (not x259)))
+(assert (or (not x17) (not x29) x114))
+(assert (or (not x206) x276 (not x180)))
+(assert (or (not x283) x0 (not x28)))
+(assert (or x178 (not x300) x169))
+(assert (or (not x160) x16 (not x130)))
+(assert (or x84 (not x47) (not x34)))
+(assert (or (not x51) x284 x232))
+(assert (or (not x145) x283 (not x4)))
+(assert (or (not x10) x290 (not x72)))
+(assert (or x76 (not x301) (not x250)))
+(assert (or (not x123) x6 x243))
+(assert (or (not x63) x310 x13))
+(assert (or x156 x171 x262))
+(assert (or (not x217) (not x258) x309))
+(assert (or (not x267) (not x71) x303))
+(assert (or x71 x127 (not x167)))
+(assert (or x240 (not x287) x278))
+(assert (or x92 x127 x120))
+(assert (or x275 x234 x176))
+(assert (or (not x117) x233 (not x268)))
+(assert (or x100 (not x179) (not x304)))
+(assert (or x237 x51 (not x2)))
+(assert (or (not x170) x171 x31))
+(assert (or x87 (not x205) x209))
+(assert (or x92 x293 (not x269)))
+(assert (or (not x267) x297 x198))
+(assert (or (not x262) (not x58) (not x305)))
+(assert (or (not x128) (not x159) x206))
+(assert (or (not x35) (not x160) (not x144)))
+(assert (or (not x137) x84 (not x278)))
+(assert (or (not x271) (not x232) (not x238)))
+(assert (or x178 x101 x240))
+(assert (or x18 (not x296) x26))
+(assert (or (not x75) x203 x5))
+(assert (or x215 x156 x234))
+(assert (or x8 (not x84) (not x37)))
+(assert (or (not x258) x64 x130))
+(assert (or x189 x77 x84))
+(assert (or (not x42) (not x223) (not x127)))
+(assert (or (not x159) (not x162) x219))
+(assert (or x55 (not x97) x167))
+(assert (or (not x128) (not x286) (not x232)))
+(assert (or x134 x171 x37))
+(assert (or (not x79) x285 (not x312)))
+(assert (or x225 x27 x298))
+(assert (or (not x73) (not x8) x95))
+(assert (or x314 x245 (not x27)))
+(assert (or (not x20) x125 x53))
+(assert (or x271 x62 x133))
+(assert (or x294 x103 (not x282)))
+(assert (or (not x220) (not x184) x95))
+(assert (or (not x205) x6 x52))
+(assert (or x93 (not x162) x168))
+(assert (or x152 (not x60) x100))
+(assert (or x154 (not x265) (not x80)))
+(assert (or x76 (not x48) (not x35)))
+(assert (or (not x179) x181 (not x273)))
+(assert (or (not x69) x295 (not x261)))
+(assert (or (not x68) x50 (not x107)))
+(assert (or (not x118) x51 (not x264)))
+(assert (or (not x0) (not x208) x199))
+(assert (or x175 (not x22) x276))
+(assert (or (not x216) x164 (not x60)))
+(assert (or x141 (not x198) x139))
+(assert (or x62 (not x232) x308))
+(assert (or (not x120) x109 (not x223)))
+(assert (or x251 (not x282) x299))
+(assert (or (not x128) x284 x22))
+(assert (or (not x0) (not x185) (not x284)))
+(assert (or x316 (not x101) x84))
+(assert (or (not x220) x222 (not x109)))
+(assert (or (not x220) x189 (not x300)))
+(assert (or x76 (not x313) (not x244)))
+(assert (or x18 (not x78) (not x223)))
+(assert (or (not x176) x99 (not x26)))
+(assert (or x115 (not x50) (not x173)))
+(assert (or (not x203) (not x85) x0))
+(assert (or (not x318) (not x259) x189))
+(assert (or (not x108) (not x228) x126))
+(assert (or (not x93) (not x98) (not x304)))
+(assert (or (not x104) (not x258) (not x316)))
+(assert (or (not x59) x147 x145))
+(assert (or (not x106) x304 (not x109)))
+(assert (or x290 x304 x40))
+(assert (or (not x124) x3 x244))
+(assert (or x125 x18 x32))
+(assert (or (not x219) x282 x187))
+(assert (or x52 (not x163) x293))
+(assert (or x123 (not x260) (not x6)))
+(assert (or (not x195) (not x101) x281))
+(assert (or x226 x168 x40))
+(assert (or (not x231) (not x128) x165))
+(assert (or (not x28) x125 (not x114)))
+(assert (or (not x12) (not x248) x136))
+(assert (or (not x68) (not x116) x285))
+(assert (or x75 x164 (not x295)))
+(assert (or x170 x71 (not x277)))
+(assert (or x23 (not x234) x85))
+(assert (or x5 x54 x95))
+(assert (or x9 x104 x316))
+(assert (or x276 x121 (not x45)))
+(assert (or (not x98) (not x229) (not x193)))
+(assert (or (not x18) x161 x259))
+(assert (or x260 x48 x304))
+(assert (or x283 (not x64) x150))
+(assert (or (not x303) x146 (not x149)))
+(assert (or x253 (not x177) x90))
+(assert (or (not x232) x0 (not x214)))
+(assert (or x87 x295 (not x179)))
+(assert (or (not x224) x274 (not x297)))
+(assert (or (not x281) (not x153) (not x278)))
+(assert (or (not x77) x4 (not x156)))
+(assert (or x180 x87 (not x163)))
+(assert (or (not x97) x6 (not x129)))
+(assert (or x52 x174 x62))
+(assert (or (not x228) x246 (not x236)))
+(assert (or x124 (not x149) (not x316)))
+(assert (or x319 (not x70) x191))
+(assert (or x250 (not x288) x177))
+(assert (or (not x250) (not x216) x133))
+(assert (or (not x281) x29 x106))
+(assert (or x50 x77 (not x253)))
+(assert (or x20 (not x75) (not x26)))
+(assert (or x112 (not x281) x60))
+(assert (or (not x116) (not x275) x52))
+(assert (or (not x265) (not x162) (not x168)))
+(assert (or (not x62) x101 x273))
+(assert (or (not x170) (not x216) (not x84)))
+(assert (or x14 x112 x216))
+(assert (or (not x281) x214 (not x66)))
+(assert (or x198 x30 (not x300)))
+(assert (or x192 (not x175) (not x310)))
+(assert (or x303 x59 (not x228)))
+(assert (or x226 (not x51) (not x50)))
+(assert (or x219 x140 (not x195)))
+(assert (or (not x3) x93 x226))
+(assert (or x217 (not x154) x99))
+(assert (or (not x95) (not x318) x79))
+(assert (or (not x250) (not x101) x119))
+(assert (or x285 x59 (not x130)))
+(assert (or (not x195) x106 (not x268)))
+(assert (or x300 (not x107) (not x142)))
+(assert (or (not x133) (not x221) (not x178)))
+(assert (or x53 (not x313) x5))
+(assert (or x155 x109 (not x316)))
+(assert (or (not x157) x94 (not x218)))
+(assert (or (not x35) x303 (not x211)))
+(assert (or (not x156) x280 x35))
+(assert (or x217 (not x49) (not x42)))
+(assert (or (not x134) x274 x221))
+(assert (or x142 (not x145) (not x301)))
+(assert (or (not x252) (not x46) (not x158)))
+(assert (or (not x207) (not x16) x186))
+(assert (or (not x96) (not x153) x30))
+(assert (or (not x317) x41 x277))
+(assert (or (not x157) (not x239) (not x40)))
+(assert (or (not x86) (not x100) (not x125)))
+(assert (or (not x281) (not x185) (not x184)))
+(assert (or (not x107) (not x207) x281))
+(assert (or (not x46) x280 (not x157)))
+(assert (or (not x139) x154 (not x229)))
+(assert (or x160 x225 (not x30)))
+(assert (or x153 x21 (not x19)))
+(assert (or x187 (not x256) (not x212)))
+(assert (or (not x29) x303 x96))
+(assert (or (not x166) x76 (not x148)))
+(assert (or (not x274) x240 (not x103)))
+(assert (or x257 (not x289) x179))
+(assert (or x212 x277 x95))
+(assert (or x11 x209 (not x119)))
+(assert (or x111 (not x84) x216))
+(assert (or x159 (not x289) x180))
+(assert (or (not x219) (not x253) (not x50)))
+(assert (or (not x154) x98 (not x53)))
+(assert (or x180 x315 (not x313)))
+(assert (or (not x140) (not x287) x90))
+(assert (or x182 x153 (not x262)))
+(assert (or x109 (not x208) x79))
+(assert (or (not x52) x32 (not x317)))
+(assert (or (not x266) (not x286) x78))
+(assert (or (not x52) (not x204) x34))
+(assert (or x46 (not x315) x66))
+(assert (or (not x84) (not x168) x160))
+(assert (or x60 x156 x259))
+(assert (or (not x166) (not x238) x186))
+(assert (or x150 x104 x265))
+(assert (or (not x51) (not x263) (not x306)))
+(assert (or x240 (not x260) (not x49)))
+(assert (or (not x167) (not x255) (not x230)))
+(assert (or x120 (not x284) x103))
+(assert (or x55 (not x97) x275))
+(assert (or (not x123) (not x5) (not x193)))
+(assert (or (not x14) (not x4) (not x216)))
+(assert (or x95 (not x259) (not x57)))
+(assert (or x41 (not x0) (not x141)))
+(assert (or x212 x21 x272))
+(assert (or (not x195) x308 (not x266)))
+(assert (or x66 x205 x138))
+(assert (or (not x163) (not x115) x8))
+(assert (or (not x318) (not x153) x115))
+(assert (or (not x88) (not x49) x59))
+(assert (or (not x272) x41 (not x271)))
+(assert (or x232 x63 (not x41)))
+(assert (or (not x81) x295 x258))
+(assert (or x65 (not x129) (not x238)))
+(assert (or (not x120) x85 x284))
+(assert (or (not x226) (not x304) (not x103)))
+(assert (or x123 x87 (not x200)))
+(assert (or (not x6) (not x312) x275))
+(assert (or (not x27) x9 x169))
+(assert (or x302 x285 (not x98)))
+(assert (or x305 x228 x13))
+(assert (or x104 x77 x279))
+(assert (or x204 (not x215) (not x298)))
+(assert (or x309 (not x112) x88))
+(assert (or x207 (not x110) (not x294)))
+(assert (or x180 (not x143) x291))
+(assert (or (not x139) (not x85) x212))
+(assert (or (not x248) (not x60) (not x105)))
+(assert (or (not x142) x210 x166))
+(assert (or (not x131) (not x209) x308))
+(assert (or (not x112) x30 (not x245)))
+(assert (or x240 (not x100) (not x124)))
+(assert (or (not x201) x172 (not x256)))
+(assert (or x202 (not x209) (not x319)))
+(assert (or x4 x292 x282))
+(assert (or x218 x119 x283))
+(assert (or (not x53) x116 (not x227)))
+(assert (or (not x287) (not x201) (not x190)))
+(assert (or x248 (not x255) (not x71)))
+(assert (or x281 (not x195) x119))
+(assert (or (not x161) x121 x72))
+(assert (or (not x268) (not x296) x110))
+(assert (or (not x177) (not x61) (not x56)))
+(assert (or x14 (not x103) (not x257)))
+(assert (or (not x16) (not x294) x314))
+(assert (or x83 (not x54) x299))
+(assert (or x198 (not x121) x49))
+(assert (or x244 (not x97) (not x286)))
+(assert (or (not x22) (not x67) x288))
+(assert (or (not x159) x98 x207))
+(assert (or (not x314) (not x182) x114))
+(assert (or (not x209) x133 x132))
+(assert (or x41 (not x36) (not x244)))
+(assert (or (not x170) (not x314) x60))
+(assert (or x252 x155 x111))
+(assert (or x225 x119 (not x155)))
+(assert (or (not x263) x116 (not x107)))
+(assert (or x257 x38 (not x286)))
+(assert (or (not x236) (not x190) x201))
+(assert (or (not x106) x101 (not x202)))
+(assert (or x77 x15 x316))
+(assert (or x150 (not x121) x307))
+(assert (or (not x172) x24 x197))
+(assert (or (not x6) x55 (not x312)))
+(assert (or x6 x282 x55))
+(assert (or x126 (not x188) (not x55)))
+(assert (or (not x172) x75 x298))
+(assert (or (not x37) x183 (not x9)))
+(assert (or (not x285) (not x60) x166))
+(assert (or (not x37) x17 x316))
+(assert (or x250 (not x43) x240))
+(assert (or (not x177) x208 (not x237)))
+(assert (or x7 (not x267) (not x173)))
+(assert (or x208 (not x190) x303))
+(assert (or (not x204) x240 (not x124)))
+(assert (or x205 x15 x218))
+(assert (or x55 (not x319) (not x174)))
+(assert (or x18 x236 (not x7)))
+(assert (or x179 x201 (not x121)))
+(assert (or x130 (not x160) x105))
+(assert (or x219 x124 (not x231)))
+(assert (or (not x114) x162 (not x117)))
+(assert (or x104 (not x167) x65))
+(assert (or x94 (not x290) (not x199)))
+(assert (or (not x60) (not x200) x115))
+(assert (or (not x282) (not x315) x259))
+(assert (or (not x207) x192 (not x23)))
+(assert (or (not x148) (not x212) x132))
+(assert (or (not x288) (not x169) (not x173)))
+(assert (or (not x50) (not x266) (not x52)))
+(assert (or x233 (not x286) x180))
+(assert (or (not x289) (not x29) x153))
+(assert (or x27 (not x210) x142))
+(assert (or (not x10) x191 (not x173)))
+(assert (or (not x147) (not x312) x26))
+(assert (or x65 x232 x114))
+(assert (or (not x186) (not x125) (not x193)))
+(assert (or x289 (not x69) (not x204)))
+(assert (or (not x198) x104 (not x287)))
+(assert (or x7 (not x178) (not x55)))
+(assert (or (not x83) (not x90) (not x11)))
+(assert (or x245 (not x75) (not x3)))
+(assert (or (not x169) (not x172) x162))
+(assert (or (not x226) x307 (not x38)))
+(assert (or x223 x77 x312))
+(assert (or (not x120) (not x307) x76))
+(assert (or x189 (not x162) x141))
+(assert (or (not x202) x35 x269))
+(assert (or x208 (not x253) x122))
+(assert (or (not x269) (not x152) (not x37)))
+(assert (or x232 x166 x318))
+(assert (or x115 x155 x203))
+(assert (or (not x119) x267 x32))
+(assert (or x25 x35 (not x206)))
+(assert (or (not x93) (not x24) x88))
+(assert (or (not x262) (not x286) (not x161)))
+(assert (or x125 x160 (not x314)))
+(assert (or x72 x47 (not x43)))
+(assert (or x151 x284 (not x162)))
+(assert (or x238 (not x166) x119))
+(assert (or (not x132) (not x86) x95))
+(assert (or (not x227) x289 (not x223)))
+(assert (or (not x103) (not x50) (not x300)))
+(assert (or (not x180) (not x34) (not x273)))
+(assert (or x240 (not x2) x270))
+(assert (or x111 x93 (not x298)))
+(assert (or (not x121) x27 (not x104)))
+(assert (or (not x277) (not x185) x133))
+(assert (or (not x96) x218 (not x303)))
+(assert (or (not x97) x215 x47))
+(assert (or (not x59) (not x35) x85))
+(assert (or (not x115) (not x120) x150))
+(assert (or (not x311) (not x315) (not x4)))
+(assert (or (not x103) x75 x13))
+(assert (or (not x182) (not x285) x47))
+(assert (or x10 x128 (not x244)))
+(assert (or (not x198) (not x38) x129))
+(assert (or (not x79) x92 x30))
+(assert (or x317 (not x130) x222))
+(assert (or (not x65) x157 x164))
+(assert (or x109 (not x236) x172))
+(assert (or x252 (not x316) x172))
+(assert (or x223 x265 x228))
+(assert (or (not x252) (not x219) x164))
+(assert (or (not x3) (not x71) x56))
+(assert (or x98 x83 x200))
+(assert (or x135 x84 (not x80)))
+(assert (or x304 (not x51) x217))
+(assert (or x199 x194 x43))
+(assert (or x37 x164 x88))
+(assert (or x55 x98 (not x210)))
+(assert (or (not x183) (not x137) x244))
+(assert (or x39 (not x191) x96))
+(assert (or (not x19) x287 (not x231)))
+(assert (or x40 x47 x33))
+(assert (or x237 x27 x235))
+(assert (or (not x276) (not x226) (not x43)))
+(assert (or x288 x220 x39))
+(assert (or (not x257) x169 (not x45)))
+(assert (or x61 x191 x146))
+(assert (or (not x0) x177 (not x49)))
+(assert (or x53 (not x263) (not x95)))
+(assert (or x313 x149 x296))
+(assert (or x212 (not x180) (not x125)))
+(assert (or (not x106) x151 x223))
+(assert (or (not x15) (not x58) x52))
+(assert (or (not x230) x265 (not x145)))
+(assert (or (not x223) (not x152) x310))
+(assert (or (not x85) (not x287) (not x310)))
+(assert (or x77 (not x109) x208))
+(assert (or x65 x206 x277))
+(assert (or x42 (not x283) x69))
+(assert (or (not x182) (not x284) (not x150)))
+(assert (or (not x151) (not x284) (not x63)))
+(assert (or x70 (not x262) x309))
+(assert (or (not x8) (not x173) (not x208)))
+(assert (or x270 x100 x92))
+(assert (or (not x23) (not x152) (not x199)))
+(assert (or (not x42) (not x213) (not x72)))
+(assert (or x120 x136 (not x72)))
+(assert (or (not x305) (not x273) (not x117)))
+(assert (or x248 (not x194) x284))
+(assert (or (not x310) (not x278) x98))
+(assert (or (not x72) x234 (not x30)))
+(assert (or (not x276) x79 x24))
+(assert (or x200 x173 (not x183)))
+(assert (or x197 x84 x180))
+(assert (or (not x194) (not x32) (not x41)))
+(assert (or x48 (not x180) x57))
+(assert (or x61 x152 (not x315)))
+(assert (or (not x175) x37 x40))
+(assert (or x138 (not x98) (not x62)))
+(assert (or x210 x123 (not x107)))
+(assert (or (not x304) (not x216) x196))
+(assert (or x183 (not x277) x188))
+(assert (or (not x72) (not x287) x171))
+(assert (or x292 (not x306) (not x230)))
+(assert (or x7 x101 (not x159)))
+(assert (or x311 x100 (not x318)))
+(assert (or (not x177) (not x19) (not x200)))
+(assert (or x120 x175 (not x232)))
+(assert (or (not x126) x309 x111))
+(assert (or (not x209) x100 (not x259)))
+(assert (or (not x242) (not x243) (not x206)))
+(assert (or (not x160) (not x222) (not x115)))
+(assert (or x287 (not x124) (not x220)))
+(assert (or (not x105) x1 (not x198)))
+(assert (or x138 (not x154) x263))
+(assert (or x226 (not x84) (not x94)))
+(assert (or x8 (not x147) x196))
+(assert (or (not x42) (not x112) x185))
+(assert (or x153 (not x76) (not x29)))
+(assert (or (not x197) (not x18) x114))
+(assert (or x71 x48 (not x130)))
+(assert (or (not x41) x260 (not x193)))
+(assert (or x217 (not x72) (not x156)))
+(assert (or x128 x72 (not x242)))
+(assert (or (not x95) x97 (not x198)))
+(assert (or (not x235) x20 x314))
+(assert (or x9 x36 x190))
+(assert (or x183 (not x287) (not x134)))
+(assert (or (not x195) x164 (not x125)))
+(assert (or x75 (not x98) x78))
+(assert (or x45 x121 x230))
+(assert (or (not x102) (not x92) x61))
+(assert (or x164 (not x35) (not x307)))
+(assert (or (not x275) (not x80) (not x95)))
+(assert (or x269 (not x90) x23))
+(assert (or x268 x24 (not x7)))
+(assert (or x198 x10 x163))
+(assert (or x295 x300 x128))
+(assert (or (not x121) (not x272) x115))
+(assert (or x204 x262 x303))
+(assert (or (not x276) (not x169) (not x296)))
+(assert (or (not x258) (not x228) x302))
+(assert (or (not x287) x211 x189))
+(assert (or (not x41) x183 x279))
+(assert (or (not x219) x23 (not x25)))
+(assert (or x304 x137 x311))
+(assert (or (not x54) x66 (not x237)))
+(assert (or x47 x285 (not x275)))
+(assert (or (not x296) (not x225) (not x317)))
+(assert (or x76 (not x45) x252))
+(assert (or x16 (not x42) x238))
+(assert (or x214 (not x135) x54))
+(assert (or (not x126) x209 (not x279)))
+(assert (or (not x276) (not x287) x116))
+(assert (or (not x34) x227 (not x163)))
+(assert (or x57 (not x56) x179))
+(assert (or (not x140) (not x172) (not x234)))
+(assert (or x15 x138 x37))
+(assert (or (not x316) (not x301) (not x190)))
+(assert (or x215 (not x116) (not x42)))
+(assert (or (not x145) (not x87) (not x139)))
+(assert (or (not x261) x62 x284))
+(assert (or (not x228) x189 x168))
+(assert (or x154 x291 (not x261)))
+(assert (or x45 (not x59) x49))
+(assert (or (not x271) x52 x234))
+(assert (or (not x183) x148 x14))
+(assert (or (not x216) x251 (not x83)))
+(assert (or (not x0) (not x140) x300))
+(assert (or x291 (not x302) x126))
+(assert (or (not x108) x60 x78))
+(assert (or (not x55) x159 (not x120)))
+(assert (or (not x116) (not x254) (not x147)))
+(assert (or (not x261) (not x57) x50))
+(assert (or x139 x58 (not x245)))
+(assert (or (not x90) x188 x236))
+(assert (or x70 (not x0) x80))
+(assert (or x134 x123 (not x293)))
+(assert (or (not x124) x70 x281))
+(assert (or (not x85) x65 x0))
+(assert (or (not x238) (not x8) (not x162)))
+(assert (or (not x107) (not x293) x105))
+(assert (or (not x90) x69 x289))
+(assert (or (not x144) x294 x164))
+(assert (or (not x237) (not x283) (not x213)))
+(assert (or x158 (not x132) (not x99)))
+(assert (or (not x34) (not x232) x14))
+(assert (or x151 x129 (not x37)))
+(assert (or (not x154) x221 (not x12)))
+(assert (or (not x167) x133 (not x142)))
+(assert (or x272 (not x152) x197))
+(assert (or x145 (not x151) x307))
+(assert (or x165 x133 x289))
+(assert (or x69 (not x9) x1))
+(assert (or (not x272) x250 x188))
+(assert (or (not x175) x17 (not x196)))
+(assert (or x212 (not x224) (not x251)))
+(assert (or x243 (not x273) (not x98)))
+(assert (or x293 (not x52) x39))
+(assert (or x98 (not x284) x238))
+(assert (or (not x132) x212 (not x244)))
+(assert (or (not x303) x189 x299))
+(assert (or x66 (not x51) x18))
+(assert (or x310 x75 x176))
+(assert (or (not x171) x249 x55))
+(assert (or (not x37) (not x119) x260))
+(assert (or (not x0) x222 (not x91)))
+(assert (or (not x44) (not x225) x258))
+(assert (or (not x69) x77 x273))
+(assert (or x209 x36 (not x28)))
+(assert (or (not x78) x13 x72))
+(assert (or x26 (not x89) x303))
+(assert (or x1 (not x310) (not x247)))
+(assert (or x224 (not x41) x196))
+(assert (or x284 (not x175) x97))
+(assert (or x238 x202 x72))
+(assert (or (not x309) x301 (not x273)))
+(assert (or x1 (not x221) (not x110)))
+(assert (or (not x205) x226 (not x305)))
+(assert (or x96 (not x243) (not x260)))
+(assert (or x192 (not x303) (not x29)))
+(assert (or (not x75) (not x63) x286))
+(assert (or x269 x182 x5))
+(assert (or x184 x71 (not x206)))
+(assert (or x257 x73 (not x304)))
+(assert (or x147 x93 x42))
+(assert (or (not x201) x226 (not x47)))
+(assert (or x105 x153 (not x15)))
+(assert (or (not x143) (not x12) (not x186)))
+(assert (or x168 x319 (not x200)))
+(assert (or x21 (not x124) x158))
+(assert (or x22 x1 x84))
+(assert (or (not x30) x190 x261))
+(assert (or (not x103) (not x77) (not x78)))
+(assert (or x283 (not x254) (not x48)))
+(assert (or x166 (not x101) x210))
+(assert (or (not x171) x61 x105))
+(assert (or (not x44) x6 x234))
+(assert (or (not x227) (not x276) x163))
+(assert (or (not x208) (not x161) x121))
+(assert (or x113 x247 x80))
+(assert (or x107 (not x188) x135))
+(assert (or x26 x314 x249))
+(assert (or x235 (not x86) x314))
+(assert (or x229 x212 (not x156)))
+(assert (or x214 (not x132) (not x103)))
+(assert (or x266 x123 (not x316)))
+(assert (or (not x284) (not x260) (not x75)))
+(assert (or x276 x86 (not x23)))
+(assert (or x64 x223 (not x226)))
+(assert (or x222 (not x247) x164))
+(assert (or x161 x247 (not x21)))
+(assert (or (not x213) (not x69) x111))
+(assert (or x112 x249 x123))
+(assert (or x248 (not x175) x3))
+(assert (or (not x313) x309 x215))
+(assert (or (not x267) x133 (not x230)))
+(assert (or (not x231) x68 x150))
+(assert (or x193 x35 x48))
+(assert (or x114 (not x310) (not x101)))
+(assert (or (not x172) (not x87) x309))
+(assert (or (not x228) x44 x250))
+(assert (or x318 x57 (not x262)))
+(assert (or x63 (not x23) x280))
+(assert (or (not x66) x239 (not x137)))
+(assert (or x27 x4 x255))
+(assert (or x198 x247 x283))
+(assert (or (not x279) x257 x44))
+(assert (or (not x117) (not x219) (not x248)))
+(assert (or x162 x236 x29))
+(assert (or x282 x225 x74))
+(assert (or (not x254) (not x213) (not x170)))
+(assert (or (not x257) (not x28) (not x229)))
+(assert (or x280 (not x30) x296))
+(assert (or x116 (not x137) x189))
+(assert (or x12 x316 (not x255)))
+(assert (or x70 x100 x175))
+(assert (or x147 (not x62) x257))
+(assert (or (not x111) x142 x145))
+(assert (or x161 x253 (not x209)))
+(assert (or x23 x138 (not x189)))
+(assert (or x309 x248 x37))
+(assert (or x59 x176 (not x257)))
+(assert (or (not x150) x174 x96))
+(assert (or x215 x63 (not x58)))
+(assert (or (not x85) (not x244) x293))
+(assert (or (not x53) x292 (not x255)))
+(assert (or x194 x251 (not x127)))
+(assert (or (not x262) x139 x167))
+(assert (or x246 x115 (not x142)))
+(assert (or x95 (not x281) (not x59)))
+(assert (or x303 (not x172) x102))
+(assert (or (not x17) x82 (not x195)))
+(assert (or x100 (not x281) (not x224)))
+(assert (or x130 (not x150) x67))
+(assert (or x212 x62 (not x13)))
+(assert (or (not x239) (not x130) (not x187)))
+(assert (or (not x99) (not x205) (not x156)))
+(assert (or (not x225) x133 x280))
+(assert (or x21 (not x141) (not x290)))
+(assert (or (not x143) (not x176) x297))
+(assert (or (not x155) (not x296) x274))
+(assert (or x261 x259 x71))
+(assert (or (not x299) (not x41) x179))
+(assert (or x183 (not x139) x19))
+(assert (or x269 x255 (not x189)))
+(assert (or x285 (not x35) (not x37)))
+(assert (or (not x201) (not x285) (not x262)))
+(assert (or x21 (not x34) x311))
+(assert (or (not x130) (not x163) (not x178)))
+(assert (or (not x117) (not x14) x277))
+(assert (or (not x99) (not x319) x303))
+(assert (or x281 (not x51) x38))
+(assert (or (not x4) x179 x244))
+(assert (or x38 (not x225) (not x23)))
+(assert (or x147 (not x157) x185))
+(assert (or x268 (not x301) x249))
+(assert (or (not x254) x302 x102))
+(assert (or x117 x302 (not x158)))
+(assert (or (not x276) (not x275) (not x44)))
+(assert (or x91 (not x174) (not x312)))
+(assert (or (not x275) x168 (not x317)))
+(assert (or x32 (not x256) x253))
+(assert (or (not x53) x209 (not x238)))
+(assert (or (not x266) x8 (not x20)))
+(assert (or x110 x315 x22))
+(assert (or (not x175) (not x176) (not x237)))
+(assert (or (not x145) x304 x202))
+(assert (or x262 (not x220) x101))
+(assert (or x142 x67 x311))
+(assert (or x152 x91 (not x83)))
+(assert (or x157 (not x298) x248))
+(assert (or (not x98) x0 (not x194)))
+(assert (or (not x279) (not x85) x309))
+(assert (or x171 x119 x199))
+(assert (or x256 (not x114) (not x45)))
+(assert (or (not x107) x111 (not x62)))
+(assert (or x220 (not x251) (not x75)))
+(assert (or (not x313) (not x306) x275))
+(assert (or x201 x56 (not x183)))
+(assert (or x51 x253 x39))
+(assert (or (not x28) x51 x8))
+(assert (or (not x303) (not x77) x249))
+(assert (or x95 (not x183) x124))
+(assert (or x265 (not x278) (not x8)))
+(assert (or (not x289) (not x168) x221))
+(assert (or x307 x296 (not x238)))
+(assert (or (not x168) x167 (not x5)))
+(assert (or x106 x150 x58))
+(assert (or (not x154) (not x112) x150))
+(assert (or (not x233) (not x237) (not x298)))
+(assert (or (not x27) (not x315) (not x273)))
+(assert (or (not x144) x224 (not x69)))
+(assert (or x62 x287 x32))
+(assert (or (not x98) (not x28) (not x102)))
+(assert (or x5 (not x249) x144))
+(assert (or x93 x9 x183))
+(assert (or x91 x106 (not x314)))
+(assert (or x293 (not x298) x118))
+(assert (or (not x83) x32 (not x104)))
+(assert (or (not x244) x120 x98))
+(assert (or x301 x313 (not x172)))
+(assert (or (not x79) (not x67) x309))
+(assert (or x316 x137 x71))
+(assert (or (not x213) x49 x164))
+(assert (or (not x24) x228 x191))
+(assert (or (not x303) (not x283) (not x9)))
+(assert (or (not x233) (not x268) (not x4)))
+(assert (or x25 (not x133) (not x16)))
+(assert (or (not x56) (not x106) (not x52)))
+(assert (or (not x186) x114 x109))
+(assert (or x34 x17 (not x11)))
+(assert (or (not x194) x144 x255))
+(assert (or (not x171) (not x257) x229))
+(assert (or x313 (not x214) x274))
+(assert (or (not x56) (not x49) (not x23)))
+(assert (or x30 (not x196) x84))
+(assert (or (not x141) (not x139) (not x119)))
+(assert (or (not x219) x23 (not x97)))
+(assert (or x215 (not x114) (not x64)))
+(assert (or (not x57) x61 (not x16)))
+(assert (or (not x216) (not x44) (not x86)))
+(assert (or (not x172) x124 x216))
+(assert (or (not x254) x284 x119))
+(assert (or (not x17) (not x314) (not x45)))
+(assert (or (not x5) (not x81) (not x11)))
+(assert (or x131 (not x51) x289))
+(assert (or x298 x274 (not x234)))
+(assert (or x53 x252 (not x222)))
+(assert (or x91 x14 (not x212)))
+(assert (or x4 x319 (not x98)))
+(assert (or (not x52) x175 x41))
+(assert (or x78 x209 (not x215)))
+(assert (or x197 (not x139) x210))
+(assert (or (not x146) (not x179) (not x164)))
+(assert (or x152 x101 x19))
+(assert (or x305 x226 (not x44)))
+(assert (or (not x17) x154 x241))
+(assert (or (not x129) x19 x241))
+(assert (or (not x35) (not x287) x96))
+(assert (or x150 (not x204) (not x261)))
+(assert (or (not x171) x306 x38))
+(assert (or x7 (not x84) x22))
+(assert (or (not x306) (not x159) (not x232)))
+(assert (or x104 (not x194) (not x185)))
+(assert (or x161 (not x6) (not x269)))
+(assert (or x90 (not x281) x74))
+(assert (or (not x220) x105 x306))
+(assert (or x52 x1 x208))
+(assert (or x288 (not x60) (not x179)))
+(assert (or (not x121) (not x216) (not x50)))
+(assert (or x118 (not x209) x220))
+(assert (or x45 x283 (not x70)))
+(assert (or x55 (not x285) (not x315)))
+(assert (or x90 x4 x266))
+(assert (or x138 x247 (not x298)))
+(assert (or (not x214) (not x185) x258))
+(assert (or (not x234) x225 x32))
+(assert (or (not x308) (not x38) (not x180)))
+(assert (or x318 (not x198) (not x5)))
+(assert (or x163 x203 x138))
+(assert (or (not x161) x55 x1))
+(assert (or (not x218) x252 (not x97)))
+(assert (or (not x74) x153 x12))
+(assert (or (not x270) (not x95) (not x291)))
+(assert (or (not x260) (not x148) x84))
+(assert (or x124 (not x240) (not x175)))
+(assert (or (not x206) x108 (not x144)))
+(assert (or x161 x143 x102))
+(assert (or (not x106) (not x69) (not x10)))
+(assert (or (not x185) x270 x63))
+(assert (or (not x254) x84 x116))
+(assert (or x135 (not x185) x245))
+(assert (or x242 (not x252) (not x4)))
+(assert (or (not x103) x151 x281))
+(assert (or (not x241) x268 (not x229)))
+(assert (or x241 x46 x24))
+(assert (or x69 x185 (not x119)))
+(assert (or x277 x124 x236))
+(assert (or (not x14) (not x204) x17))
+(assert (or (not x278) x207 (not x240)))
+(assert (or x269 (not x66) x55))
+(assert (or x181 (not x283) (not x111)))
+(assert (or (not x234) x306 x18))
+(assert (or (not x56) x280 (not x246)))
+(assert (or x256 (not x212) (not x20)))
+(assert (or (not x124) (not x278) (not x187)))
+(assert (or (not x154) x115 x134))
+(assert (or x217 x127 (not x272)))
+(assert (or x14 x290 x312))
+(assert (or (not x24) (not x245) x163))
+(assert (or x257 (not x269) (not x45)))
+(assert (or x45 x306 (not x63)))
+(assert (or x266 (not x158) (not x178)))
+(assert (or (not x15) x189 (not x142)))
+(assert (or (not x85) (not x193) x267))
+(assert (or (not x132) x313 (not x4)))
+(assert (or x210 x164 (not x11)))
+(assert (or (not x182) x34 x98))
+(assert (or (not x88) x157 x147))
+(assert (or (not x57) x183 (not x179)))
+(assert (or (not x5) (not x222) x133))
+(assert (or (not x93) x55 (not x141)))
+(assert (or (not x198) (not x109) x277))
+(assert (or x179 x37 x26))
+(assert (or (not x263) (not x210) (not x316)))
+(assert (or x114 (not x269) (not x60)))
+(assert (or (not x76) (not x41) x9))
+(assert (or x186 (not x240) x104))
+(assert (or (not x32) x226 x93))
+(assert (or x111 (not x31) x197))
+(assert (or (not x212) x77 (not x293)))
+(assert (or x246 x38 x287))
+(assert (or x86 x11 (not x298)))
+(assert (or (not x306) x269 x49))
+(assert (or (not x119) (not x169) (not x173)))
+(assert (or (not x313) x272 x164))
+(assert (or (not x114) (not x20) (not x250)))
+(assert (or (not x93) (not x124) x297))
+(assert (or (not x48) (not x163) (not x230)))
+(assert (or (not x305) x183 (not x114)))
+(assert (or (not x299) (not x275) x266))
+(assert (or (not x199) x175 x80))
+(assert (or x148 x246 x23))
+(assert (or (not x163) (not x290) (not x223)))
+(assert (or x100 (not x233) (not x246)))
+(assert (or x22 x106 (not x301)))
+(assert (or x302 (not x158) (not x280)))
+(assert (or (not x305) (not x82) x187))
+(assert (or (not x73) (not x293) (not x312)))
+(assert (or (not x128) (not x2) x70))
+(assert (or (not x259) (not x158) (not x277)))
+(assert (or (not x116) x163 x67))
+(assert (or x201 (not x304) x230))
+(assert (or x144 x170 (not x176)))
+(assert (or (not x183) (not x124) (not x14)))
+(assert (or x34 x139 x254))
+(assert (or x263 (not x6) x150))
+(assert (or (not x271) x218 (not x193)))
+(assert (or (not x223) (not x252) x22))
+(assert (or (not x270) x77 x32))
+(assert (or (not x72) x215 x317))
+(assert (or x233 x283 (not x75)))
+(assert (or x27 (not x95) x77))
+(assert (or x207 (not x36) x80))
+(assert (or (not x124) x18 (not x278)))
+(assert (or (not x175) (not x56) (not x68)))
+(assert (or (not x103) (not x60) x287))
+(assert (or x244 (not x85) x30))
+(assert (or x284 (not x141) (not x283)))
+(assert (or x101 x79 x183))
+(assert (or x275 x21 (not x158)))
+(assert (or (not x206) x274 x65))
+(assert (or (not x137) (not x15) x199))
+(assert (or (not x279) x210 (not x234)))
+(assert (or (not x127) (not x7) x51))
+(assert (or x129 (not x18) x7))
+(assert (or (not x258) x109 (not x179)))
+(assert (or (not x51) x105 (not x61)))
+(assert (or (not x231) (not x66) (not x282)))
+(assert (or x218 (not x233) x195))
+(assert (or x139 (not x231) (not x197)))
+(assert (or (not x256) x133 x37))
+(assert (or (not x74) (not x154) x9))
+(assert (or (not x178) (not x20) x281))
+(assert (or (not x107) x276 x270))
+(assert (or (not x155) (not x104) x258))
+(assert (or (not x52) (not x10) (not x159)))
+(assert (or (not x21) x183 (not x74)))
+(assert (or x284 x17 (not x194)))
+(assert (or x198 x117 (not x281)))
+(assert (or (not x94) (not x135) (not x171)))
+(assert (or x143 x5 x15))
+(assert (or x54 x187 x164))
+(assert (or x71 x54 (not x233)))
+(assert (or (not x25) x58 x119))
+(assert (or x76 (not x267) (not x96)))
+(assert (or x309 (not x292) (not x21)))
+(assert (or x298 (not x2) x154))
+(assert (or x266 x319 x48))
+(assert (or (not x31) x275 (not x198)))
+(assert (or (not x101) (not x310) (not x136)))
+(assert (or (not x273) x212 (not x98)))
+(assert (or (not x224) x56 (not x191)))
+(assert (or x273 (not x235) x256))
+(assert (or x11 x131 x15))
+(assert (or (not x252) (not x208) (not x59)))
+(assert (or x277 x155 x263))
+(assert (or (not x102) x26 (not x311)))
+(assert (or x135 x172 (not x168)))
+(assert (or x49 x31 x43))
+(assert (or x130 (not x222) x18))
+(assert (or (not x242) x136 (not x44)))
+(assert (or x249 (not x162) x187))
+(assert (or x317 x72 (not x49)))
+(assert (or (not x137) x89 x273))
+(assert (or x132 x65 x152))
+(assert (or x298 (not x295) (not x267)))
+(assert (or x310 x243 (not x88)))
+(assert (or x124 x133 x194))
+(assert (or x25 x77 (not x237)))
+(assert (or (not x131) (not x145) x242))
+(assert (or x177 x293 (not x76)))
+(check-sat)
@@ -137,6 +137,8 @@ def run_regression(unsat_cores, proofs, dump, wrapper, cvc4_binary,
         sys.exit('"{}" does not exist or is not a file'.format(benchmark_path))
 
     cvc4_features = get_cvc4_features(cvc4_binary)
+    if cvc4_binary.endswith('pcvc4'):
+        cvc4_features.append('portfolio')
 
     basic_command_line_args = []
 
@@ -0,0 +1,131 @@
+/*********************                                                        */
+/*! \file cdflat_hashmap_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::context::CDFlatHashMap<>.
+ **
+ ** Black box testing of CVC4::context::CDFlatHashMap<>.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <map>
+
+#include "context/cdflat_hashmap.h"
+#include "context/context.h"
+
+using CVC4::context::Context;
+using CVC4::context::CDFlatHashMap;
+
+class CDFlatHashMapBlack : public CxxTest::TestSuite {
+  Context* d_context;
+
+ public:
+  void setUp() { d_context = new Context; }
+
+  void tearDown() { delete d_context; }
+
+  // Returns the elements in a CDFlatHashMap.
+  static std::map<int, int> GetElements(const CDFlatHashMap<int, int>& map) {
+    return std::map<int, int>{map.begin(), map.end()};
+  }
+
+  // Returns true if the elements in map are the same as expected.
+  static bool ElementsAre(const CDFlatHashMap<int, int>& map,
+                          const std::map<int, int>& expected) {
+    return GetElements(map) == expected;
+  }
+
+  void testSimpleSequence() {
+    CDFlatHashMap<int, int> map(d_context);
+    TS_ASSERT(ElementsAre(map, {}));
+
+    TS_ASSERT(map.insert(3, 4));
+    TS_ASSERT(ElementsAre(map, {{3, 4}}));
+
+    {
+      d_context->push();
+      map.insert(5, 6);
+      map.insert(9, 8);
+      TS_ASSERT(ElementsAre(map, {{3, 4}, {5, 6}, {9, 8}}));
+
+      {
+        d_context->push();
+        map.insert(1, 2);
+        TS_ASSERT(ElementsAre(map, {{1, 2}, {3, 4}, {5, 6}, {9, 8}}));
+        d_context->pop();
+      }
+
+      TS_ASSERT(ElementsAre(map, {{3, 4}, {5, 6}, {9, 8}}));
+      TS_ASSERT(!map.contains(1));
+      TS_ASSERT(map.find(1) == map.end());
+      d_context->pop();
+    }
+
+    TS_ASSERT(ElementsAre(map, {{3, 4}}));
+    TS_ASSERT_EQUALS(map.size(), 1u);
+  }
+
+  void testOverwrite() {
+    CDFlatHashMap<int, int> map(d_context);
+    map.insert(1, 10);
+
+    d_context->push();
+    // the old value of a key from an outer level is restored
+    TS_ASSERT(!map.insert(1, 11));
+    // a key of this level may be overwritten in place
+    map.insert(2, 20);
+    map.insert(2, 21);
+    TS_ASSERT_EQUALS(map[1], 11);
+    TS_ASSERT_EQUALS(map[2], 21);
+
+    d_context->push();
+    map.insert(1, 12);
+    map.insert(2, 22);
+    TS_ASSERT(ElementsAre(map, {{1, 12}, {2, 22}}));
+    d_context->pop();
+
+    TS_ASSERT(ElementsAre(map, {{1, 11}, {2, 21}}));
+    d_context->pop();
+
+    TS_ASSERT(ElementsAre(map, {{1, 10}}));
+    TS_ASSERT_EQUALS(map.count(2), 0u);
+  }
+
+  void testGrowAndBackjump() {
+    CDFlatHashMap<int, int> map(d_context);
+    const int perLevel = 100;
+    for (int level = 0; level < 10; ++level) {
+      d_context->push();
+      for (int i = 0; i < perLevel; ++i) {
+        map.insert(level * perLevel + i, level);
+        // overwrite a key of level 0
+        map.insert(i, level);
+      }
+    }
+    TS_ASSERT_EQUALS(map.size(), size_t(10 * perLevel));
+    TS_ASSERT_EQUALS(map[0], 9);
+
+    d_context->popto(3);
+    TS_ASSERT_EQUALS(map.size(), size_t(3 * perLevel));
+    TS_ASSERT_EQUALS(map[0], 2);
+    TS_ASSERT_EQUALS(map[2 * perLevel + 5], 2);
+    TS_ASSERT(!map.contains(3 * perLevel));
+
+    // the slots freed by the backjump can be reused
+    for (int i = 3 * perLevel; i < 5 * perLevel; ++i) {
+      TS_ASSERT(map.insert(i, -1));
+    }
+    TS_ASSERT_EQUALS(map[4 * perLevel], -1);
+
+    d_context->popto(0);
+    TS_ASSERT(map.empty());
+  }
+};
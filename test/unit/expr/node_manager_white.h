@@ -17,6 +17,8 @@
 #include <cxxtest/TestSuite.h>
 
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "expr/node_manager.h"
 #include "util/integer.h"
@@ -69,4 +71,89 @@ public:
     TS_ASSERT_THROWS(nb.realloc(67108863), AssertionException);
 #endif /* CVC4_ASSERTIONS */
   }
+
+  void testNodeValueAllocatorReuse() {
+    size_t poolSize = d_nm->poolSize();
+    size_t slabs = 0;
+    for (unsigned round = 0; round < 3; ++round) {
+      for (unsigned i = 0; i < 10000; ++i) {
+        Node n = d_nm->mkConst(Rational(i));
+        Node m = d_nm->mkNode(kind::PLUS, n, n);
+      }
+      d_nm->reclaimAllZombies();
+      TS_ASSERT_EQUALS(d_nm->poolSize(), poolSize);
+      if (round == 0) {
+        slabs = d_nm->d_nodeValueAllocator.d_slabs.size();
+        TS_ASSERT(slabs > 0);
+      } else {
+        // the collected NodeValues are recycled
+        TS_ASSERT_EQUALS(d_nm->d_nodeValueAllocator.d_slabs.size(), slabs);
+      }
+    }
+  }
+
+  void testIncrementalZombieCollection() {
+    d_nm->reclaimAllZombies();
+    int64_t reclaimed = d_nm->d_statGcReclaimed.getData();
+    for (unsigned i = 0; i < 100; ++i) {
+      d_nm->mkConst(Rational(i));
+    }
+    TS_ASSERT_EQUALS(d_nm->d_zombies.size(), 100u);
+
+    // a bounded step leaves the rest for later
+    d_nm->reclaimZombies(30);
+    TS_ASSERT_EQUALS(d_nm->d_zombies.size(), 70u);
+#ifdef CVC4_STATISTICS_ON
+    TS_ASSERT_EQUALS(d_nm->d_statGcReclaimed.getData(), reclaimed + 30);
+#endif /* CVC4_STATISTICS_ON */
+
+    d_nm->reclaimZombiesIncrementally();
+    TS_ASSERT(d_nm->d_zombies.empty());
+#ifdef CVC4_STATISTICS_ON
+    TS_ASSERT_EQUALS(d_nm->d_statGcReclaimed.getData(), reclaimed + 100);
+#endif /* CVC4_STATISTICS_ON */
+  }
+
+  void testConcurrentConstruction() {
+    const unsigned numThreads = 4;
+    const unsigned numVars = 16;
+
+    std::vector<Node> vars;
+    for (unsigned i = 0; i < numVars; ++i) {
+      vars.push_back(d_nm->mkSkolem("b", d_nm->booleanType()));
+    }
+    size_t poolSizeBefore = d_nm->poolSize();
+
+    d_nm->setConcurrentAccess(true);
+    TS_ASSERT(d_nm->hasConcurrentAccess());
+    std::vector<std::vector<unsigned long> > ids(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+      threads.push_back(std::thread([this, t, &vars, &ids]() {
+        NodeManagerScope nms(d_nm);
+        for (unsigned i = 0; i < numVars; ++i) {
+          for (unsigned j = 0; j < numVars; ++j) {
+            Node a = d_nm->mkNode(kind::AND, vars[i], vars[j]);
+            Node o = d_nm->mkNode(kind::OR, a, vars[(i + t) % numVars]);
+            ids[t].push_back(a.getId());
+            d_nm->mkConst(Rational(i * numVars + j));
+          }
+        }
+      }));
+    }
+    for (unsigned t = 0; t < numThreads; ++t) {
+      threads[t].join();
+    }
+    d_nm->setConcurrentAccess(false);
+    TS_ASSERT(!d_nm->hasConcurrentAccess());
+
+    // all threads must have found the same hash-consed nodes
+    for (unsigned t = 1; t < numThreads; ++t) {
+      TS_ASSERT_EQUALS(ids[t], ids[0]);
+    }
+
+    // everything built by the workers is garbage now
+    d_nm->reclaimAllZombies();
+    TS_ASSERT_EQUALS(d_nm->poolSize(), poolSizeBefore);
+  }
 };
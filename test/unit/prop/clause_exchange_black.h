@@ -0,0 +1,95 @@
+/*********************                                                        */
+/*! \file clause_exchange_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::prop::ClauseExchange.
+ **
+ ** Black box testing of CVC4::prop::ClauseExchange.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "prop/clause_exchange.h"
+
+using namespace CVC4::prop;
+
+class ClauseExchangeBlack : public CxxTest::TestSuite {
+ public:
+  void testPublishFetch() {
+    ClauseExchange exchange(3, 4);
+    std::vector<uint32_t> clause;
+    TS_ASSERT(!exchange.fetch(0, clause));
+
+    uint32_t c1[] = {2, 5, 7};
+    uint32_t c2[] = {9, 10, 11, 12, 13};
+    TS_ASSERT(exchange.publish(1, c1, 3));
+    // too long
+    TS_ASSERT(!exchange.publish(2, c2, 5));
+
+    // a solver doesn't receive its own clauses
+    TS_ASSERT(!exchange.fetch(1, clause));
+    for (unsigned s = 0; s < 3; s += 2) {
+      TS_ASSERT(exchange.fetch(s, clause));
+      TS_ASSERT_EQUALS(clause, std::vector<uint32_t>(c1, c1 + 3));
+      TS_ASSERT(!exchange.fetch(s, clause));
+    }
+  }
+
+  void testLapped() {
+    ClauseExchange exchange(2, 2, 8);
+    uint32_t c[] = {4, 6};
+    for (unsigned i = 0; i < 5; ++i) {
+      exchange.publish(0, c, 2);
+    }
+    // the reader missed clauses that were overwritten, and restarts
+    // after the last one
+    std::vector<uint32_t> clause;
+    TS_ASSERT(!exchange.fetch(1, clause));
+    exchange.publish(0, c, 1);
+    TS_ASSERT(exchange.fetch(1, clause));
+    TS_ASSERT_EQUALS(clause.size(), 1u);
+    TS_ASSERT(!exchange.fetch(1, clause));
+  }
+
+  void testConcurrent() {
+    ClauseExchange exchange(2, 3, 64);
+    const uint32_t n = 10000;
+    std::atomic<bool> done(false);
+    std::thread writer([&]() {
+      for (uint32_t i = 0; i < n; ++i) {
+        uint32_t c[] = {i, i + 1, i + 2};
+        exchange.publish(0, c, 1 + i % 3);
+      }
+      done = true;
+    });
+    std::vector<uint32_t> clause;
+    uint32_t received = 0;
+    uint32_t last = 0;
+    for (bool finished = false; !finished;) {
+      finished = done;
+      while (exchange.fetch(1, clause)) {
+        // clauses are received whole and in order, some may be skipped
+        TS_ASSERT(!clause.empty());
+        for (size_t j = 1; j < clause.size(); ++j) {
+          TS_ASSERT_EQUALS(clause[j], clause[0] + j);
+        }
+        TS_ASSERT(received == 0 || clause[0] > last);
+        TS_ASSERT_EQUALS(clause.size(), 1 + clause[0] % 3);
+        last = clause[0];
+        ++received;
+      }
+    }
+    writer.join();
+  }
+};
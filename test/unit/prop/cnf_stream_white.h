@@ -45,6 +45,7 @@ using namespace std;
 class FakeSatSolver : public SatSolver {
   SatVariable d_nextVar;
   bool d_addClauseCalled;
+  std::vector<SatClause> d_clauses;
 
  public:
   FakeSatSolver() : d_nextVar(0), d_addClauseCalled(false) {}
@@ -59,6 +60,7 @@ class FakeSatSolver : public SatSolver {
 
   ClauseId addClause(SatClause& c, bool lemma) {
     d_addClauseCalled = true;
+    d_clauses.push_back(c);
     return ClauseIdUndef;
   }
 
@@ -73,6 +75,8 @@ class FakeSatSolver : public SatSolver {
 
   unsigned int addClauseCalled() { return d_addClauseCalled; }
 
+  const std::vector<SatClause>& getClauses() const { return d_clauses; }
+
   unsigned getAssertionLevel() const { return 0; }
 
   bool isDecision(Node) const { return false; }
@@ -282,4 +286,43 @@ class CnfStreamWhite : public CxxTest::TestSuite {
     TS_ASSERT(d_satSolver->addClauseCalled());
     TS_ASSERT(d_cnfStream->hasLiteral(a_and_b));
   }
+
+  void testBatchMatchesSerial() {
+    NodeManagerScope nms(d_nodeManager);
+    std::vector<Node> vars;
+    for (unsigned i = 0; i < 6; ++i) {
+      vars.push_back(d_nodeManager->mkVar(d_nodeManager->booleanType()));
+    }
+    // formulas sharing subformulas, so that the merge has to drop
+    // repeated definitions
+    Node ab = d_nodeManager->mkNode(kind::AND, vars[0], vars[1]);
+    Node cd = d_nodeManager->mkNode(kind::OR, vars[2], vars[3]);
+    Node ef = d_nodeManager->mkNode(kind::XOR, vars[4], vars[5]);
+    std::vector<Node> formulas;
+    formulas.push_back(d_nodeManager->mkNode(kind::IMPLIES, ab, cd));
+    formulas.push_back(d_nodeManager->mkNode(kind::OR, ab.notNode(), ef));
+    formulas.push_back(d_nodeManager->mkNode(kind::EQUAL, cd, ef).notNode());
+    formulas.push_back(d_nodeManager->mkNode(kind::ITE, vars[0], ef, cd));
+    formulas.push_back(d_nodeManager->mkNode(
+        kind::AND, vars[5], d_nodeManager->mkNode(kind::IMPLIES, cd, ab)));
+
+    for (unsigned i = 0; i < formulas.size(); ++i) {
+      d_cnfStream->convertAndAssert(formulas[i], false, false, RULE_GIVEN,
+                                    Node::null());
+    }
+
+    FakeSatSolver batchSolver;
+    context::Context batchContext;
+    theory::TheoryRegistrar batchRegistrar(d_theoryEngine);
+    TseitinCnfStream batchStream(&batchSolver, &batchRegistrar, &batchContext);
+    batchStream.convertAndAssertBatch(formulas, 4);
+
+    // same variables, same clauses, in the same order
+    TS_ASSERT(batchSolver.getClauses() == d_satSolver->getClauses());
+    for (unsigned i = 0; i < vars.size(); ++i) {
+      TS_ASSERT_EQUALS(batchStream.getLiteral(vars[i]),
+                       d_cnfStream->getLiteral(vars[i]));
+    }
+  }
 };
+
@@ -0,0 +1,138 @@
+/*********************                                                        */
+/*! \file preprocessing_cache_white.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief White box testing of CVC4::smt::PreprocessingCache.
+ **
+ ** White box testing of CVC4::smt::PreprocessingCache.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "expr/expr_manager.h"
+#include "expr/node_manager.h"
+#include "smt/preprocessing_cache.h"
+#include "smt/smt_engine.h"
+#include "smt/smt_engine_scope.h"
+#include "util/rational.h"
+
+using namespace CVC4;
+using namespace CVC4::kind;
+using namespace CVC4::smt;
+
+class PreprocessingCacheWhite : public CxxTest::TestSuite {
+  ExprManager* d_em;
+  NodeManager* d_nm;
+  SmtEngine* d_smt;
+  SmtScope* d_scope;
+  std::string d_dir;
+  LogicInfo d_logic;
+
+ public:
+  void setUp() {
+    d_em = new ExprManager();
+    d_nm = NodeManager::fromExprManager(d_em);
+    d_smt = new SmtEngine(d_em);
+    d_scope = new SmtScope(d_smt);
+    char dir[] = "/tmp/cvc4-ppcache-XXXXXX";
+    TS_ASSERT(mkdtemp(dir) != NULL);
+    d_dir = dir;
+    d_logic = LogicInfo("QF_LIA");
+  }
+
+  void tearDown() {
+    DIR* dir = opendir(d_dir.c_str());
+    if (dir != NULL) {
+      while (struct dirent* e = readdir(dir)) {
+        std::string name = e->d_name;
+        if (name != "." && name != "..") {
+          unlink((d_dir + "/" + name).c_str());
+        }
+      }
+      closedir(dir);
+    }
+    rmdir(d_dir.c_str());
+    delete d_scope;
+    delete d_smt;
+    delete d_em;
+  }
+
+  void testStoreLoad() {
+    Node x = Node::fromExpr(d_em->mkVar("x", d_em->integerType()));
+    Node y = Node::fromExpr(d_em->mkVar("y", d_em->integerType()));
+    Node zero = d_nm->mkConst(Rational(0));
+    std::vector<Node> input;
+    input.push_back(d_nm->mkNode(GT, x, zero));
+    input.push_back(d_nm->mkNode(EQUAL, y, d_nm->mkNode(PLUS, x, x)));
+
+    std::vector<Node> simplified;
+    simplified.push_back(d_nm->mkNode(GT, x, zero));
+    simplified.push_back(d_nm->mkNode(GT, y, zero));
+    simplified.push_back(d_nm->mkConst(true));
+
+    PreprocessingCache cache(d_em, d_dir);
+    cache.setInput(input, d_logic);
+    std::vector<Node> loaded = input;
+    size_t end = 0;
+    bool noConflict = false;
+    TS_ASSERT(!cache.load(loaded, end, noConflict));
+    TS_ASSERT_EQUALS(loaded, input);
+    TS_ASSERT(cache.store(simplified, 2, true));
+
+    // a second run on the same input finds the entry
+    PreprocessingCache again(d_em, d_dir);
+    again.setInput(input, d_logic);
+    TS_ASSERT(again.load(loaded, end, noConflict));
+    TS_ASSERT_EQUALS(loaded, simplified);
+    TS_ASSERT_EQUALS(end, 2u);
+    TS_ASSERT(noConflict);
+
+    // but a different input doesn't
+    std::vector<Node> other = input;
+    other.pop_back();
+    PreprocessingCache different(d_em, d_dir);
+    different.setInput(other, d_logic);
+    loaded = other;
+    TS_ASSERT(!different.load(loaded, end, noConflict));
+
+    // nor does the same input in another logic
+    PreprocessingCache otherLogic(d_em, d_dir);
+    otherLogic.setInput(input, LogicInfo("QF_NIA"));
+    loaded = input;
+    TS_ASSERT(!otherLogic.load(loaded, end, noConflict));
+  }
+
+  void testUnmappableSymbols() {
+    Node x = Node::fromExpr(d_em->mkVar("x", d_em->booleanType()));
+    std::vector<Node> input;
+    input.push_back(x);
+
+    // a symbol introduced by preprocessing has no name in later runs
+    std::vector<Node> simplified;
+    simplified.push_back(d_nm->mkNode(
+        AND, x, d_nm->mkSkolem("k", d_nm->booleanType())));
+
+    PreprocessingCache cache(d_em, d_dir);
+    cache.setInput(input, d_logic);
+    TS_ASSERT(!cache.store(simplified, 1, true));
+    std::vector<Node> loaded;
+    size_t end;
+    bool noConflict;
+    TS_ASSERT(!cache.load(loaded, end, noConflict));
+  }
+};
@@ -0,0 +1,298 @@
+/*********************                                                        */
+/*! \file basis_factorization_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of the basis factorization.
+ **
+ ** The solves with the factors are checked against the basis, also after
+ ** updates.  The same pivots are done on a random sparse system in the
+ ** tableau and with the factorization, as a revised simplex would, and
+ ** the resulting rows are compared.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "theory/arith/basis_factorization.h"
+#include "theory/arith/tableau.h"
+#include "util/rational.h"
+
+using namespace CVC4;
+using namespace CVC4::theory::arith;
+
+using namespace std;
+
+class BasisFactorizationBlack : public CxxTest::TestSuite
+{
+  typedef vector<vector<double> > Dense;
+
+  /** A deterministic pseudo-random number for the given seed. */
+  static unsigned scramble(unsigned seed) { return seed * 2654435761u >> 8; }
+
+  /** A random small coefficient, which is 0 unless nonzero is set. */
+  static int coefficient(unsigned seed, bool nonzero)
+  {
+    int c = int(scramble(seed) % 7) - 3;
+    return c == 0 && nonzero ? 1 : c;
+  }
+
+  static vector<BasisFactorization::SparseVector> columns(const Dense& b)
+  {
+    vector<BasisFactorization::SparseVector> cols(b.size());
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+      for (size_t s = 0; s < b.size(); ++s)
+      {
+        if (b[i][s] != 0.0)
+        {
+          cols[s].push_back(make_pair(i, b[i][s]));
+        }
+      }
+    }
+    return cols;
+  }
+
+  /** The largest error of the solves with the factors, relative to them. */
+  static double solveError(BasisFactorization& f, const Dense& b, unsigned seed)
+  {
+    size_t m = b.size();
+    vector<double> a(m), c(m);
+    for (size_t i = 0; i < m; ++i)
+    {
+      a[i] = coefficient(seed + i, false);
+      c[i] = coefficient(seed + m + i, false);
+    }
+    vector<double> x = a, y = c;
+    f.ftran(x, false);
+    f.btran(y);
+    double err = 0.0, xMax = 1.0, yMax = 1.0;
+    for (size_t i = 0; i < m; ++i)
+    {
+      xMax = max(xMax, fabs(x[i]));
+      yMax = max(yMax, fabs(y[i]));
+    }
+    for (size_t i = 0; i < m; ++i)
+    {
+      double bx = 0.0, yb = 0.0;
+      for (size_t j = 0; j < m; ++j)
+      {
+        bx += b[i][j] * x[j];
+        yb += y[j] * b[j][i];
+      }
+      err = max(err, fabs(bx - a[i]) / xMax);
+      err = max(err, fabs(yb - c[i]) / yMax);
+    }
+    return err;
+  }
+
+ public:
+  void testSolves()
+  {
+    for (unsigned trial = 0; trial < 50; ++trial)
+    {
+      size_t m = 1 + scramble(trial) % 30;
+      Dense b(m, vector<double>(m, 0.0));
+      for (size_t s = 0; s < m; ++s)
+      {
+        b[s][s] = 4 + scramble(trial + s) % 3;
+        b[scramble(trial * 7 + s) % m][s] += coefficient(trial + 3 * s, false);
+        b[scramble(trial * 11 + s) % m][s] += coefficient(trial + 5 * s, false);
+      }
+      BasisFactorization f;
+      TS_ASSERT(f.factor(columns(b)));
+      TS_ASSERT_LESS_THAN(solveError(f, b, trial), 1e-9);
+
+      for (unsigned u = 0; u < 40; ++u)
+      {
+        unsigned seed = trial * 1000 + u;
+        size_t slot = scramble(seed) % m;
+        vector<double> a(m, 0.0);
+        for (unsigned k = 0; k < 3; ++k)
+        {
+          a[scramble(seed + k) % m] += coefficient(seed + 17 * k, true);
+        }
+        vector<double> d = a;
+        f.ftran(d, true);
+        double dMax = 0.0;
+        for (double v : d)
+        {
+          dMax = max(dMax, fabs(v));
+        }
+        // only well-conditioned replacements, as a simplex would choose
+        if (dMax == 0.0 || fabs(d[slot]) < 0.1 * dMax)
+        {
+          continue;
+        }
+        TS_ASSERT(f.update(slot));
+        for (size_t i = 0; i < m; ++i)
+        {
+          b[i][slot] = a[i];
+        }
+        TS_ASSERT_LESS_THAN(solveError(f, b, seed), 1e-9);
+      }
+    }
+  }
+
+  void testSingular()
+  {
+    Dense b(3, vector<double>(3, 1.0));
+    BasisFactorization f;
+    TS_ASSERT(!f.factor(columns(b)));
+  }
+
+  void testPivotsMatchTableau()
+  {
+    const size_t rows = 200, structural = 200, perRow = 4, pivots = 300;
+    const size_t n = structural + rows;
+
+    // the rows s_i = sum of a_ij x_j in the tableau, and as the rows of
+    // A [x s] = 0 with the columns of the slacks as the basis
+    Tableau tableau;
+    tableau.increaseSizeTo(n);
+    vector<vector<pair<ArithVar, double> > > aRows(rows);
+    vector<BasisFactorization::SparseVector> aCols(n);
+    for (size_t i = 0; i < rows; ++i)
+    {
+      vector<Rational> coeffs;
+      vector<ArithVar> vars;
+      for (size_t k = 0; k < perRow; ++k)
+      {
+        ArithVar x = scramble(i * perRow + k) % structural;
+        if (find(vars.begin(), vars.end(), x) == vars.end())
+        {
+          int c = coefficient(i * 31 + k, true);
+          coeffs.push_back(Rational(c));
+          vars.push_back(x);
+          aRows[i].push_back(make_pair(x, double(c)));
+          aCols[x].push_back(make_pair(i, double(c)));
+        }
+      }
+      tableau.addRow(structural + i, coeffs, vars);
+      aRows[i].push_back(make_pair(structural + i, -1.0));
+      aCols[structural + i].push_back(make_pair(i, -1.0));
+    }
+    vector<ArithVar> basic(rows);
+    vector<size_t> slotOf(n, rows);
+    vector<BasisFactorization::SparseVector> basis;
+    for (size_t i = 0; i < rows; ++i)
+    {
+      basic[i] = structural + i;
+      slotOf[structural + i] = i;
+      basis.push_back(aCols[structural + i]);
+    }
+    BasisFactorization factors;
+    TS_ASSERT(factors.factor(basis));
+
+    // the pivots, each on the largest entry of the row of a basic variable
+    vector<pair<size_t, ArithVar> > sequence;
+    NoEffectCCCB noeffect;
+    for (size_t p = 0; p < pivots; ++p)
+    {
+      size_t slot = scramble(p) % rows;
+      ArithVar leaving = basic[slot];
+      ArithVar entering = ARITHVAR_SENTINEL;
+      Rational best;
+      for (Tableau::RowIterator ri = tableau.basicRowIterator(leaving);
+           !ri.atEnd();
+           ++ri)
+      {
+        const Tableau::Entry& entry = *ri;
+        if (entry.getColVar() != leaving
+            && entry.getCoefficient().abs() > best)
+        {
+          best = entry.getCoefficient().abs();
+          entering = entry.getColVar();
+        }
+      }
+      if (entering == ARITHVAR_SENTINEL)
+      {
+        continue;
+      }
+      tableau.pivot(leaving, entering, noeffect);
+      sequence.push_back(make_pair(slot, entering));
+      basic[slot] = entering;
+    }
+
+    // The same pivots in the revised form: the row of the leaving variable
+    // from B^{-1}, to find the entering variable, its column, and the update.
+    for (size_t i = 0; i < rows; ++i)
+    {
+      basic[i] = structural + i;
+    }
+    for (const pair<size_t, ArithVar>& pivot : sequence)
+    {
+      size_t slot = pivot.first;
+      ArithVar entering = pivot.second;
+
+      vector<double> rho(rows, 0.0);
+      rho[slot] = 1.0;
+      factors.btran(rho);
+      double alpha = 0.0;
+      for (size_t i = 0; i < rows; ++i)
+      {
+        for (const pair<ArithVar, double>& entry : aRows[i])
+        {
+          if (entry.first == entering)
+          {
+            alpha -= rho[i] * entry.second;
+          }
+        }
+      }
+      TS_ASSERT_DIFFERS(alpha, 0.0);
+
+      vector<double> d(rows, 0.0);
+      for (const pair<size_t, double>& entry : aCols[entering])
+      {
+        d[entry.first] = entry.second;
+      }
+      factors.ftran(d, true);
+      TS_ASSERT_DELTA(-d[slot], alpha, 1e-6 * max(1.0, fabs(alpha)));
+
+      slotOf[basic[slot]] = rows;
+      basic[slot] = entering;
+      slotOf[entering] = slot;
+      if (factors.getNumUpdates() >= 100 || !factors.update(slot))
+      {
+        basis.clear();
+        for (ArithVar b : basic)
+        {
+          basis.push_back(aCols[b]);
+        }
+        TS_ASSERT(factors.factor(basis));
+      }
+    }
+    // the final rows agree
+    for (size_t slot = 0; slot < rows; ++slot)
+    {
+      vector<double> rho(rows, 0.0);
+      rho[slot] = 1.0;
+      factors.btran(rho);
+      vector<double> alpha(n, 0.0);
+      for (size_t i = 0; i < rows; ++i)
+      {
+        for (const pair<ArithVar, double>& entry : aRows[i])
+        {
+          alpha[entry.first] -= rho[i] * entry.second;
+        }
+      }
+      for (Tableau::RowIterator ri = tableau.basicRowIterator(basic[slot]);
+           !ri.atEnd();
+           ++ri)
+      {
+        const Tableau::Entry& entry = *ri;
+        double c = entry.getCoefficient().getDouble();
+        TS_ASSERT_DELTA(alpha[entry.getColVar()], c, 1e-6 * max(1.0, fabs(c)));
+      }
+    }
+  }
+};
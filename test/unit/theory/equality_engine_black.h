@@ -0,0 +1,234 @@
+/*********************                                                        */
+/*! \file equality_engine_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of the equality engine.
+ **
+ ** Black box testing of the equality engine.  The workloads merge chains
+ ** of uninterpreted constants under unary and binary function symbols,
+ ** backtrack part of the way as a search would, and explain the derived
+ ** congruences, also through the explanation cache.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "context/context.h"
+#include "expr/node.h"
+#include "expr/node_manager.h"
+#include "smt/smt_engine.h"
+#include "smt/smt_engine_scope.h"
+#include "theory/uf/equality_engine.h"
+#include "theory/uf/equality_id_map.h"
+
+using namespace CVC4;
+using namespace CVC4::context;
+using namespace CVC4::smt;
+using namespace CVC4::theory::eq;
+
+using namespace std;
+
+class EqualityEngineBlack : public CxxTest::TestSuite
+{
+  ExprManager* d_em;
+  NodeManager* d_nm;
+  SmtEngine* d_smt;
+  SmtScope* d_scope;
+  Context* d_context;
+  EqualityEngine* d_ee;
+
+  /** The constants x_i, and the terms f(x_i) and g(x_i, x_i+1). */
+  vector<Node> d_x;
+  vector<Node> d_f;
+  vector<Node> d_g;
+  /** The equalities x_i = x_i+1. */
+  vector<Node> d_eqs;
+
+  /** Number of constants. */
+  static const unsigned SIZE = 2000;
+  /** Number of backjumps. */
+  static const unsigned ROUNDS = 200;
+  /** Equalities asserted per level. */
+  static const unsigned PER_LEVEL = 16;
+
+  /** A deterministic pseudo-random number for the given seed. */
+  static unsigned scramble(unsigned seed) { return seed * 2654435761u >> 8; }
+
+ public:
+  void setUp()
+  {
+    d_em = new ExprManager();
+    d_nm = NodeManager::fromExprManager(d_em);
+    d_smt = new SmtEngine(d_em);
+    d_scope = new SmtScope(d_smt);
+    d_context = new Context();
+    d_ee = new EqualityEngine(d_context, "EqualityEngineBlack", false);
+    d_ee->addFunctionKind(kind::APPLY_UF);
+
+    TypeNode u = d_nm->mkSort("U");
+    Node f = d_nm->mkSkolem("f", d_nm->mkFunctionType(u, u));
+    vector<TypeNode> args(2, u);
+    Node g = d_nm->mkSkolem("g", d_nm->mkFunctionType(args, u));
+    for (unsigned i = 0; i < SIZE; ++i)
+    {
+      d_x.push_back(d_nm->mkSkolem("x", u));
+    }
+    for (unsigned i = 0; i < SIZE; ++i)
+    {
+      d_f.push_back(d_nm->mkNode(kind::APPLY_UF, f, d_x[i]));
+      d_g.push_back(
+          d_nm->mkNode(kind::APPLY_UF, g, d_x[i], d_x[(i + 1) % SIZE]));
+      d_ee->addTerm(d_f[i]);
+      d_ee->addTerm(d_g[i]);
+    }
+    for (unsigned i = 0; i + 1 < SIZE; ++i)
+    {
+      d_eqs.push_back(d_x[i].eqNode(d_x[i + 1]));
+    }
+  }
+
+  void tearDown()
+  {
+    delete d_ee;
+    d_eqs.clear();
+    d_g.clear();
+    d_f.clear();
+    d_x.clear();
+    delete d_context;
+    delete d_scope;
+    delete d_smt;
+    delete d_em;
+  }
+
+  void testMergeBacktrack()
+  {
+    unsigned merged = 0;
+    for (unsigned round = 0; round < ROUNDS; ++round)
+    {
+      d_context->push();
+      // merge a run of the chain level by level
+      unsigned first = scramble(round) % (SIZE / 2);
+      for (unsigned level = 0; level < 8; ++level)
+      {
+        d_context->push();
+        for (unsigned i = 0; i < PER_LEVEL; ++i)
+        {
+          TNode eq = d_eqs[first + level * PER_LEVEL + i];
+          d_ee->assertEquality(eq, true, eq);
+        }
+      }
+      unsigned last = first + 8 * PER_LEVEL;
+      TS_ASSERT(d_ee->areEqual(d_x[first], d_x[last]));
+      TS_ASSERT(d_ee->areEqual(d_f[first], d_f[last]));
+      TS_ASSERT(d_ee->areEqual(d_g[first], d_g[last - 1]));
+      TS_ASSERT(!d_ee->areEqual(d_x[first], d_x[last + 1]));
+      merged += last - first;
+      d_context->popto(d_context->getLevel() - 8);
+      TS_ASSERT(!d_ee->areEqual(d_x[first], d_x[first + 1]));
+      TS_ASSERT(!d_ee->areEqual(d_f[first], d_f[first + 1]));
+      d_context->pop();
+    }
+    TS_ASSERT_EQUALS(merged, ROUNDS * 8 * PER_LEVEL);
+  }
+
+  void testExplain()
+  {
+    const unsigned length = 256;
+    d_context->push();
+    for (unsigned i = 0; i < length; ++i)
+    {
+      d_ee->assertEquality(d_eqs[i], true, d_eqs[i]);
+    }
+    for (unsigned round = 0; round < ROUNDS; ++round)
+    {
+      unsigned i = scramble(round) % length;
+      unsigned j = scramble(round + 1) % length;
+      vector<TNode> assumptions;
+      d_ee->explainEquality(d_f[i], d_f[j], true, assumptions);
+      // the path between x_i and x_j in the chain
+      set<TNode> distinct(assumptions.begin(), assumptions.end());
+      TS_ASSERT_EQUALS(distinct.size(), i < j ? j - i : i - j);
+    }
+    d_context->pop();
+  }
+
+  void testExplanationCache()
+  {
+    d_context->push();
+    for (unsigned i = 0; i < 10; ++i)
+    {
+      d_ee->assertEquality(d_eqs[i], true, d_eqs[i]);
+    }
+    vector<TNode> first;
+    d_ee->explainEquality(d_f[0], d_f[10], true, first);
+    vector<TNode> second;
+    d_ee->explainEquality(d_f[10], d_f[0], true, second);
+    TS_ASSERT_EQUALS(first.size(), 10u);
+    TS_ASSERT_EQUALS(set<TNode>(first.begin(), first.end()),
+                     set<TNode>(second.begin(), second.end()));
+    d_context->pop();
+
+    // the cached explanation doesn't survive the edges it used
+    Node eq = d_x[0].eqNode(d_x[10]);
+    d_context->push();
+    d_ee->assertEquality(eq, true, eq);
+    vector<TNode> third;
+    d_ee->explainEquality(d_f[0], d_f[10], true, third);
+    TS_ASSERT_EQUALS(third.size(), 1u);
+    TS_ASSERT_EQUALS(third[0], eq);
+    d_context->pop();
+  }
+
+  void testIdMap()
+  {
+    EqualityIdMap<FunctionApplication, FunctionApplicationHashFunction> map;
+    unordered_map<FunctionApplication,
+                  EqualityNodeId,
+                  FunctionApplicationHashFunction>
+        reference;
+    vector<FunctionApplication> inserted;
+    for (unsigned i = 0; i < 100000; ++i)
+    {
+      unsigned r = scramble(i);
+      if (r % 5 == 0 && !inserted.empty())
+      {
+        // remove in the order the engine backtracks
+        map.erase(inserted.back());
+        reference.erase(inserted.back());
+        inserted.pop_back();
+      }
+      else if (r % 5 == 1 && !inserted.empty())
+      {
+        // remove out of order
+        size_t k = r % inserted.size();
+        map.erase(inserted[k]);
+        reference.erase(inserted[k]);
+        inserted[k] = inserted.back();
+        inserted.pop_back();
+      }
+      else
+      {
+        FunctionApplication app(APP_UNINTERPRETED, r % 1024, i);
+        map.insert(app, i);
+        reference[app] = i;
+        inserted.push_back(app);
+      }
+      TS_ASSERT_EQUALS(map.size(), reference.size());
+    }
+    for (const auto& entry : reference)
+    {
+      TS_ASSERT_EQUALS(map.find(entry.first), entry.second);
+    }
+    TS_ASSERT(!map.contains(FunctionApplication(APP_EQUALITY, 0, 0)));
+  }
+};
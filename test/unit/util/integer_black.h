@@ -327,6 +327,36 @@ public:
     TS_ASSERT_THROWS_ANYTHING(i.getUnsignedLong());
   }
 
+  void testWordBoundary() {
+    // values around the machine word, which are computed without and with
+    // GMP
+    Integer max(numeric_limits<long>::max());
+    Integer min(numeric_limits<long>::min());
+    Integer one(1);
+    TS_ASSERT_EQUALS((max + one).toString(), "9223372036854775808");
+    TS_ASSERT_EQUALS(max + one - one, max);
+    TS_ASSERT_EQUALS(min - one + one, min);
+    TS_ASSERT_EQUALS(-min, max + one);
+    TS_ASSERT_EQUALS((-min).toString(), "9223372036854775808");
+    TS_ASSERT_EQUALS(min.getLong(), numeric_limits<long>::min());
+    TS_ASSERT_EQUALS((max * max).floorDivideQuotient(max), max);
+    TS_ASSERT_EQUALS(min.abs(), max + one);
+    TS_ASSERT(min < max);
+    TS_ASSERT(min < -max);
+    TS_ASSERT(max + one > max);
+    TS_ASSERT_EQUALS(Integer("9223372036854775807"), max);
+    TS_ASSERT_EQUALS(Integer(1).multiplyByPow2(63), max + one);
+    TS_ASSERT_EQUALS(Integer(-1).multiplyByPow2(63), min);
+    TS_ASSERT_EQUALS(min.divByPow2(63), Integer(-1));
+    TS_ASSERT_EQUALS(Integer(-7).floorDivideQuotient(Integer(2)), Integer(-4));
+    TS_ASSERT_EQUALS(Integer(-7).ceilingDivideRemainder(Integer(2)), Integer(-1));
+    Integer i = max;
+    i += one;
+    i -= one;
+    TS_ASSERT_EQUALS(i, max);
+    TS_ASSERT_EQUALS(i.hash(), max.hash());
+  }
+
   void testTestBit() {
     TS_ASSERT( ! Integer(0).testBit(6) );
     TS_ASSERT( ! Integer(0).testBit(5) );
@@ -0,0 +1,129 @@
+/*********************                                                        */
+/*! \file lemma_hub_black.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the CVC4 project.
+ ** Copyright (c) 2009-2018 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Black box testing of CVC4::LemmaHub.
+ **
+ ** Black box testing of CVC4::LemmaHub.
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+#include "expr/expr_manager.h"
+#include "expr/pickler.h"
+#include "smt_util/lemma_hub.h"
+
+using namespace CVC4;
+using namespace CVC4::expr::pickle;
+
+class LemmaHubBlack : public CxxTest::TestSuite {
+  ExprManager* d_em;
+
+ public:
+  void setUp() override { d_em = new ExprManager(); }
+
+  void tearDown() override { delete d_em; }
+
+  void testRoundTrip() {
+    Expr x = d_em->mkVar("x", d_em->booleanType());
+    Expr y = d_em->mkVar("y", d_em->booleanType());
+    Expr lemma = d_em->mkExpr(kind::OR, x, d_em->mkExpr(kind::NOT, y));
+
+    Pickler pickler(d_em);
+    Pickle out;
+    pickler.toPickle(lemma, out);
+
+    LemmaHub hub(3);
+    TS_ASSERT(hub.publish(1, out));
+
+    Pickle in;
+    // a thread doesn't receive its own lemmas
+    TS_ASSERT(!hub.fetch(1, in));
+    for (unsigned t = 0; t < 3; t += 2) {
+      TS_ASSERT(hub.fetch(t, in));
+      TS_ASSERT_EQUALS(pickler.fromPickle(in), lemma);
+      TS_ASSERT(!hub.fetch(t, in));
+    }
+  }
+
+  void testDuplicates() {
+    Expr x = d_em->mkVar("x", d_em->booleanType());
+    Expr y = d_em->mkVar("y", d_em->booleanType());
+    Expr lemma = d_em->mkExpr(kind::OR, x, y);
+
+    Pickler pickler(d_em);
+    Pickle p;
+    pickler.toPickle(lemma, p);
+
+    LemmaHub hub(3);
+    TS_ASSERT(hub.publish(0, p));
+    TS_ASSERT(hub.publish(1, p));
+    TS_ASSERT(hub.publish(0, p));
+
+    Pickle in;
+    TS_ASSERT(hub.fetch(2, in));
+    TS_ASSERT(!hub.fetch(2, in));
+    TS_ASSERT_EQUALS(hub.getDuplicates(2), 2u);
+    // thread 1 published it itself
+    TS_ASSERT(!hub.fetch(1, in));
+    TS_ASSERT_EQUALS(hub.getDuplicates(1), 2u);
+
+    LemmaHub all(2, false);
+    TS_ASSERT(all.publish(0, p));
+    TS_ASSERT(all.publish(0, p));
+    TS_ASSERT(all.fetch(1, in));
+    TS_ASSERT(all.fetch(1, in));
+    TS_ASSERT(!all.fetch(1, in));
+  }
+
+  void testDistinct() {
+    Pickler pickler(d_em);
+    std::vector<Expr> vars;
+    for (unsigned i = 0; i < 32; ++i) {
+      vars.push_back(d_em->mkVar(d_em->booleanType()));
+    }
+
+    LemmaHub hub(2);
+    unsigned published = 0;
+    for (unsigned i = 0; i < vars.size(); ++i) {
+      for (unsigned j = i + 1; j < vars.size(); ++j) {
+        Pickle p;
+        pickler.toPickle(d_em->mkExpr(kind::OR, vars[i], vars[j]), p);
+        TS_ASSERT(hub.publish(0, p));
+        ++published;
+      }
+    }
+
+    // lemmas that differ are all fetched
+    Pickle in;
+    unsigned fetched = 0;
+    while (hub.fetch(1, in)) {
+      ++fetched;
+    }
+    TS_ASSERT_EQUALS(fetched, published);
+    TS_ASSERT_EQUALS(hub.getDuplicates(1), 0u);
+  }
+
+  void testTooLarge() {
+    Expr x = d_em->mkVar("x", d_em->booleanType());
+    Expr y = d_em->mkVar("y", d_em->booleanType());
+    Expr lemma = d_em->mkExpr(kind::OR, x, y);
+
+    Pickler pickler(d_em);
+    Pickle p;
+    pickler.toPickle(lemma, p);
+
+    LemmaHub hub(2, true, 4);
+    TS_ASSERT(!hub.publish(0, p));
+    TS_ASSERT(!hub.fetch(1, p));
+  }
+};
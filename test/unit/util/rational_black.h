@@ -44,4 +44,36 @@ public:
     TS_ASSERT_THROWS( Rational::fromDecimal("Hello, world!");, const std::invalid_argument& );
   }
 
+  void testWordBoundary() {
+    // values around the machine word, which are computed without and with
+    // GMP
+    long max = numeric_limits<long>::max();
+    Rational q(max, 2L);
+    TS_ASSERT_EQUALS(q + q, Rational(max, 1L));
+    TS_ASSERT_EQUALS((q + Rational(1, 2)).toString(), "4611686018427387904");
+    TS_ASSERT_EQUALS(Rational(max, 1L) + Rational(1, 1) - Rational(1, 1),
+                     Rational(max, 1L));
+    TS_ASSERT_EQUALS((Rational(1L, max) * Rational(1L, max)).toString(),
+                     "1/85070591730234615847396907784232501249");
+    TS_ASSERT_EQUALS(
+        Rational(1L, max) * Rational(1L, max) * Rational(max, 1L),
+        Rational(1L, max));
+    TS_ASSERT_EQUALS(Rational(max, 3L) / Rational(max, 6L), Rational(2, 1));
+    TS_ASSERT(Rational(max, max - 1) < Rational(max - 1, max - 2));
+    TS_ASSERT(Rational(max - 1, max) > Rational(max - 2, max - 1));
+    TS_ASSERT_EQUALS(Rational(-6, -4), Rational(3, 2));
+    TS_ASSERT_EQUALS(Rational(6, -4), Rational(-3, 2));
+    TS_ASSERT_EQUALS(Rational(-3, 2).inverse(), Rational(-2, 3));
+    TS_ASSERT_EQUALS(Rational(-3, 2).floor(), Integer(-2));
+    TS_ASSERT_EQUALS(Rational(-3, 2).ceiling(), Integer(-1));
+    TS_ASSERT_EQUALS(
+        Rational(canReduce).toString(),
+        "2273948945274377448948948948945394539453945/27439451173945117");
+
+    Rational r(max, 1L);
+    r *= Rational(2, 1);
+    r /= Rational(2, 1);
+    TS_ASSERT_EQUALS(r, Rational(max, 1L));
+    TS_ASSERT_EQUALS(r.hash(), Rational(max, 1L).hash());
+  }
 };